@@ -0,0 +1,101 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarks/utils.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+void cellmlAnalysis(benchmark::State &pState, const std::string &pResourceRelativePath)
+{
+    // Parse and analyse the given model, using unique contents for each iteration so that we always measure a cold
+    // analysis.
+
+    const auto contents {libOpenCOR::File::create(libOpenCOR::resourcePath(pResourceRelativePath))->contents()};
+    const auto virtualFilePath {libOpenCOR::resourcePath("benchmark_" + pResourceRelativePath)};
+    libOpenCOR::FilePtr file;
+    size_t index {0};
+
+    for (auto _ : pState) {
+        pState.PauseTiming();
+
+        file = nullptr;
+        file = libOpenCOR::File::create(virtualFilePath, false);
+
+        auto fileContents {libOpenCOR::uniqueContents(contents, ++index)};
+
+        pState.ResumeTiming();
+
+        file->setContents(fileContents);
+
+        benchmark::DoNotOptimize(file->type());
+    }
+}
+
+void coldCompilation(benchmark::State &pState, const std::string &pResourceRelativePath)
+{
+    // Instantiate the given model, using a new file for each iteration so that our runtime always needs to be
+    // generated and compiled.
+    // Note: our model is analysed before timing starts and, thanks to our analysed model cache, that analysis only
+    //       happens once. Also, the document and instance of the previous iteration are released before timing
+    //       resumes, so that we don't measure the release of their runtime.
+
+    const auto filePath {libOpenCOR::resourcePath(pResourceRelativePath)};
+    libOpenCOR::SedDocumentPtr document;
+    libOpenCOR::SedInstancePtr instance;
+
+    for (auto _ : pState) {
+        pState.PauseTiming();
+
+        instance = nullptr;
+        document = nullptr;
+        document = libOpenCOR::SedDocument::create(libOpenCOR::File::create(filePath));
+
+        pState.ResumeTiming();
+
+        instance = document->instantiate();
+
+        benchmark::DoNotOptimize(instance.get());
+    }
+}
+
+void warmCompilation(benchmark::State &pState, const std::string &pResourceRelativePath)
+{
+    // Instantiate the given model using the same document, so that our runtime is retrieved from our runtime cache.
+
+    auto document {libOpenCOR::SedDocument::create(libOpenCOR::File::create(libOpenCOR::resourcePath(pResourceRelativePath)))};
+
+    benchmark::DoNotOptimize(document->instantiate());
+
+    for (auto _ : pState) {
+        benchmark::DoNotOptimize(document->instantiate());
+    }
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(cellmlAnalysis, cellml2, std::string("cellml_2.cellml"))->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(cellmlAnalysis, ode, std::string("api/solver/ode.cellml"))->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(cellmlAnalysis, dae, std::string("api/sed/dae.cellml"))->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(coldCompilation, cellml2, std::string("cellml_2.cellml"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(coldCompilation, ode, std::string("api/solver/ode.cellml"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(coldCompilation, dae, std::string("api/sed/dae.cellml"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(warmCompilation, cellml2, std::string("cellml_2.cellml"))->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(warmCompilation, ode, std::string("api/solver/ode.cellml"))->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(warmCompilation, dae, std::string("api/sed/dae.cellml"))->Unit(benchmark::kMicrosecond);
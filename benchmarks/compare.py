@@ -0,0 +1,81 @@
+# Copyright libOpenCOR contributors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compare two sets of benchmark results, as generated by the benchmarking target, and report any benchmark that got
+# slower than the given threshold.
+
+import argparse
+import json
+import sys
+
+
+def benchmark_times(file_name, time_type):
+    with open(file_name) as file:
+        benchmarks = json.load(file)["benchmarks"]
+
+    # Only keep actual benchmark runs, i.e. not the aggregates (mean, median, etc.) that get generated when a benchmark
+    # is repeated.
+
+    return {
+        benchmark["name"]: benchmark[time_type]
+        for benchmark in benchmarks
+        if benchmark.get("run_type", "iteration") == "iteration"
+        and "error_occurred" not in benchmark
+    }
+
+
+parser = argparse.ArgumentParser(
+    description="Compare two sets of libOpenCOR benchmark results."
+)
+parser.add_argument("baseline", help="the baseline benchmark results (JSON)")
+parser.add_argument("contender", help="the contender benchmark results (JSON)")
+parser.add_argument(
+    "--threshold",
+    type=float,
+    default=5.0,
+    help="the slowdown, in percent, above which a benchmark is considered to have regressed (default: 5)",
+)
+parser.add_argument(
+    "--time",
+    choices=["real_time", "cpu_time"],
+    default="real_time",
+    help="the time to compare (default: real_time)",
+)
+
+args = parser.parse_args()
+
+baseline_times = benchmark_times(args.baseline, args.time)
+contender_times = benchmark_times(args.contender, args.time)
+regressions = []
+name_width = max((len(name) for name in baseline_times), default=0)
+
+for name, baseline_time in baseline_times.items():
+    if name not in contender_times:
+        print(f"{name:<{name_width}}  missing from the contender results")
+
+        continue
+
+    change = 100.0 * (contender_times[name] - baseline_time) / baseline_time
+
+    if change > args.threshold:
+        regressions.append(name)
+
+    print(f"{name:<{name_width}}  {change:+8.2f}%")
+
+if regressions:
+    print(
+        f"\n{len(regressions)} benchmark(s) got more than {args.threshold}% slower: {', '.join(regressions)}"
+    )
+
+    sys.exit(1)
@@ -0,0 +1,96 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarks/utils.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+namespace {
+
+void fileLoad(benchmark::State &pState, const std::string &pResourceRelativePath)
+{
+    // Load (and sniff the type of) the given file, making sure that it is not already managed, so that we measure the
+    // full cost of loading it.
+
+    const auto filePath {libOpenCOR::resourcePath(pResourceRelativePath)};
+
+    for (auto _ : pState) {
+        auto file {libOpenCOR::File::create(filePath)};
+
+        benchmark::DoNotOptimize(file->type());
+    }
+}
+
+void fileManagerConcurrentCreateDestroy(benchmark::State &pState)
+{
+    // Create, access by index, and destroy, from several threads, a set of files, some of which are shared between
+    // threads while the given number of others are specific to a thread, so that we measure the contention on our file
+    // manager and how it scales with the number of managed files.
+
+    static const std::array<std::string, 6> SHARED_FILES {
+        "cellml_1_x.cellml",
+        "cellml_2.cellml",
+        "cellml_2.sedml",
+        "error.cellml",
+        "unknown_file.txt",
+        "warning.cellml",
+    };
+
+    std::vector<std::string> filePaths;
+
+    const auto threadFileCount {static_cast<size_t>(pState.range(0))};
+    auto &fileManager {libOpenCOR::FileManager::instance()};
+
+    filePaths.reserve(SHARED_FILES.size() + threadFileCount);
+
+    for (const auto &sharedFile : SHARED_FILES) {
+        filePaths.push_back(libOpenCOR::resourcePath(sharedFile));
+    }
+
+    for (size_t i {0}; i < threadFileCount; ++i) {
+        filePaths.push_back(libOpenCOR::resourcePath("benchmark_" + std::to_string(pState.thread_index()) + "_" + std::to_string(i) + ".cellml"));
+    }
+
+    for (auto _ : pState) {
+        libOpenCOR::FilePtrs files;
+
+        files.reserve(filePaths.size());
+
+        for (const auto &filePath : filePaths) {
+            files.push_back(libOpenCOR::File::create(filePath, false));
+        }
+
+        for (size_t i {0}; i < files.size(); ++i) {
+            benchmark::DoNotOptimize(fileManager.file(i));
+        }
+
+        benchmark::DoNotOptimize(files.data());
+    }
+
+    pState.SetItemsProcessed(static_cast<int64_t>(pState.iterations() * filePaths.size()));
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(fileLoad, cellml1x, std::string("cellml_1_x.cellml"))->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(fileLoad, cellml2, std::string("cellml_2.cellml"))->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(fileLoad, sedml, std::string("cellml_2.sedml"))->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(fileLoad, combineArchive, std::string("cellml_2.omex"))->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(fileLoad, unknownFile, std::string("unknown_file.txt"))->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(fileManagerConcurrentCreateDestroy)->RangeMultiplier(10)->Range(10, 100000)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMicrosecond);
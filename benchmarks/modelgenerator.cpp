@@ -0,0 +1,216 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "modelgenerator.h"
+
+#include "benchmarks/utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+namespace libOpenCOR {
+
+namespace {
+
+constexpr auto COUPLING_STRENGTH {0.5};
+constexpr auto LOOP_COEFFICIENT {0.1};
+constexpr auto FEEDBACK_STRENGTH {0.1};
+
+std::string ci(const std::string &pName)
+{
+    return "<ci>" + pName + "</ci>";
+}
+
+std::string cn(double pValue)
+{
+    return std::format(R"(<cn cellml:units="dimensionless">{}</cn>)", pValue);
+}
+
+std::string applyElement(const std::string &pOperator, const Strings &pArguments)
+{
+    std::string res {"<apply><" + pOperator + "/>"};
+
+    for (const auto &argument : pArguments) {
+        res += argument;
+    }
+
+    return res + "</apply>";
+}
+
+std::string variable(const std::string &pName, const std::string &pInitialValue = {})
+{
+    return "<variable name=\"" + pName + R"(" units="dimensionless")"
+           + (pInitialValue.empty() ? "" : " initial_value=\"" + pInitialValue + "\"") + "/>";
+}
+
+std::string stateName(size_t pIndex)
+{
+    return "x_" + std::to_string(pIndex);
+}
+
+std::string loopVariableName(size_t pLoopIndex, size_t pIndex)
+{
+    return "y_" + std::to_string(pLoopIndex) + "_" + std::to_string(pIndex);
+}
+
+std::string modelHeader(const std::string &pName)
+{
+    return R"(<?xml version="1.0" encoding="UTF-8"?>
+<model xmlns="http://www.cellml.org/cellml/2.0#" xmlns:cellml="http://www.cellml.org/cellml/2.0#" xmlns:xlink="http://www.w3.org/1999/xlink" name=")"
+           + pName + "\">\n";
+}
+
+std::string importModel(const std::string &pName, const std::string &pImportedFileName)
+{
+    return modelHeader(pName)
+           + "  <import xlink:href=\"" + pImportedFileName + R"(">
+    <component name="main" component_ref="main"/>
+  </import>
+</model>
+)";
+}
+
+std::string mainModel(const std::string &pName, const ModelParameters &pParameters)
+{
+    // Declare our variables.
+
+    const auto stateCount {std::max<size_t>(pParameters.stateCount, 1)};
+    const auto couplingCount {std::min(pParameters.couplingCount, stateCount - 1)};
+    const auto algebraicLoopSize {std::max<size_t>(pParameters.algebraicLoopSize, 1)};
+    std::string variables {"    " + variable("t") + "\n"};
+
+    for (size_t i {0}; i < stateCount; ++i) {
+        const auto k {(stateCount == 1) ?
+                          1.0 :
+                          std::pow(std::max(pParameters.stiffness, 1.0), static_cast<double>(i) / static_cast<double>(stateCount - 1))};
+
+        variables += "    " + variable(stateName(i), std::format("{}", 1.0 + static_cast<double>(i % 10) / 10.0)) + "\n";
+        variables += "    " + variable("k_" + std::to_string(i), std::format("{}", k)) + "\n";
+    }
+
+    for (size_t i {0}; i < pParameters.algebraicLoopCount; ++i) {
+        for (size_t j {0}; j < algebraicLoopSize; ++j) {
+            variables += "    " + variable(loopVariableName(i, j), "0") + "\n";
+        }
+    }
+
+    // Generate our algebraic loops, keeping track of the state that each of them feeds back into.
+    // Note: the equations of an algebraic loop are such that none of them can be rearranged to compute one of its
+    //       variables, i.e. y_l_j + 0.1 * y_l_(j+1) = x_s, so the analyser has to treat them as an NLA system.
+
+    std::vector<Strings> feedbackTerms(stateCount);
+    std::string equations;
+
+    for (size_t i {0}; i < pParameters.algebraicLoopCount; ++i) {
+        const auto stateIndex {i * stateCount / pParameters.algebraicLoopCount};
+
+        for (size_t j {0}; j < algebraicLoopSize; ++j) {
+            equations += "      "
+                         + applyElement("eq", {applyElement("plus", {ci(loopVariableName(i, j)),
+                                                       applyElement("times", {cn(LOOP_COEFFICIENT), ci(loopVariableName(i, (j + 1) % algebraicLoopSize))})}),
+                                        ci(stateName(stateIndex))})
+                         + "\n";
+        }
+
+        feedbackTerms[stateIndex].push_back(applyElement("times", {cn(FEEDBACK_STRENGTH), ci("k_" + std::to_string(stateIndex)), ci(loopVariableName(i, 0))}));
+    }
+
+    // Generate our ODEs.
+
+    for (size_t i {0}; i < stateCount; ++i) {
+        std::string drive;
+
+        if (couplingCount == 0) {
+            drive = applyElement("minus", {ci(stateName(i))});
+        } else {
+            Strings coupledStates;
+
+            for (size_t j {1}; j <= couplingCount; ++j) {
+                coupledStates.push_back(ci(stateName((i + j) % stateCount)));
+            }
+
+            const auto coupling {(couplingCount == 1) ? coupledStates[0] : applyElement("plus", coupledStates)};
+
+            drive = applyElement("minus", {applyElement("times", {cn(COUPLING_STRENGTH / static_cast<double>(couplingCount)), coupling}),
+                                    ci(stateName(i))});
+        }
+
+        auto rate {applyElement("times", {ci("k_" + std::to_string(i)), drive})};
+
+        if (!feedbackTerms[i].empty()) {
+            feedbackTerms[i].insert(feedbackTerms[i].begin(), rate);
+
+            rate = applyElement("plus", feedbackTerms[i]);
+        }
+
+        equations += "      "
+                     + applyElement("eq", {"<apply><diff/><bvar>" + ci("t") + "</bvar>" + ci(stateName(i)) + "</apply>", rate})
+                     + "\n";
+    }
+
+    return modelHeader(pName)
+           + R"(  <component name="main">
+)" + variables
+           + R"(    <math xmlns="http://www.w3.org/1998/Math/MathML">
+)" + equations
+           + R"(    </math>
+  </component>
+</model>
+)";
+}
+
+void saveModel(const std::filesystem::path &pFilePath, const std::string &pContents)
+{
+    std::ofstream file(pFilePath, std::ios::binary | std::ios::trunc);
+
+    file << pContents;
+}
+
+} // namespace
+
+FilePtr generatedModel(const ModelParameters &pParameters)
+{
+    // Determine where our model and the files that it imports, if any, are to be saved.
+    // Note: the main component of our model is in the most deeply imported file, i.e. import_<importDepth>.cellml, with
+    //       import_<i>.cellml importing it from import_<i+1>.cellml.
+
+    const auto name {std::format("model_{}_{}_{}_{}_{}_{}", pParameters.stateCount, pParameters.couplingCount,
+                                 pParameters.stiffness, pParameters.algebraicLoopCount, pParameters.algebraicLoopSize,
+                                 pParameters.importDepth)};
+    const auto directory {std::filesystem::path(GENERATED_MODEL_LOCATION) / name};
+
+    std::filesystem::create_directories(directory);
+
+    for (size_t i {1}; i < pParameters.importDepth; ++i) {
+        saveModel(directory / std::format("import_{}.cellml", i),
+                  importModel(std::format("import_{}", i), std::format("import_{}.cellml", i + 1)));
+    }
+
+    if (pParameters.importDepth == 0) {
+        saveModel(directory / "model.cellml", mainModel(name, pParameters));
+    } else {
+        saveModel(directory / std::format("import_{}.cellml", pParameters.importDepth),
+                  mainModel(std::format("import_{}", pParameters.importDepth), pParameters));
+        saveModel(directory / "model.cellml", importModel(name, "import_1.cellml"));
+    }
+
+    return File::create((directory / "model.cellml").string());
+}
+
+} // namespace libOpenCOR
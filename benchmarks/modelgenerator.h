@@ -0,0 +1,45 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <libopencor>
+
+namespace libOpenCOR {
+
+// The parameters of a generated model.
+// Note: each state x_i of a generated model is such that dx_i/dt = k_i * (0.5 * mean(x_j) - x_i), where the x_j are the
+//       next couplingCount states (wrapping around) and the k_i are logarithmically spaced between 1 and stiffness,
+//       i.e. stiffness is the ratio between the slowest and the fastest time constants of the model. Each algebraic
+//       loop is an NLA system of algebraicLoopSize equations that depends on a state and feeds back into its rate.
+//       Finally, the model is imported through a chain of importDepth files.
+
+struct ModelParameters
+{
+    size_t stateCount {10};
+    size_t couplingCount {2};
+    double stiffness {1.0};
+    size_t algebraicLoopCount {0};
+    size_t algebraicLoopSize {2};
+    size_t importDepth {0};
+};
+
+// Generate a CellML 2.0 model with the given parameters, save it (and the files that it imports, if any) in our
+// generated model location, and return it as a file.
+
+FilePtr generatedModel(const ModelParameters &pParameters);
+
+} // namespace libOpenCOR
@@ -0,0 +1,213 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarks/modelgenerator.h"
+#include "benchmarks/utils.h"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+
+namespace {
+
+// Note: the number of states of our generated models goes up to 10,000, except when using a dense Jacobian, whose size
+//       grows quadratically with the number of states, in which case it goes up to 1,000.
+
+constexpr auto SMALLEST_STATE_COUNT {10};
+constexpr auto LARGEST_STATE_COUNT {10000};
+constexpr auto LARGEST_DENSE_STATE_COUNT {1000};
+constexpr auto OUTPUT_END_TIME {10.0};
+constexpr auto NUMBER_OF_STEPS {1000};
+
+libOpenCOR::ModelParameters stateCountParameters(const benchmark::State &pState)
+{
+    libOpenCOR::ModelParameters res;
+
+    res.stateCount = static_cast<size_t>(pState.range(0));
+
+    return res;
+}
+
+void runPerStep(benchmark::State &pState, const libOpenCOR::SedDocumentPtr &pDocument)
+{
+    // Run the given document, reporting the time it takes per output step, as well as the number of steps taken by
+    // the ODE solver and the number of bytes used by the results of a run.
+    // Note: the first run initialises our instance, so it is not timed.
+
+    auto instance {pDocument->instantiate()};
+    const auto &task {instance->tasks()[0]};
+
+    task->setInstrumented(true);
+
+    instance->run();
+
+    if (instance->hasIssues()) {
+        pState.SkipWithError("The instance could not be run.");
+
+        return;
+    }
+
+    for (auto _ : pState) {
+        instance->run();
+    }
+
+    pState.counters["step"] = benchmark::Counter(static_cast<double>(NUMBER_OF_STEPS),
+                                                 benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+    pState.counters["odeSteps"] = static_cast<double>(task->statistic(libOpenCOR::SedInstanceTask::Statistic::ODE_STEP_COUNT));
+    pState.counters["resultBytes"] = benchmark::Counter(static_cast<double>(task->statistic(libOpenCOR::SedInstanceTask::Statistic::RESULT_BYTE_COUNT)),
+                                                        benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+}
+
+void analysis(benchmark::State &pState, const libOpenCOR::ModelParameters &pParameters)
+{
+    // Parse and analyse the given generated model, using unique contents for each iteration so that we always measure
+    // a cold analysis.
+    // Note: our virtual file lives next to our generated model so that its imports, if any, can be resolved.
+
+    const auto generatedFile {libOpenCOR::generatedModel(pParameters)};
+    const auto contents {generatedFile->contents()};
+    const auto virtualFilePath {(std::filesystem::path(generatedFile->fileName()).parent_path() / "benchmark_model.cellml").string()};
+    libOpenCOR::FilePtr file;
+    size_t index {0};
+
+    for (auto _ : pState) {
+        pState.PauseTiming();
+
+        file = nullptr;
+        file = libOpenCOR::File::create(virtualFilePath, false);
+
+        auto fileContents {libOpenCOR::uniqueContents(contents, ++index)};
+
+        pState.ResumeTiming();
+
+        file->setContents(fileContents);
+
+        benchmark::DoNotOptimize(file->type());
+    }
+}
+
+void stateCountAnalysis(benchmark::State &pState)
+{
+    analysis(pState, stateCountParameters(pState));
+}
+
+void importDepthAnalysis(benchmark::State &pState)
+{
+    libOpenCOR::ModelParameters parameters;
+
+    parameters.importDepth = static_cast<size_t>(pState.range(0));
+
+    analysis(pState, parameters);
+}
+
+void stateCountCompilation(benchmark::State &pState)
+{
+    // Instantiate the given generated model, using a new file for each iteration so that our runtime always needs to
+    // be generated and compiled.
+    // Note: as for coldCompilation, our model is only analysed once and the document and instance of the previous
+    //       iteration are released before timing resumes.
+
+    const auto fileName {libOpenCOR::generatedModel(stateCountParameters(pState))->fileName()};
+    libOpenCOR::SedDocumentPtr document;
+    libOpenCOR::SedInstancePtr instance;
+
+    for (auto _ : pState) {
+        pState.PauseTiming();
+
+        instance = nullptr;
+        document = nullptr;
+        document = libOpenCOR::SedDocument::create(libOpenCOR::File::create(fileName));
+
+        pState.ResumeTiming();
+
+        instance = document->instantiate();
+
+        benchmark::DoNotOptimize(instance.get());
+    }
+}
+
+void stateCountCvode(benchmark::State &pState, libOpenCOR::SolverCvode::LinearSolver pLinearSolver)
+{
+    auto solver {libOpenCOR::SolverCvode::create()};
+
+    solver->setLinearSolver(pLinearSolver);
+
+    runPerStep(pState, libOpenCOR::uniformTimeCourseDocument(libOpenCOR::generatedModel(stateCountParameters(pState)),
+                                                             OUTPUT_END_TIME, NUMBER_OF_STEPS, solver));
+}
+
+void stateAndThreadCountCvode(benchmark::State &pState)
+{
+    // Run the given generated model using CVODE with a matrix-free linear solver, so that the cost of a step is
+    // dominated by vector operations, and using the given number of threads for those vector operations. Comparing
+    // the different thread counts for a given state count shows the model size at which threaded vectors pay off.
+    // Note: this only makes a difference if libOpenCOR was built with threaded vectors.
+
+    auto solver {libOpenCOR::SolverCvode::create()};
+
+    solver->setLinearSolver(libOpenCOR::SolverCvode::LinearSolver::GMRES);
+    solver->setThreadCount(static_cast<int>(pState.range(1)));
+
+    runPerStep(pState, libOpenCOR::uniformTimeCourseDocument(libOpenCOR::generatedModel(stateCountParameters(pState)),
+                                                             OUTPUT_END_TIME, NUMBER_OF_STEPS, solver));
+}
+
+void stiffnessCvode(benchmark::State &pState)
+{
+    libOpenCOR::ModelParameters parameters;
+
+    parameters.stateCount = 100;
+    parameters.stiffness = static_cast<double>(pState.range(0));
+
+    runPerStep(pState, libOpenCOR::uniformTimeCourseDocument(libOpenCOR::generatedModel(parameters), OUTPUT_END_TIME,
+                                                             NUMBER_OF_STEPS));
+}
+
+void algebraicLoopSizeKinsol(benchmark::State &pState)
+{
+    libOpenCOR::ModelParameters parameters;
+
+    parameters.algebraicLoopCount = 1;
+    parameters.algebraicLoopSize = static_cast<size_t>(pState.range(0));
+
+    runPerStep(pState, libOpenCOR::uniformTimeCourseDocument(libOpenCOR::generatedModel(parameters), OUTPUT_END_TIME,
+                                                             NUMBER_OF_STEPS));
+}
+
+void stateCountResults(benchmark::State &pState)
+{
+    // Run the given generated model using Forward Euler with a step that matches our output interval, so that the
+    // cost of a run is dominated by the recording of its results.
+
+    auto solver {libOpenCOR::SolverForwardEuler::create()};
+
+    solver->setStep(OUTPUT_END_TIME / static_cast<double>(NUMBER_OF_STEPS));
+
+    runPerStep(pState, libOpenCOR::uniformTimeCourseDocument(libOpenCOR::generatedModel(stateCountParameters(pState)),
+                                                             OUTPUT_END_TIME, NUMBER_OF_STEPS, solver));
+}
+
+} // namespace
+
+BENCHMARK(stateCountAnalysis)->RangeMultiplier(10)->Range(SMALLEST_STATE_COUNT, LARGEST_STATE_COUNT)->Unit(benchmark::kMillisecond);
+BENCHMARK(importDepthAnalysis)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond);
+BENCHMARK(stateCountCompilation)->RangeMultiplier(10)->Range(SMALLEST_STATE_COUNT, LARGEST_STATE_COUNT)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(stateCountCvode, dense, libOpenCOR::SolverCvode::LinearSolver::DENSE)->RangeMultiplier(10)->Range(SMALLEST_STATE_COUNT, LARGEST_DENSE_STATE_COUNT)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(stateCountCvode, gmres, libOpenCOR::SolverCvode::LinearSolver::GMRES)->RangeMultiplier(10)->Range(SMALLEST_STATE_COUNT, LARGEST_STATE_COUNT)->Unit(benchmark::kMillisecond);
+BENCHMARK(stateAndThreadCountCvode)->ArgsProduct({benchmark::CreateRange(SMALLEST_STATE_COUNT, LARGEST_STATE_COUNT, 10), benchmark::CreateRange(1, 8, 2)})->ArgNames({"states", "threads"})->Unit(benchmark::kMillisecond);
+BENCHMARK(stiffnessCvode)->RangeMultiplier(100)->Range(1, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(algebraicLoopSizeKinsol)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond);
+BENCHMARK(stateCountResults)->RangeMultiplier(10)->Range(SMALLEST_STATE_COUNT, LARGEST_STATE_COUNT)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,159 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarks/utils.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+constexpr auto OUTPUT_END_TIME {50.0};
+constexpr auto NUMBER_OF_STEPS {5000};
+
+void resultRecording(benchmark::State &pState, const std::string &pResourceRelativePath)
+{
+    // Run the given model using Forward Euler with a step that matches our output interval, so that the cost of a run
+    // is dominated by the recording of its results rather than by the solving of its model.
+
+    const auto numberOfSteps {static_cast<int>(pState.range(0))};
+    auto solver {libOpenCOR::SolverForwardEuler::create()};
+
+    solver->setStep(OUTPUT_END_TIME / static_cast<double>(numberOfSteps));
+
+    auto document {libOpenCOR::uniformTimeCourseDocument(pResourceRelativePath, OUTPUT_END_TIME, numberOfSteps, solver)};
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    if (instance->hasIssues()) {
+        pState.SkipWithError("The instance could not be run.");
+
+        return;
+    }
+
+    for (auto _ : pState) {
+        instance->run();
+    }
+
+    const auto &task {instance->tasks()[0]};
+    const auto variableCount {task->stateCount() + task->rateCount() + task->constantCount()
+                              + task->computedConstantCount() + task->algebraicVariableCount()};
+
+    pState.SetBytesProcessed(static_cast<int64_t>(pState.iterations()) * static_cast<int64_t>(numberOfSteps + 1)
+                             * static_cast<int64_t>(variableCount * sizeof(double)));
+}
+
+void concurrentInstances(benchmark::State &pState)
+{
+    // Run an instance per thread, all of them sharing the same file and therefore the same runtime.
+
+    static const auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+
+    simulation->setOutputEndTime(OUTPUT_END_TIME);
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    auto instance {document->instantiate()};
+
+    for (auto _ : pState) {
+        instance->run();
+    }
+
+    pState.SetItemsProcessed(static_cast<int64_t>(pState.iterations()));
+}
+
+void perStepOverhead(benchmark::State &pState)
+{
+    // Run a tiny model with many output steps using Forward Euler with a step that matches our output interval, so
+    // that the cost of a run is dominated by our per-step overhead (i.e. checking whether a pause or stop has been
+    // requested, publishing our progress, and recording our results), with each thread running its own instance.
+
+    static constexpr auto STEP_COUNT {1000000};
+
+    auto solver {libOpenCOR::SolverForwardEuler::create()};
+
+    solver->setStep(OUTPUT_END_TIME / static_cast<double>(STEP_COUNT));
+
+    auto document {libOpenCOR::uniformTimeCourseDocument("cellml_2.cellml", OUTPUT_END_TIME, STEP_COUNT, solver)};
+    auto instance {document->instantiate()};
+
+    for (auto _ : pState) {
+        instance->run();
+    }
+
+    pState.counters["step"] = benchmark::Counter(static_cast<double>(STEP_COUNT),
+                                                 benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+void rerunWithNewConstant(benchmark::State &pState)
+{
+    // Rerun an existing instance after changing one of its constants.
+
+    auto document {libOpenCOR::uniformTimeCourseDocument("api/solver/ode.cellml", OUTPUT_END_TIME, NUMBER_OF_STEPS)};
+    auto instance {document->instantiate()};
+    const auto &task {instance->tasks()[0]};
+    const auto constant {task->constant(0)[0]};
+    size_t index {0};
+
+    instance->run();
+
+    for (auto _ : pState) {
+        task->setConstant(0, constant * (1.0 + 0.01 * static_cast<double>(++index % 2)));
+
+        instance->run();
+    }
+}
+
+void reinstantiateWithNewConstant(benchmark::State &pState)
+{
+    // Instantiate and run a document after changing one of its constants, i.e. what we would have to do without the
+    // ability to change the constants of an existing instance.
+    // Note: the runtime of our model is retrieved from our runtime cache, so no compilation is involved.
+
+    auto document {libOpenCOR::uniformTimeCourseDocument("api/solver/ode.cellml", OUTPUT_END_TIME, NUMBER_OF_STEPS)};
+    double constant {0.0};
+    size_t index {0};
+
+    {
+        auto instance {document->instantiate()};
+
+        instance->run();
+
+        constant = instance->tasks()[0]->constant(0)[0];
+    }
+
+    for (auto _ : pState) {
+        auto instance {document->instantiate()};
+
+        instance->tasks()[0]->setConstant(0, constant * (1.0 + 0.01 * static_cast<double>(++index % 2)));
+        instance->run();
+    }
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(resultRecording, cellml2, std::string("cellml_2.cellml"))->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(resultRecording, ode, std::string("api/solver/ode.cellml"))->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(resultRecording, dae, std::string("api/sed/dae.cellml"))->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(concurrentInstances)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK(perStepOverhead)->ThreadRange(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK(rerunWithNewConstant)->Unit(benchmark::kMillisecond);
+BENCHMARK(reinstantiateWithNewConstant)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,108 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarks/utils.h"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+
+namespace {
+
+constexpr auto ODE_MODEL {"api/solver/ode.cellml"};
+constexpr auto DAE_MODEL {"api/sed/dae.cellml"};
+constexpr auto OUTPUT_END_TIME {50.0};
+constexpr auto NUMBER_OF_STEPS {5000};
+constexpr auto FIXED_STEP {0.01};
+
+void runPerStep(benchmark::State &pState, const libOpenCOR::SedDocumentPtr &pDocument)
+{
+    // Run the given document, reporting the time it takes per output step.
+    // Note: the first run initialises our instance, so it is not timed.
+
+    auto instance {pDocument->instantiate()};
+
+    instance->run();
+
+    if (instance->hasIssues()) {
+        pState.SkipWithError("The instance could not be run.");
+
+        return;
+    }
+
+    for (auto _ : pState) {
+        instance->run();
+    }
+
+    pState.counters["step"] = benchmark::Counter(static_cast<double>(NUMBER_OF_STEPS),
+                                                 benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+template<typename T>
+libOpenCOR::SolverOdePtr fixedStepSolver()
+{
+    auto res {T::create()};
+
+    res->setStep(FIXED_STEP);
+
+    return res;
+}
+
+void fixedStepSolverPerStep(benchmark::State &pState, const std::function<libOpenCOR::SolverOdePtr()> &pSolver)
+{
+    runPerStep(pState, libOpenCOR::uniformTimeCourseDocument(ODE_MODEL, OUTPUT_END_TIME, NUMBER_OF_STEPS, pSolver()));
+}
+
+void cvodePerStep(benchmark::State &pState, libOpenCOR::SolverCvode::LinearSolver pLinearSolver)
+{
+    auto solver {libOpenCOR::SolverCvode::create()};
+
+    solver->setLinearSolver(pLinearSolver);
+
+    runPerStep(pState, libOpenCOR::uniformTimeCourseDocument(ODE_MODEL, OUTPUT_END_TIME, NUMBER_OF_STEPS, solver));
+}
+
+void kinsolPerStep(benchmark::State &pState, libOpenCOR::SolverKinsol::LinearSolver pLinearSolver)
+{
+    // Run a DAE model, which means that KINSOL gets called at least once per step.
+
+    auto document {libOpenCOR::uniformTimeCourseDocument(DAE_MODEL, OUTPUT_END_TIME, NUMBER_OF_STEPS)};
+    auto kinsol {std::dynamic_pointer_cast<libOpenCOR::SolverKinsol>(document->simulations()[0]->nlaSolver())};
+
+    kinsol->setLinearSolver(pLinearSolver);
+
+    runPerStep(pState, document);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(fixedStepSolverPerStep, forwardEuler, fixedStepSolver<libOpenCOR::SolverForwardEuler>)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(fixedStepSolverPerStep, heun, fixedStepSolver<libOpenCOR::SolverHeun>)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(fixedStepSolverPerStep, secondOrderRungeKutta, fixedStepSolver<libOpenCOR::SolverSecondOrderRungeKutta>)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(fixedStepSolverPerStep, fourthOrderRungeKutta, fixedStepSolver<libOpenCOR::SolverFourthOrderRungeKutta>)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(cvodePerStep, dense, libOpenCOR::SolverCvode::LinearSolver::DENSE)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cvodePerStep, banded, libOpenCOR::SolverCvode::LinearSolver::BANDED)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cvodePerStep, diagonal, libOpenCOR::SolverCvode::LinearSolver::DIAGONAL)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cvodePerStep, gmres, libOpenCOR::SolverCvode::LinearSolver::GMRES)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cvodePerStep, bicgstab, libOpenCOR::SolverCvode::LinearSolver::BICGSTAB)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(cvodePerStep, tfqmr, libOpenCOR::SolverCvode::LinearSolver::TFQMR)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(kinsolPerStep, dense, libOpenCOR::SolverKinsol::LinearSolver::DENSE)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(kinsolPerStep, banded, libOpenCOR::SolverKinsol::LinearSolver::BANDED)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(kinsolPerStep, gmres, libOpenCOR::SolverKinsol::LinearSolver::GMRES)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(kinsolPerStep, bicgstab, libOpenCOR::SolverKinsol::LinearSolver::BICGSTAB)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(kinsolPerStep, tfqmr, libOpenCOR::SolverKinsol::LinearSolver::TFQMR)->Unit(benchmark::kMillisecond);
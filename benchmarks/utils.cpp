@@ -0,0 +1,67 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "benchmarks/utils.h"
+
+#include <filesystem>
+
+namespace libOpenCOR {
+
+std::string resourcePath(const std::string &pResourceRelativePath)
+{
+    return std::filesystem::weakly_canonical(std::string(RESOURCE_LOCATION) + "/" + pResourceRelativePath).string();
+}
+
+UnsignedChars uniqueContents(const UnsignedChars &pContents, size_t pIndex)
+{
+    // Return a copy of the given contents with a unique trailing comment, so that our analysed model cache cannot be
+    // used.
+
+    auto res {pContents};
+    const auto comment {"\n<!-- " + std::to_string(pIndex) + " -->\n"};
+
+    res.insert(res.end(), comment.begin(), comment.end());
+
+    return res;
+}
+
+SedDocumentPtr uniformTimeCourseDocument(const FilePtr &pFile, double pOutputEndTime, int pNumberOfSteps,
+                                         const SolverOdePtr &pOdeSolver)
+{
+    // Create a document for the given model, making sure that it uses a uniform time course with the given output end
+    // time and number of steps, as well as the given ODE solver, if any.
+
+    auto document {SedDocument::create(pFile)};
+    auto simulation {std::dynamic_pointer_cast<SedUniformTimeCourse>(document->simulations()[0])};
+
+    simulation->setOutputEndTime(pOutputEndTime);
+    simulation->setNumberOfSteps(pNumberOfSteps);
+
+    if (pOdeSolver != nullptr) {
+        simulation->setOdeSolver(pOdeSolver);
+    }
+
+    return document;
+}
+
+SedDocumentPtr uniformTimeCourseDocument(const std::string &pResourceRelativePath, double pOutputEndTime,
+                                         int pNumberOfSteps, const SolverOdePtr &pOdeSolver)
+{
+    return uniformTimeCourseDocument(File::create(resourcePath(pResourceRelativePath)), pOutputEndTime, pNumberOfSteps,
+                                     pOdeSolver);
+}
+
+} // namespace libOpenCOR
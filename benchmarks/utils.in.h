@@ -0,0 +1,35 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <libopencor>
+
+namespace libOpenCOR {
+
+static constexpr auto RESOURCE_LOCATION {"@RESOURCE_LOCATION@"};
+static constexpr auto GENERATED_MODEL_LOCATION {"@GENERATED_MODEL_LOCATION@"};
+
+std::string resourcePath(const std::string &pResourceRelativePath = {});
+
+UnsignedChars uniqueContents(const UnsignedChars &pContents, size_t pIndex);
+
+SedDocumentPtr uniformTimeCourseDocument(const FilePtr &pFile, double pOutputEndTime, int pNumberOfSteps,
+                                         const SolverOdePtr &pOdeSolver = {});
+SedDocumentPtr uniformTimeCourseDocument(const std::string &pResourceRelativePath, double pOutputEndTime,
+                                         int pNumberOfSteps, const SolverOdePtr &pOdeSolver = {});
+
+} // namespace libOpenCOR
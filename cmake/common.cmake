@@ -265,6 +265,13 @@ function(configure_target TARGET)
                                    CODE_COVERAGE_ENABLED)
     endif()
 
+    # Let the target know that we are building with SUNDIALS' threaded vectors.
+
+    if(LIBOPENCOR_THREADED_VECTORS)
+        target_compile_definitions(${TARGET} PRIVATE
+                                   THREADED_VECTORS_ENABLED)
+    endif()
+
     # Let the target know that we are fine with using std::codecvt_utf8() even though it has been deprecated in C++17
     # (but no replacement has been provided yet).
     # Note: this is so that we can convert a std::wstring to a std::string on Windows (see pathToString()), hence the
@@ -110,6 +110,10 @@ get_property(IS_MULTI_CONFIG GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG)
 
 find_package(Doxygen)
 
+# Look for Google Benchmark.
+
+find_package(benchmark CONFIG QUIET)
+
 # Look for Python.
 
 if (CMAKE_VERSION VERSION_LESS 3.18)
@@ -310,6 +314,12 @@ if(BIOME_EXE)
     set(JAVASCRIPT_FORMATTING_AVAILABLE TRUE)
 endif()
 
+if(TARGET benchmark::benchmark AND TARGET benchmark::benchmark_main)
+    set(BENCHMARKS_AVAILABLE TRUE)
+else()
+    set(BENCHMARKS_ERROR_MESSAGE "Benchmarks are requested but Google Benchmark could not be found.")
+endif()
+
 if(TARGET Python::Module AND TARGET Python::Interpreter)
     set(PYTHON_BINDINGS_AVAILABLE TRUE)
 else()
@@ -33,6 +33,7 @@ class LIBOPENCOR_EXPORT File: public Logger
 {
     friend class CellmlFile;
     friend class CombineArchive;
+    friend class FileManager;
     friend class SedDocument;
     friend class SedInstanceTask;
     friend class SedmlFile;
@@ -240,6 +241,8 @@ private:
 
     explicit File(const std::string &pFileNameOrUrl, bool pRetrieveContents); /**< Constructor, @private. */
 
+    void extractContents() const; /**< Extract the contents of the file, if needed, @private. */
+
     Impl *pimpl(); /**< Private implementation pointer, @private. */
     const Impl *pimpl() const; /**< Constant private implementation pointer, @private. */
 };
@@ -108,7 +108,8 @@ public:
     /**
      * @brief Return the managed file at the given index.
      *
-     * Return the managed file at the given index.
+     * Return the managed file at the given index, in constant time. To iterate over the managed files, use files()
+     * instead since a file that is being destroyed by another thread is still indexed, albeit as @c nullptr.
      *
      * @param pIndex The index of the managed file.
      *
@@ -131,6 +132,82 @@ public:
     FilePtr fileFromFileNameOrUrl(const std::string &pFileNameOrUrl) const;
 #else
     FilePtr file(const std::string &pFileNameOrUrl) const;
+
+    /**
+     * @brief Return the directory of the download cache.
+     *
+     * Return the directory of the download cache.
+     *
+     * @return The directory of the download cache, or an empty string if the download cache is disabled.
+     *
+     * @sa setCacheDirectory()
+     */
+
+    std::string cacheDirectory() const;
+
+    /**
+     * @brief Set the directory of the download cache.
+     *
+     * Set the directory of the download cache. Remote files are cached in that directory and revalidated, using their
+     * ETag and/or Last-Modified value, the next time they are needed. An empty string disables the download cache,
+     * which is the default.
+     *
+     * @param pCacheDirectory The directory of the download cache.
+     *
+     * @sa cacheDirectory()
+     */
+
+    void setCacheDirectory(const std::string &pCacheDirectory);
+
+    /**
+     * @brief Return the size limit of the download cache.
+     *
+     * Return the size limit of the download cache.
+     *
+     * @return The size limit of the download cache, in bytes.
+     *
+     * @sa setCacheSizeLimit()
+     */
+
+    size_t cacheSizeLimit() const;
+
+    /**
+     * @brief Set the size limit of the download cache.
+     *
+     * Set the size limit of the download cache. The least recently used files are evicted from the download cache
+     * whenever its size exceeds that limit. The default size limit is 100 MB.
+     *
+     * @param pCacheSizeLimit The size limit of the download cache, in bytes.
+     *
+     * @sa cacheSizeLimit()
+     */
+
+    void setCacheSizeLimit(size_t pCacheSizeLimit);
+
+    /**
+     * @brief Return whether we are offline.
+     *
+     * Return whether we are offline.
+     *
+     * @return @c true if we are offline, @c false otherwise.
+     *
+     * @sa setOffline()
+     */
+
+    bool offline() const;
+
+    /**
+     * @brief Set whether we are offline.
+     *
+     * Set whether we are offline. If we are offline then remote files are only retrieved from the download cache,
+     * without being revalidated.
+     *
+     * @param pOffline Whether we are offline.
+     *
+     * @sa offline()
+     */
+
+    void setOffline(bool pOffline);
 #endif
 
 private:
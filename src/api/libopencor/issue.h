@@ -94,7 +94,8 @@ private:
 
     std::unique_ptr<Impl> mPimpl; /**< The private implementation, @private. */
 
-    explicit Issue(Type pType, const std::string &pDescription, const std::string &pContext); /**< Constructor, @private. */
+    explicit Issue(Type pType, std::string pDescription, std::string pContext); /**< Constructor, @private. */
+    explicit Issue(Type pType, const std::shared_ptr<const std::string> &pDescription, std::string pContext); /**< Constructor, @private. */
 };
 
 } // namespace libOpenCOR
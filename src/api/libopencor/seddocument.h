@@ -325,6 +325,23 @@ public:
 
     SedInstancePtr instantiate();
 
+    /**
+     * @brief Create an ensemble of instances of this simulation experiment description.
+     *
+     * Create an ensemble of instances of this simulation experiment description. Each member of the ensemble has its
+     * own value for the given parameters, which are states and/or constants of the model. The parameter values are
+     * given member after member, i.e. the value of the j-th parameter of the i-th member is at index i*P+j, where P is
+     * the number of parameters. The simulation experiment description must have only one task, which must be for an
+     * ODE model that is simulated using a uniform time course.
+     *
+     * @param pParameterNames The names of the parameters.
+     * @param pParameterValues The values of the parameters for all the members.
+     *
+     * @return A smart pointer to a @ref SedEnsemble object.
+     */
+
+    SedEnsemblePtr instantiateEnsemble(const Strings &pParameterNames, const Doubles &pParameterValues);
+
 private:
     class Impl; /**< Forward declaration of the implementation class, @private. */
 
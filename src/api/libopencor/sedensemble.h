@@ -0,0 +1,261 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libopencor/logger.h"
+
+#include <span>
+
+namespace libOpenCOR {
+
+/**
+ * @brief The SedEnsemble class.
+ *
+ * The SedEnsemble class is used to describe an ensemble of instances of a simulation experiment description, i.e. a set
+ * of members that only differ in the value of some of their parameters. All the members share the same compiled model
+ * and the same metadata, while their data is allocated in contiguous blocks of memory. The members are run across a
+ * pool of threads.
+ */
+
+class LIBOPENCOR_EXPORT SedEnsemble: public Logger
+{
+    friend class SedDocument;
+
+public:
+    /**
+     * Constructors, destructor, and assignment operators.
+     */
+
+    ~SedEnsemble() override; /**< Destructor, @private. */
+
+    SedEnsemble(const SedEnsemble &pOther) = delete; /**< No copy constructor allowed, @private. */
+    SedEnsemble(SedEnsemble &&pOther) noexcept = delete; /**< No move constructor allowed, @private. */
+
+    SedEnsemble &operator=(const SedEnsemble &pRhs) = delete; /**< No copy assignment operator allowed, @private. */
+    SedEnsemble &operator=(SedEnsemble &&pRhs) noexcept = delete; /**< No move assignment operator allowed, @private. */
+
+    /**
+     * @brief Return the number of members.
+     *
+     * Return the number of members.
+     *
+     * @return The number of members.
+     */
+
+    size_t memberCount() const noexcept;
+
+    /**
+     * @brief Return the number of parameters.
+     *
+     * Return the number of parameters, i.e. the number of states and/or constants which value is set for each member.
+     *
+     * @return The number of parameters.
+     */
+
+    size_t parameterCount() const noexcept;
+
+    /**
+     * @brief Return the name of the parameter at the given index.
+     *
+     * Return the name of the parameter at the given index.
+     *
+     * @param pIndex The index of the parameter.
+     *
+     * @return The name of the parameter at the given index, if valid, an empty string otherwise.
+     */
+
+    const std::string &parameterName(size_t pIndex) const noexcept;
+
+    /**
+     * @brief Return the number of threads used to run the members.
+     *
+     * Return the number of threads used to run the members.
+     *
+     * @return The number of threads used to run the members.
+     */
+
+    size_t threadCount() const noexcept;
+
+    /**
+     * @brief Set the number of threads used to run the members.
+     *
+     * Set the number of threads used to run the members. A value of @c 0 means that the number of threads is the
+     * number of concurrent threads supported by the hardware.
+     *
+     * @param pThreadCount The number of threads used to run the members.
+     */
+
+    void setThreadCount(size_t pThreadCount);
+
+    /**
+     * @brief Run all the members of this ensemble.
+     *
+     * Run all the members of this ensemble.
+     *
+     * @return The elapsed time in milliseconds.
+     */
+
+    double run();
+
+    /**
+     * @brief Return the values of the variable of integration.
+     *
+     * Return the values of the variable of integration, which are the same for all the members.
+     *
+     * @return The values of the variable of integration.
+     */
+
+#ifdef __EMSCRIPTEN__
+    const emscripten::val &voi() const noexcept;
+#else
+    std::span<const double> voi() const noexcept;
+#endif
+
+    /**
+     * @brief Return the name of the variable of integration.
+     *
+     * Return the name of the variable of integration.
+     *
+     * @return The name of the variable of integration.
+     */
+
+    const std::string &voiName() const noexcept;
+
+    /**
+     * @brief Return the unit of the variable of integration.
+     *
+     * Return the unit of the variable of integration.
+     *
+     * @return The unit of the variable of integration.
+     */
+
+    const std::string &voiUnit() const noexcept;
+
+    /**
+     * @brief Return the number of states.
+     *
+     * Return the number of states.
+     *
+     * @return The number of states.
+     */
+
+    size_t stateCount() const noexcept;
+
+    /**
+     * @brief Return the values of the state at the given index for the given member.
+     *
+     * Return the values of the state at the given index for the given member.
+     *
+     * @param pMemberIndex The index of the member.
+     * @param pIndex The index of the state.
+     *
+     * @return The values of the state at the given index for the given member, if valid, an empty vector otherwise.
+     */
+
+#ifdef __EMSCRIPTEN__
+    const emscripten::val &state(size_t pMemberIndex, size_t pIndex) const noexcept;
+#else
+    std::span<const double> state(size_t pMemberIndex, size_t pIndex) const noexcept;
+#endif
+
+    /**
+     * @brief Return the name of the state at the given index.
+     *
+     * Return the name of the state at the given index.
+     *
+     * @param pIndex The index of the state.
+     *
+     * @return The name of the state at the given index, if valid, an empty string otherwise.
+     */
+
+    const std::string &stateName(size_t pIndex) const noexcept;
+
+    /**
+     * @brief Return the unit of the state at the given index.
+     *
+     * Return the unit of the state at the given index.
+     *
+     * @param pIndex The index of the state.
+     *
+     * @return The unit of the state at the given index, if valid, an empty string otherwise.
+     */
+
+    const std::string &stateUnit(size_t pIndex) const noexcept;
+
+    /**
+     * @brief Return the number of algebraic variables.
+     *
+     * Return the number of algebraic variables.
+     *
+     * @return The number of algebraic variables.
+     */
+
+    size_t algebraicVariableCount() const noexcept;
+
+    /**
+     * @brief Return the values of the algebraic variable at the given index for the given member.
+     *
+     * Return the values of the algebraic variable at the given index for the given member.
+     *
+     * @param pMemberIndex The index of the member.
+     * @param pIndex The index of the algebraic variable.
+     *
+     * @return The values of the algebraic variable at the given index for the given member, if valid, an empty vector
+     * otherwise.
+     */
+
+#ifdef __EMSCRIPTEN__
+    const emscripten::val &algebraicVariable(size_t pMemberIndex, size_t pIndex) const noexcept;
+#else
+    std::span<const double> algebraicVariable(size_t pMemberIndex, size_t pIndex) const noexcept;
+#endif
+
+    /**
+     * @brief Return the name of the algebraic variable at the given index.
+     *
+     * Return the name of the algebraic variable at the given index.
+     *
+     * @param pIndex The index of the algebraic variable.
+     *
+     * @return The name of the algebraic variable at the given index, if valid, an empty string otherwise.
+     */
+
+    const std::string &algebraicVariableName(size_t pIndex) const noexcept;
+
+    /**
+     * @brief Return the unit of the algebraic variable at the given index.
+     *
+     * Return the unit of the algebraic variable at the given index.
+     *
+     * @param pIndex The index of the algebraic variable.
+     *
+     * @return The unit of the algebraic variable at the given index, if valid, an empty string otherwise.
+     */
+
+    const std::string &algebraicVariableUnit(size_t pIndex) const noexcept;
+
+private:
+    class Impl; /**< Forward declaration of the implementation class, @private. */
+
+    explicit SedEnsemble(const SedDocumentPtr &pDocument, const Strings &pParameterNames,
+                         const Doubles &pParameterValues); /**< Constructor @private. */
+
+    Impl *pimpl(); /**< Private implementation pointer, @private. */
+    const Impl *pimpl() const; /**< Constant private implementation pointer, @private. */
+};
+
+} // namespace libOpenCOR
@@ -76,6 +76,22 @@ public:
 
     double run();
 
+    /**
+     * @brief Continue running all the tasks associated with this instance.
+     *
+     * Continue running all the tasks associated with this instance from their current state up to the given end time,
+     * without reinitialising them (e.g., to apply an intervention after pacing a model to steady state). The results of
+     * a task are replaced with those of its continued simulation, which start at its current time and consist of the
+     * given number of steps. Only a differential model simulated using a uniform time course can be continued.
+     *
+     * @param pEndTime The end time of the continued simulation.
+     * @param pNumberOfSteps The number of steps of the continued simulation.
+     *
+     * @return The elapsed time in milliseconds.
+     */
+
+    double continueRun(double pEndTime, int pNumberOfSteps);
+
     /**
      * @brief Start running, in a background thread, all the tasks associated with this instance.
      *
@@ -130,6 +146,34 @@ public:
 
     double progress() const noexcept;
 
+    /**
+     * @brief Return a checkpoint of this instance.
+     *
+     * Return a checkpoint of this instance, i.e. the checkpoints of all the tasks associated with this instance.
+     *
+     * @return The checkpoint of this instance, as an @ref UnsignedChars, if it could be taken, an empty vector
+     * otherwise.
+     *
+     * @sa SedInstanceTask::checkpoint()
+     */
+
+    UnsignedChars checkpoint() const;
+
+    /**
+     * @brief Restore this instance from the given checkpoint.
+     *
+     * Restore this instance from the given checkpoint, i.e. restore all the tasks associated with this instance from
+     * their checkpoint. The next time this instance is run, its tasks resume from their checkpoint.
+     *
+     * @param pCheckpoint The checkpoint, as an @ref UnsignedChars.
+     *
+     * @return @c true if this instance was restored, @c false otherwise.
+     *
+     * @sa SedInstanceTask::restore()
+     */
+
+    bool restore(const UnsignedChars &pCheckpoint);
+
     /**
      * @brief Return whether there are some tasks.
      *
@@ -33,6 +33,7 @@ class LIBOPENCOR_EXPORT SedInstanceTask: public Logger
     , public std::enable_shared_from_this<SedInstanceTask>
 {
     friend class SedChangeAttribute;
+    friend class SedEnsemble;
     friend class SedInstance;
 
 public:
@@ -48,6 +49,47 @@ public:
     SedInstanceTask &operator=(const SedInstanceTask &pRhs) = delete; /**< No copy assignment operator allowed, @private. */
     SedInstanceTask &operator=(SedInstanceTask &&pRhs) noexcept = delete; /**< No move assignment operator allowed, @private. */
 
+    /**
+     * @brief The phases of a task.
+     *
+     * The phases of a task, which can be timed. The parsing, analysis, code generation, compilation, and JIT linking
+     * phases are those of the model of the task, while the other phases are those of the last run of the task. The
+     * NLA solving phase overlaps with the phase during which the NLA systems of the model were solved.
+     */
+
+    enum class Phase
+    {
+        PARSING, /**< The parsing of the model. */
+        ANALYSIS, /**< The analysis of the model, including the resolution of its imports and its flattening. */
+        CODE_GENERATION, /**< The generation of the code of the model. */
+        COMPILATION, /**< The compilation of the code of the model. */
+        JIT_LINKING, /**< The emission and linking of the compiled code of the model. */
+        INITIALISATION, /**< The initialisation of the model. */
+        ODE_SOLVING, /**< The solving of the ODE system of the model, including its RHS and Jacobian evaluations. */
+        NLA_SOLVING, /**< The solving of the NLA systems of the model. */
+        VARIABLE_COMPUTATION, /**< The computation of the variables of the model. */
+        RESULT_RECORDING /**< The recording of the results of the model. */
+    };
+
+    /**
+     * @brief The statistics of a task.
+     *
+     * The statistics of the last run of a task. The ODE statistics are only available when using CVODE and the NLA
+     * iteration count when using KINSOL.
+     */
+
+    enum class Statistic
+    {
+        ODE_STEP_COUNT, /**< The number of steps taken by the ODE solver. */
+        RHS_EVALUATION_COUNT, /**< The number of RHS evaluations made by the ODE solver. */
+        LINEAR_SOLVER_SETUP_COUNT, /**< The number of linear solver setups made by the ODE solver, some of which may reuse a previously evaluated Jacobian. */
+        JACOBIAN_EVALUATION_COUNT, /**< The number of Jacobian evaluations made by the ODE solver, none being made by a diagonal or matrix-free linear solver. */
+        ERROR_TEST_FAILURE_COUNT, /**< The number of local error test failures of the ODE solver. */
+        NLA_SOLVE_COUNT, /**< The number of times that the NLA systems were solved. */
+        NLA_ITERATION_COUNT, /**< The number of nonlinear iterations made by the NLA solver. */
+        RESULT_BYTE_COUNT /**< The number of bytes used by the results. */
+    };
+
     /**
      * @brief Return the progress of this task.
      *
@@ -344,6 +386,274 @@ public:
 
     const std::string &algebraicVariableUnit(size_t pIndex) const noexcept;
 
+    /**
+     * @brief Return the number of sensitivity parameters.
+     *
+     * Return the number of sensitivity parameters, i.e. the number of constants with respect to which the sensitivity
+     * of the states was computed.
+     *
+     * @return The number of sensitivity parameters.
+     */
+
+    size_t sensitivityParameterCount() const noexcept;
+
+    /**
+     * @brief Return the name of the sensitivity parameter at the given index.
+     *
+     * Return the name of the sensitivity parameter at the given index.
+     *
+     * @param pParameterIndex The index of the sensitivity parameter.
+     *
+     * @return The name of the sensitivity parameter, as a @c std::string, if the index is valid, an empty string
+     * otherwise.
+     */
+
+    const std::string &sensitivityParameterName(size_t pParameterIndex) const noexcept;
+
+    /**
+     * @brief Return the values of the sensitivity of the given state with respect to the given sensitivity parameter.
+     *
+     * Return the values of the sensitivity of the given state with respect to the given sensitivity parameter.
+     *
+     * @param pStateIndex The index of the state.
+     * @param pParameterIndex The index of the sensitivity parameter.
+     *
+     * @return The values of the sensitivity, as a @c Doubles, if the indices are valid, an empty vector otherwise.
+     */
+
+#ifdef __EMSCRIPTEN__
+    const emscripten::val &sensitivity(size_t pStateIndex, size_t pParameterIndex) const noexcept;
+#else
+    std::span<const double> sensitivity(size_t pStateIndex, size_t pParameterIndex) const noexcept;
+#endif
+
+    /**
+     * @brief Set the initial value of the state at the given index.
+     *
+     * Set the initial value of the state at the given index, overriding its value from the model and from any change
+     * to the model. The new initial value is used the next time the task is run. Since the model is not fully
+     * reinitialised when only some initial values and/or constants are set, this is a cheap way to run the same task
+     * many times with different values (e.g., when optimising some parameters).
+     *
+     * @param pIndex The index of the state.
+     * @param pValue The initial value of the state.
+     *
+     * @return @c true if the initial value of the state was set, @c false otherwise.
+     */
+
+    bool setInitialState(size_t pIndex, double pValue);
+
+    /**
+     * @brief Set the value of the constant at the given index.
+     *
+     * Set the value of the constant at the given index, overriding its value from the model and from any change to the
+     * model. The new value is used the next time the task is run.
+     *
+     * @param pIndex The index of the constant.
+     * @param pValue The value of the constant.
+     *
+     * @return @c true if the value of the constant was set, @c false otherwise.
+     *
+     * @sa setInitialState()
+     */
+
+    bool setConstant(size_t pIndex, double pValue);
+
+    /**
+     * @brief Reset the initial values of the states and the values of the constants.
+     *
+     * Reset the initial values of the states and the values of the constants, so that their value from the model and
+     * from any change to the model is used the next time the task is run.
+     *
+     * @return @c true if some initial values and/or constants were reset, @c false otherwise.
+     */
+
+    bool resetInitialStatesAndConstants();
+
+    /**
+     * @brief Add some objective data for the given state.
+     *
+     * Add some objective data for the given state, i.e. the values that the state should ideally have at each output
+     * point. A @c NaN value means that there is no data for the corresponding output point. When some objective data
+     * is available, running the task also computes the sum of the squared errors between the states and their
+     * objective data, as well as the gradient of that objective with respect to all the constants. The gradient is
+     * computed using the adjoint sensitivity analysis of CVODE, so only CVODE can be used in that case. The Jacobians
+     * needed by the adjoint sensitivity analysis are estimated using finite differences, so each step of the backward
+     * integration costs in the order of N+P evaluations of the model, where N and P are its number of states and
+     * constants, respectively.
+     *
+     * @param pStateIndex The index of the state.
+     * @param pValues The objective data, which must have one value per output point.
+     *
+     * @return @c true if the objective data was added, @c false otherwise.
+     */
+
+    bool addObjectiveData(size_t pStateIndex, const Doubles &pValues);
+
+    /**
+     * @brief Remove all the objective data.
+     *
+     * Remove all the objective data.
+     *
+     * @return @c true if all the objective data was removed, @c false otherwise.
+     */
+
+    bool removeAllObjectiveData();
+
+    /**
+     * @brief Return the value of the objective.
+     *
+     * Return the value of the objective, i.e. the sum of the squared errors between the states and their objective
+     * data.
+     *
+     * @return The value of the objective, if it was computed, @c NaN otherwise.
+     */
+
+    double objective() const noexcept;
+
+    /**
+     * @brief Return the gradient of the objective.
+     *
+     * Return the gradient of the objective with respect to all the constants.
+     *
+     * @return The gradient of the objective, as a @c Doubles, if it was computed, an empty vector otherwise.
+     */
+
+#ifdef __EMSCRIPTEN__
+    const emscripten::val &objectiveGradient() const noexcept;
+#else
+    std::span<const double> objectiveGradient() const noexcept;
+#endif
+
+    /**
+     * @brief Return the interval, in steps, at which a checkpoint is taken while the task is running.
+     *
+     * Return the interval, in steps, at which a checkpoint is taken while the task is running.
+     *
+     * @return The interval, in steps, at which a checkpoint is taken while the task is running, or @c 0 if no
+     * checkpoint is taken while the task is running.
+     */
+
+    size_t checkpointInterval() const noexcept;
+
+    /**
+     * @brief Set the interval, in steps, at which a checkpoint is taken while the task is running.
+     *
+     * Set the interval, in steps, at which a checkpoint is taken while the task is running. A value of @c 0 means that
+     * no checkpoint is taken while the task is running.
+     *
+     * @param pCheckpointInterval The interval, in steps, at which a checkpoint is taken while the task is running.
+     *
+     * @sa checkpoint()
+     */
+
+    void setCheckpointInterval(size_t pCheckpointInterval);
+
+    /**
+     * @brief Return a checkpoint of the task.
+     *
+     * Return a checkpoint of the task, i.e. a compact binary representation of its full state (current time, values
+     * of all the model variables, results so far, position within its simulation, and internal state of its ODE
+     * solver). While the task is running, the checkpoint is the one that was last taken at the interval set using
+     * setCheckpointInterval(), if any. Only the checkpoint of a differential model simulated using a uniform time
+     * course can be taken.
+     *
+     * @return The checkpoint of the task, as an @ref UnsignedChars, if it could be taken, an empty vector otherwise.
+     */
+
+    UnsignedChars checkpoint() const;
+
+    /**
+     * @brief Restore the task from the given checkpoint.
+     *
+     * Restore the task from the given checkpoint, which must have been taken from a task for the same model and
+     * simulation. The next time the task is run, its simulation resumes from the checkpoint rather than from its
+     * initial state, although without computing the gradient of an objective. A task that computes some sensitivities
+     * cannot be restored. With a fixed-step ODE solver, the resumed simulation gives exactly the same results as an
+     * uninterrupted one. With CVODE, it only gives the same results to within the solver's tolerances, since CVODE
+     * restarts at order 1 (its history cannot be restored).
+     *
+     * @param pCheckpoint The checkpoint, as an @ref UnsignedChars.
+     *
+     * @return @c true if the task was restored, @c false otherwise.
+     */
+
+    bool restore(const UnsignedChars &pCheckpoint);
+
+    /**
+     * @brief Return whether the task is instrumented.
+     *
+     * Return whether the task is instrumented.
+     *
+     * @return @c true if the task is instrumented, @c false otherwise.
+     */
+
+    bool instrumented() const noexcept;
+
+    /**
+     * @brief Set whether the task is instrumented.
+     *
+     * Set whether the task is instrumented, i.e. whether the time spent in each of its phases and the statistics of its
+     * solvers are tracked when it is run. Instrumentation is cheap, but it is off by default.
+     *
+     * @param pInstrumented Whether the task is instrumented.
+     *
+     * @sa phaseTime()
+     * @sa statistic()
+     */
+
+    void setInstrumented(bool pInstrumented);
+
+    /**
+     * @brief Return the time spent in the given phase.
+     *
+     * Return the time spent in the given phase. The time spent in a phase of the last run of the task is only tracked
+     * if the task is instrumented. The time spent in a phase of the model is that of the creation of the model, which
+     * may be shared with other tasks.
+     *
+     * @param pPhase The phase.
+     *
+     * @return The time spent in the given phase, in milliseconds.
+     */
+
+    double phaseTime(Phase pPhase) const noexcept;
+
+    /**
+     * @brief Return the value of the given statistic.
+     *
+     * Return the value of the given statistic for the last run of the task. Statistics are only tracked if the task is
+     * instrumented.
+     *
+     * @param pStatistic The statistic.
+     *
+     * @return The value of the given statistic.
+     */
+
+    size_t statistic(Statistic pStatistic) const noexcept;
+
+    /**
+     * @brief Return the number of NLA systems that were solved.
+     *
+     * Return the number of NLA systems that were solved during the last run of the task, if it is instrumented.
+     *
+     * @return The number of NLA systems that were solved.
+     */
+
+    size_t nlaSystemCount() const noexcept;
+
+    /**
+     * @brief Return the number of times that the given NLA system was solved.
+     *
+     * Return the number of times that the given NLA system was solved during the last run of the task, if it is
+     * instrumented. NLA systems are indexed in the order in which they were first solved.
+     *
+     * @param pIndex The index of the NLA system.
+     *
+     * @return The number of times that the given NLA system was solved, if the index is valid, @c 0 otherwise.
+     */
+
+    size_t nlaSystemSolveCount(size_t pIndex) const noexcept;
+
 private:
     class Impl; /**< Forward declaration of the implementation class, @private. */
 
@@ -24,7 +24,9 @@ namespace libOpenCOR {
  * @brief The SedSteadyState class.
  *
  * The SedSteadyState class is used to describe a steady state simulation in the context of a simulation experiment
- * description.
+ * description. For an ODE/DAE model, the steady state is computed by solving rates = 0 using KINSOL and, should that
+ * fail, by integrating the model in time, using the ODE solver of the simulation, over longer and longer intervals of
+ * time, trying KINSOL again after each of them, until the rates vanish.
  */
 
 class LIBOPENCOR_EXPORT SedSteadyState: public SedSimulation
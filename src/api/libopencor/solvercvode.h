@@ -28,6 +28,8 @@ namespace libOpenCOR {
 
 class LIBOPENCOR_EXPORT SolverCvode: public SolverOde
 {
+    friend class SedInstanceTask;
+
 public:
     /**
      * @brief The integration method.
@@ -81,6 +83,18 @@ public:
         BANDED /**< A banded preconditioner. */
     };
 
+    /**
+     * @brief The sensitivity method.
+     *
+     * The sensitivity method, i.e. simultaneous or staggered.
+     */
+
+    enum class SensitivityMethod
+    {
+        SIMULTANEOUS, /**< A simultaneous sensitivity method. */
+        STAGGERED /**< A staggered sensitivity method. */
+    };
+
     /**
      * Constructors, destructor, and assignment operators.
      */
@@ -327,6 +341,103 @@ public:
 
     void setInterpolateSolution(bool pInterpolateSolution);
 
+    /**
+     * @brief Return the number of threads used by the vector operations.
+     *
+     * Return the number of threads used by the vector operations.
+     *
+     * @return The number of threads used by the vector operations.
+     */
+
+    int threadCount() const noexcept;
+
+    /**
+     * @brief Set the number of threads used by the vector operations.
+     *
+     * Set the number of threads used by the vector operations. More than one thread only pays off for large models,
+     * i.e. models with tens of thousands of states, and it only has an effect if libOpenCOR was built with threaded
+     * vectors.
+     *
+     * @param pThreadCount The number of threads used by the vector operations.
+     */
+
+    void setThreadCount(int pThreadCount);
+
+    /**
+     * @brief Return the sensitivity method.
+     *
+     * Return the sensitivity method.
+     *
+     * @return The sensitivity method.
+     */
+
+    SensitivityMethod sensitivityMethod() const noexcept;
+
+    /**
+     * @brief Set the sensitivity method.
+     *
+     * Set the sensitivity method.
+     *
+     * @param pSensitivityMethod The sensitivity method.
+     */
+
+    void setSensitivityMethod(SensitivityMethod pSensitivityMethod);
+
+    /**
+     * @brief Return whether there are some sensitivity parameters.
+     *
+     * Return whether there are some sensitivity parameters.
+     *
+     * @return @c true if there are some sensitivity parameters, @c false otherwise.
+     */
+
+    bool hasSensitivityParameters() const noexcept;
+
+    /**
+     * @brief Return the number of sensitivity parameters.
+     *
+     * Return the number of sensitivity parameters.
+     *
+     * @return The number of sensitivity parameters.
+     */
+
+    size_t sensitivityParameterCount() const noexcept;
+
+    /**
+     * @brief Return the sensitivity parameter at the given index.
+     *
+     * Return the sensitivity parameter, i.e. the index of a model constant, at the given index.
+     *
+     * @param pIndex The index of the sensitivity parameter.
+     *
+     * @return The sensitivity parameter, if the index is valid, @c SIZE_MAX otherwise.
+     */
+
+    size_t sensitivityParameter(size_t pIndex) const noexcept;
+
+    /**
+     * @brief Add a sensitivity parameter.
+     *
+     * Add the model constant at the given index as a sensitivity parameter, i.e. the sensitivity of the states with
+     * respect to that constant will be computed alongside the states themselves.
+     *
+     * @param pConstantIndex The index of the model constant.
+     *
+     * @return @c true if the sensitivity parameter was added, @c false otherwise.
+     */
+
+    bool addSensitivityParameter(size_t pConstantIndex);
+
+    /**
+     * @brief Remove all the sensitivity parameters.
+     *
+     * Remove all the sensitivity parameters.
+     *
+     * @return @c true if all the sensitivity parameters were removed, @c false otherwise.
+     */
+
+    bool removeAllSensitivityParameters();
+
 private:
     class Impl; /**< Forward declaration of the implementation class, @private. */
 
@@ -150,6 +150,28 @@ public:
 
     void setLowerHalfBandwidth(int pLowerHalfBandwidth);
 
+    /**
+     * @brief Return the number of threads used by the vector operations.
+     *
+     * Return the number of threads used by the vector operations.
+     *
+     * @return The number of threads used by the vector operations.
+     */
+
+    int threadCount() const noexcept;
+
+    /**
+     * @brief Set the number of threads used by the vector operations.
+     *
+     * Set the number of threads used by the vector operations. More than one thread only pays off for large models,
+     * i.e. models with tens of thousands of unknowns, and it only has an effect if libOpenCOR was built with threaded
+     * vectors.
+     *
+     * @param pThreadCount The number of threads used by the vector operations.
+     */
+
+    void setThreadCount(int pThreadCount);
+
 private:
     class Impl; /**< Forward declaration of the implementation class, @private. */
 
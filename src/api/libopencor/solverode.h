@@ -30,6 +30,7 @@ namespace libOpenCOR {
 
 class LIBOPENCOR_EXPORT SolverOde: public Solver
 {
+    friend class SedEnsemble;
     friend class SedInstanceTask;
     friend class SedmlFile;
     friend class SedSimulation;
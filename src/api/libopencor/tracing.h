@@ -0,0 +1,63 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libopencor/export.h"
+
+#include <string>
+
+/**
+ * Some functions to trace where the wall-clock time of libOpenCOR goes, across threads.
+ */
+
+namespace libOpenCOR {
+
+/**
+ * Return whether tracing is enabled. Tracing is disabled by default.
+ *
+ * @return @c true if tracing is enabled, @c false otherwise.
+ */
+
+bool LIBOPENCOR_EXPORT tracingEnabled() noexcept;
+
+/**
+ * Set whether tracing is enabled. When enabled, libOpenCOR records, for each thread, an event for each of its traced
+ * operations (e.g., the creation of a file, the analysis of a CellML file, the generation and compilation of its code,
+ * the initialisation and running of an instance task, the waiting for a lock, and the calls to the ODE and NLA
+ * solvers).
+ *
+ * @param pEnabled Whether tracing is to be enabled.
+ */
+
+void LIBOPENCOR_EXPORT setTracingEnabled(bool pEnabled) noexcept;
+
+/**
+ * Clear all the events that have been recorded so far.
+ */
+
+void LIBOPENCOR_EXPORT clearTrace();
+
+/**
+ * Return all the events that have been recorded so far, in the Chrome trace event format. The resulting JSON document
+ * can be opened in Perfetto (https://ui.perfetto.dev/) or in chrome://tracing.
+ *
+ * @return A string that contains the recorded events in the Chrome trace event format.
+ */
+
+std::string LIBOPENCOR_EXPORT traceJson();
+
+} // namespace libOpenCOR
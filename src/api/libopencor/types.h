@@ -57,6 +57,9 @@ using SedDataGeneratorPtr = std::shared_ptr<SedDataGenerator>; /**< Type definit
 class SedDocument;
 using SedDocumentPtr = std::shared_ptr<SedDocument>; /**< Type definition for the shared @ref SedDocument pointer. */
 
+class SedEnsemble;
+using SedEnsemblePtr = std::shared_ptr<SedEnsemble>; /**< Type definition for the shared @ref SedEnsemble pointer. */
+
 class SedInstance;
 using SedInstancePtr = std::shared_ptr<SedInstance>; /**< Type definition for the shared @ref SedInstance pointer. */
 
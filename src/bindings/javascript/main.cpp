@@ -20,6 +20,7 @@ void fileApi();
 void loggerApi();
 void sedApi();
 void solverApi();
+void tracingApi();
 void versionApi();
 
 EMSCRIPTEN_BINDINGS(libOpenCOR)
@@ -47,6 +48,7 @@ EMSCRIPTEN_BINDINGS(libOpenCOR)
     fileApi();
     sedApi();
     solverApi();
+    tracingApi();
     versionApi();
 
     // Make all registered vectors behave like native JavaScript arrays: expose a .length property and [Symbol.iterator]
@@ -16,6 +16,45 @@ limitations under the License.
 
 #include <libopencor>
 
+namespace {
+
+emscripten::val checkpointToUint8Array(const libOpenCOR::UnsignedChars &pCheckpoint)
+{
+    if (pCheckpoint.empty()) {
+        return emscripten::val::global("Uint8Array").new_(0);
+    }
+
+    // Note: see the note in the File::contents() binding.
+
+    return emscripten::val::take_ownership(static_cast<emscripten::EM_VAL>(EM_ASM_PTR({
+        let jsArray = new Uint8Array(HEAPU8.subarray($0, $0 + $1));
+
+        return Emval.toHandle(jsArray);
+    }, pCheckpoint.data(), pCheckpoint.size())));
+}
+
+libOpenCOR::UnsignedChars uint8ArrayToCheckpoint(const emscripten::val &pCheckpoint)
+{
+    if (pCheckpoint.isNull() || pCheckpoint.isUndefined()) {
+        return {};
+    }
+
+    // Note: see the note in the File::setContents() binding.
+
+    auto length = pCheckpoint["length"].as<size_t>();
+    libOpenCOR::UnsignedChars res(length);
+
+    if (length > 0) {
+        EM_ASM({
+            HEAPU8.set(Emval.toValue($0).subarray(0, $2), $1);
+        }, pCheckpoint.as_handle(), res.data(), length);
+    }
+
+    return res;
+}
+
+} // namespace
+
 void sedApi()
 {
     // SedBase API.
@@ -82,7 +121,53 @@ void sedApi()
         .function("addTask", &libOpenCOR::SedDocument::addTask)
         .function("removeTask", &libOpenCOR::SedDocument::removeTask)
         .function("removeAllTasks", &libOpenCOR::SedDocument::removeAllTasks)
-        .function("instantiate", &libOpenCOR::SedDocument::instantiate);
+        .function("instantiate", &libOpenCOR::SedDocument::instantiate)
+        // clang-format off
+        .function("instantiateEnsemble", emscripten::optional_override([](const libOpenCOR::SedDocumentPtr &pThis, emscripten::val pParameterNames, emscripten::val pParameterValues) {
+            auto parameterNameCount = pParameterNames["length"].as<size_t>();
+            libOpenCOR::Strings parameterNames;
+
+            parameterNames.reserve(parameterNameCount);
+
+            for (size_t i = 0; i < parameterNameCount; ++i) {
+                parameterNames.push_back(pParameterNames[i].as<std::string>());
+            }
+
+            // Note: avoid using emscripten::vecFromJSArray() since it internally uses typed_memory_view (see the note
+            //       in the File::contents() binding).
+
+            auto parameterValueCount = pParameterValues["length"].as<size_t>();
+            libOpenCOR::Doubles parameterValues(parameterValueCount);
+
+            if (parameterValueCount > 0) {
+                EM_ASM({
+                    HEAPF64.set(Emval.toValue($0), $1 >> 3);
+                }, pParameterValues.as_handle(), parameterValues.data());
+            }
+
+            return pThis->instantiateEnsemble(parameterNames, parameterValues);
+        })); // clang-format on
+
+    // SedEnsemble API.
+
+    emscripten::class_<libOpenCOR::SedEnsemble, emscripten::base<libOpenCOR::Logger>>("SedEnsemble")
+        .smart_ptr<libOpenCOR::SedEnsemblePtr>("SedEnsemble")
+        .property("memberCount", &libOpenCOR::SedEnsemble::memberCount)
+        .property("parameterCount", &libOpenCOR::SedEnsemble::parameterCount)
+        .function("parameterName", &libOpenCOR::SedEnsemble::parameterName)
+        .property("threadCount", &libOpenCOR::SedEnsemble::threadCount, &libOpenCOR::SedEnsemble::setThreadCount)
+        .function("run", &libOpenCOR::SedEnsemble::run)
+        .property("voi", &libOpenCOR::SedEnsemble::voi)
+        .property("voiName", &libOpenCOR::SedEnsemble::voiName)
+        .property("voiUnit", &libOpenCOR::SedEnsemble::voiUnit)
+        .property("stateCount", &libOpenCOR::SedEnsemble::stateCount)
+        .function("state", &libOpenCOR::SedEnsemble::state)
+        .function("stateName", &libOpenCOR::SedEnsemble::stateName)
+        .function("stateUnit", &libOpenCOR::SedEnsemble::stateUnit)
+        .property("algebraicVariableCount", &libOpenCOR::SedEnsemble::algebraicVariableCount)
+        .function("algebraicVariable", &libOpenCOR::SedEnsemble::algebraicVariable)
+        .function("algebraicVariableName", &libOpenCOR::SedEnsemble::algebraicVariableName)
+        .function("algebraicVariableUnit", &libOpenCOR::SedEnsemble::algebraicVariableUnit);
 
     // SedInstance API.
 
@@ -95,12 +180,20 @@ void sedApi()
         .smart_ptr<libOpenCOR::SedInstancePtr>("SedInstance")
         .property("status", &libOpenCOR::SedInstance::status)
         .function("run", &libOpenCOR::SedInstance::run)
+        .function("continueRun", &libOpenCOR::SedInstance::continueRun)
         .function("startRun", &libOpenCOR::SedInstance::startRun)
         .function("waitForRun", &libOpenCOR::SedInstance::waitForRun)
         .function("pauseRun", &libOpenCOR::SedInstance::pauseRun)
         .function("resumeRun", &libOpenCOR::SedInstance::resumeRun)
         .function("stopRun", &libOpenCOR::SedInstance::stopRun)
         .property("progress", &libOpenCOR::SedInstance::progress)
+        // clang-format off
+        .function("checkpoint", emscripten::optional_override([](const libOpenCOR::SedInstancePtr &pThis) {
+            return checkpointToUint8Array(pThis->checkpoint());
+        }))
+        .function("restore", emscripten::optional_override([](const libOpenCOR::SedInstancePtr &pThis, emscripten::val pCheckpoint) {
+            return pThis->restore(uint8ArrayToCheckpoint(pCheckpoint));
+        })) // clang-format on
         .property("hasTasks", &libOpenCOR::SedInstance::hasTasks)
         .property("taskCount", &libOpenCOR::SedInstance::taskCount)
         .property("tasks", &libOpenCOR::SedInstance::tasks)
@@ -116,6 +209,28 @@ void sedApi()
 
     // SedInstanceTask API.
 
+    emscripten::enum_<libOpenCOR::SedInstanceTask::Phase>("SedInstanceTask.Phase")
+        .value("PARSING", libOpenCOR::SedInstanceTask::Phase::PARSING)
+        .value("ANALYSIS", libOpenCOR::SedInstanceTask::Phase::ANALYSIS)
+        .value("CODE_GENERATION", libOpenCOR::SedInstanceTask::Phase::CODE_GENERATION)
+        .value("COMPILATION", libOpenCOR::SedInstanceTask::Phase::COMPILATION)
+        .value("JIT_LINKING", libOpenCOR::SedInstanceTask::Phase::JIT_LINKING)
+        .value("INITIALISATION", libOpenCOR::SedInstanceTask::Phase::INITIALISATION)
+        .value("ODE_SOLVING", libOpenCOR::SedInstanceTask::Phase::ODE_SOLVING)
+        .value("NLA_SOLVING", libOpenCOR::SedInstanceTask::Phase::NLA_SOLVING)
+        .value("VARIABLE_COMPUTATION", libOpenCOR::SedInstanceTask::Phase::VARIABLE_COMPUTATION)
+        .value("RESULT_RECORDING", libOpenCOR::SedInstanceTask::Phase::RESULT_RECORDING);
+
+    emscripten::enum_<libOpenCOR::SedInstanceTask::Statistic>("SedInstanceTask.Statistic")
+        .value("ODE_STEP_COUNT", libOpenCOR::SedInstanceTask::Statistic::ODE_STEP_COUNT)
+        .value("RHS_EVALUATION_COUNT", libOpenCOR::SedInstanceTask::Statistic::RHS_EVALUATION_COUNT)
+        .value("LINEAR_SOLVER_SETUP_COUNT", libOpenCOR::SedInstanceTask::Statistic::LINEAR_SOLVER_SETUP_COUNT)
+        .value("JACOBIAN_EVALUATION_COUNT", libOpenCOR::SedInstanceTask::Statistic::JACOBIAN_EVALUATION_COUNT)
+        .value("ERROR_TEST_FAILURE_COUNT", libOpenCOR::SedInstanceTask::Statistic::ERROR_TEST_FAILURE_COUNT)
+        .value("NLA_SOLVE_COUNT", libOpenCOR::SedInstanceTask::Statistic::NLA_SOLVE_COUNT)
+        .value("NLA_ITERATION_COUNT", libOpenCOR::SedInstanceTask::Statistic::NLA_ITERATION_COUNT)
+        .value("RESULT_BYTE_COUNT", libOpenCOR::SedInstanceTask::Statistic::RESULT_BYTE_COUNT);
+
     emscripten::class_<libOpenCOR::SedInstanceTask, emscripten::base<libOpenCOR::Logger>>("SedInstanceTask")
         .smart_ptr<libOpenCOR::SedInstanceTaskPtr>("SedInstanceTask")
         .property("progress", &libOpenCOR::SedInstanceTask::progress)
@@ -141,7 +256,55 @@ void sedApi()
         .property("algebraicVariableCount", &libOpenCOR::SedInstanceTask::algebraicVariableCount)
         .function("algebraicVariable", &libOpenCOR::SedInstanceTask::algebraicVariable)
         .function("algebraicVariableName", &libOpenCOR::SedInstanceTask::algebraicVariableName)
-        .function("algebraicVariableUnit", &libOpenCOR::SedInstanceTask::algebraicVariableUnit);
+        .function("algebraicVariableUnit", &libOpenCOR::SedInstanceTask::algebraicVariableUnit)
+        .property("sensitivityParameterCount", &libOpenCOR::SedInstanceTask::sensitivityParameterCount)
+        .function("sensitivityParameterName", &libOpenCOR::SedInstanceTask::sensitivityParameterName)
+        .function("sensitivity", &libOpenCOR::SedInstanceTask::sensitivity)
+        .function("setInitialState", &libOpenCOR::SedInstanceTask::setInitialState)
+        .function("setConstant", &libOpenCOR::SedInstanceTask::setConstant)
+        .function("resetInitialStatesAndConstants", &libOpenCOR::SedInstanceTask::resetInitialStatesAndConstants)
+        // clang-format off
+        .function("addObjectiveData", emscripten::optional_override([](const libOpenCOR::SedInstanceTaskPtr &pThis, size_t pStateIndex, emscripten::val pValues) {
+            // Note: avoid using emscripten::vecFromJSArray() since it internally uses typed_memory_view (see the note
+            //       in the File::contents() binding).
+
+            auto length = pValues["length"].as<size_t>();
+            libOpenCOR::Doubles values(length);
+
+            if (length > 0) {
+                EM_ASM({
+                    HEAPF64.set(Emval.toValue($0), $1 >> 3);
+                }, pValues.as_handle(), values.data());
+            }
+
+            return pThis->addObjectiveData(pStateIndex, values);
+        })) // clang-format on
+        .function("removeAllObjectiveData", &libOpenCOR::SedInstanceTask::removeAllObjectiveData)
+        .property("objective", &libOpenCOR::SedInstanceTask::objective)
+        .property("objectiveGradient", &libOpenCOR::SedInstanceTask::objectiveGradient)
+        .property("checkpointInterval", &libOpenCOR::SedInstanceTask::checkpointInterval, &libOpenCOR::SedInstanceTask::setCheckpointInterval)
+        // clang-format off
+        .function("checkpoint", emscripten::optional_override([](const libOpenCOR::SedInstanceTaskPtr &pThis) {
+            return checkpointToUint8Array(pThis->checkpoint());
+        }))
+        .function("restore", emscripten::optional_override([](const libOpenCOR::SedInstanceTaskPtr &pThis, emscripten::val pCheckpoint) {
+            return pThis->restore(uint8ArrayToCheckpoint(pCheckpoint));
+        })) // clang-format on
+        .property("instrumented", &libOpenCOR::SedInstanceTask::instrumented, &libOpenCOR::SedInstanceTask::setInstrumented)
+        .function("phaseTime", &libOpenCOR::SedInstanceTask::phaseTime)
+        .function("statistic", &libOpenCOR::SedInstanceTask::statistic)
+        .property("nlaSystemCount", &libOpenCOR::SedInstanceTask::nlaSystemCount)
+        .function("nlaSystemSolveCount", &libOpenCOR::SedInstanceTask::nlaSystemSolveCount);
+
+    EM_ASM({
+        if (Module["SedInstanceTask"]) {
+            Module["SedInstanceTask"]["Phase"] = Module["SedInstanceTask.Phase"];
+            Module["SedInstanceTask"]["Statistic"] = Module["SedInstanceTask.Statistic"];
+
+            delete Module["SedInstanceTask.Phase"];
+            delete Module["SedInstanceTask.Statistic"];
+        }
+    });
 
     // SedModel API.
 
@@ -91,6 +91,10 @@ void solverApi()
         .value("NO", libOpenCOR::SolverCvode::Preconditioner::NO)
         .value("BANDED", libOpenCOR::SolverCvode::Preconditioner::BANDED);
 
+    emscripten::enum_<libOpenCOR::SolverCvode::SensitivityMethod>("SolverCvode.SensitivityMethod")
+        .value("SIMULTANEOUS", libOpenCOR::SolverCvode::SensitivityMethod::SIMULTANEOUS)
+        .value("STAGGERED", libOpenCOR::SolverCvode::SensitivityMethod::STAGGERED);
+
     emscripten::class_<libOpenCOR::SolverCvode, emscripten::base<libOpenCOR::SolverOde>>("SolverCvode")
         .smart_ptr_constructor("SolverCvode", &libOpenCOR::SolverCvode::create)
         .property("maximumStep", &libOpenCOR::SolverCvode::maximumStep, &libOpenCOR::SolverCvode::setMaximumStep)
@@ -103,7 +107,14 @@ void solverApi()
         .property("lowerHalfBandwidth", &libOpenCOR::SolverCvode::lowerHalfBandwidth, &libOpenCOR::SolverCvode::setLowerHalfBandwidth)
         .property("relativeTolerance", &libOpenCOR::SolverCvode::relativeTolerance, &libOpenCOR::SolverCvode::setRelativeTolerance)
         .property("absoluteTolerance", &libOpenCOR::SolverCvode::absoluteTolerance, &libOpenCOR::SolverCvode::setAbsoluteTolerance)
-        .property("interpolateSolution", &libOpenCOR::SolverCvode::interpolateSolution, &libOpenCOR::SolverCvode::setInterpolateSolution);
+        .property("interpolateSolution", &libOpenCOR::SolverCvode::interpolateSolution, &libOpenCOR::SolverCvode::setInterpolateSolution)
+        .property("threadCount", &libOpenCOR::SolverCvode::threadCount, &libOpenCOR::SolverCvode::setThreadCount)
+        .property("sensitivityMethod", &libOpenCOR::SolverCvode::sensitivityMethod, &libOpenCOR::SolverCvode::setSensitivityMethod)
+        .property("hasSensitivityParameters", &libOpenCOR::SolverCvode::hasSensitivityParameters)
+        .property("sensitivityParameterCount", &libOpenCOR::SolverCvode::sensitivityParameterCount)
+        .function("sensitivityParameter", &libOpenCOR::SolverCvode::sensitivityParameter)
+        .function("addSensitivityParameter", &libOpenCOR::SolverCvode::addSensitivityParameter)
+        .function("removeAllSensitivityParameters", &libOpenCOR::SolverCvode::removeAllSensitivityParameters);
 
     EM_ASM({
         if (Module["SolverCvode"]) {
@@ -111,11 +122,13 @@ void solverApi()
             Module["SolverCvode"]["IterationType"] = Module["SolverCvode.IterationType"];
             Module["SolverCvode"]["LinearSolver"] = Module["SolverCvode.LinearSolver"];
             Module["SolverCvode"]["Preconditioner"] = Module["SolverCvode.Preconditioner"];
+            Module["SolverCvode"]["SensitivityMethod"] = Module["SolverCvode.SensitivityMethod"];
 
             delete Module["SolverCvode.IntegrationMethod"];
             delete Module["SolverCvode.IterationType"];
             delete Module["SolverCvode.LinearSolver"];
             delete Module["SolverCvode.Preconditioner"];
+            delete Module["SolverCvode.SensitivityMethod"];
         }
     });
 
@@ -148,7 +161,8 @@ void solverApi()
         .property("maximumNumberOfIterations", &libOpenCOR::SolverKinsol::maximumNumberOfIterations, &libOpenCOR::SolverKinsol::setMaximumNumberOfIterations)
         .property("linearSolver", &libOpenCOR::SolverKinsol::linearSolver, &libOpenCOR::SolverKinsol::setLinearSolver)
         .property("upperHalfBandwidth", &libOpenCOR::SolverKinsol::upperHalfBandwidth, &libOpenCOR::SolverKinsol::setUpperHalfBandwidth)
-        .property("lowerHalfBandwidth", &libOpenCOR::SolverKinsol::lowerHalfBandwidth, &libOpenCOR::SolverKinsol::setLowerHalfBandwidth);
+        .property("lowerHalfBandwidth", &libOpenCOR::SolverKinsol::lowerHalfBandwidth, &libOpenCOR::SolverKinsol::setLowerHalfBandwidth)
+        .property("threadCount", &libOpenCOR::SolverKinsol::threadCount, &libOpenCOR::SolverKinsol::setThreadCount);
 
     EM_ASM({
         if (Module["SolverKinsol"]) {
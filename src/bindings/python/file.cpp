@@ -66,6 +66,9 @@ void fileApi(nb::module_ &m)
         .def_prop_ro("files", &libOpenCOR::FileManager::files, "Return the managed files.")
         .def("file", nb::overload_cast<size_t>(&libOpenCOR::FileManager::file, nb::const_), "Return the managed file at the given index.", nb::arg("index"))
         .def("file", nb::overload_cast<const std::string &>(&libOpenCOR::FileManager::file, nb::const_), "Return the managed file with the given name or URL.", nb::arg("file_name_or_url"))
+        .def_prop_rw("cache_directory", &libOpenCOR::FileManager::cacheDirectory, &libOpenCOR::FileManager::setCacheDirectory, "The directory of the download cache.")
+        .def_prop_rw("cache_size_limit", &libOpenCOR::FileManager::cacheSizeLimit, &libOpenCOR::FileManager::setCacheSizeLimit, "The size limit of the download cache.")
+        .def_prop_rw("offline", &libOpenCOR::FileManager::offline, &libOpenCOR::FileManager::setOffline, "Whether we are offline.")
         .def("__len__", &libOpenCOR::FileManager::fileCount)
         .def("__iter__", [](const libOpenCOR::FileManager &self) {
             return nb::iter(nb::cast(self.files()));
@@ -30,6 +30,7 @@ from .module import (
     SedDataDescription,
     SedDataGenerator,
     SedDocument,
+    SedEnsemble,
     SedInstance,
     SedInstanceTask,
     SedModel,
@@ -50,6 +51,11 @@ from .module import (
     SolverHeun,
     SolverKinsol,
     SolverSecondOrderRungeKutta,
+    # Tracing API.
+    tracing_enabled,
+    set_tracing_enabled,
+    clear_trace,
+    trace_json,
     # Version API.
     version,
     version_string,
@@ -86,6 +92,7 @@ __all__ = (
     "SedDataDescription",
     "SedDataGenerator",
     "SedDocument",
+    "SedEnsemble",
     "SedInstance",
     "SedInstanceTask",
     "SedModel",
@@ -106,6 +113,11 @@ __all__ = (
     "SolverHeun",
     "SolverKinsol",
     "SolverSecondOrderRungeKutta",
+    # Tracing API.
+    "tracing_enabled",
+    "set_tracing_enabled",
+    "clear_trace",
+    "trace_json",
     # Version API.
     "version",
     "version_string",
@@ -27,6 +27,7 @@ void fileApi(nb::module_ &m);
 void loggerApi(nb::module_ &m);
 void sedApi(nb::module_ &m);
 void solverApi(nb::module_ &m);
+void tracingApi(nb::module_ &m);
 void versionApi(nb::module_ &m);
 
 NB_MODULE(module, m)
@@ -46,5 +47,6 @@ NB_MODULE(module, m)
     fileApi(m);
     sedApi(m);
     solverApi(m);
+    tracingApi(m);
     versionApi(m);
 }
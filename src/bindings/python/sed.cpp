@@ -90,7 +90,47 @@ void sedApi(nb::module_ &m)
         .def("add_task", &libOpenCOR::SedDocument::addTask, "Add the given task.", nb::arg("task").none())
         .def("remove_task", &libOpenCOR::SedDocument::removeTask, "Remove the given task.", nb::arg("task").none())
         .def("remove_all_tasks", &libOpenCOR::SedDocument::removeAllTasks, "Remove all the tasks.")
-        .def("instantiate", &libOpenCOR::SedDocument::instantiate, "Instantiate this simulation experiment description.");
+        .def("instantiate", &libOpenCOR::SedDocument::instantiate, "Instantiate this simulation experiment description.")
+        .def("instantiate_ensemble", &libOpenCOR::SedDocument::instantiateEnsemble, "Instantiate an ensemble of this simulation experiment description.", nb::arg("parameter_names"), nb::arg("parameter_values"));
+
+    // SedEnsemble API.
+
+    nb::class_<libOpenCOR::SedEnsemble, libOpenCOR::Logger> sedEnsemble(m, "SedEnsemble");
+
+    sedEnsemble.def_prop_ro("member_count", &libOpenCOR::SedEnsemble::memberCount, "Return the number of members.")
+        .def_prop_ro("parameter_count", &libOpenCOR::SedEnsemble::parameterCount, "Return the number of parameters.")
+        .def("parameter_name", &libOpenCOR::SedEnsemble::parameterName, "Return the name of the parameter at the given index.", nb::arg("index"))
+        .def_prop_rw("thread_count", &libOpenCOR::SedEnsemble::threadCount, &libOpenCOR::SedEnsemble::setThreadCount, "The number of threads used to run the members.")
+        .def("run", &libOpenCOR::SedEnsemble::run, "Run all the members of this ensemble.", nb::call_guard<nb::gil_scoped_release>())
+        .def_prop_ro("voi", [](const libOpenCOR::SedEnsemble &self) {
+            const auto &data = self.voi();
+            size_t shape[1] = {data.size()};
+
+            return nb::ndarray<nb::numpy, const double>(data.data(), 1, shape, nb::cast(self, nb::rv_policy::reference));
+        },
+                     "Return the values of the variable of integration as a zero-copy NumPy array.")
+        .def_prop_ro("voi_name", &libOpenCOR::SedEnsemble::voiName, "Return the name of the variable of integration.")
+        .def_prop_ro("voi_unit", &libOpenCOR::SedEnsemble::voiUnit, "Return the unit of the variable of integration.")
+        .def_prop_ro("state_count", &libOpenCOR::SedEnsemble::stateCount, "Return the number of states.")
+        .def("state", [](const libOpenCOR::SedEnsemble &self, size_t pMemberIndex, size_t pIndex) {
+            const auto &data = self.state(pMemberIndex, pIndex);
+            size_t shape[1] = {data.size()};
+
+            return nb::ndarray<nb::numpy, const double>(data.data(), 1, shape, nb::cast(self, nb::rv_policy::reference));
+        },
+             "Return the values of the state at the given index for the given member as a zero-copy NumPy array.", nb::arg("member_index"), nb::arg("index"))
+        .def("state_name", &libOpenCOR::SedEnsemble::stateName, "Return the name of the state at the given index.", nb::arg("index"))
+        .def("state_unit", &libOpenCOR::SedEnsemble::stateUnit, "Return the unit of the state at the given index.", nb::arg("index"))
+        .def_prop_ro("algebraic_variable_count", &libOpenCOR::SedEnsemble::algebraicVariableCount, "Return the number of algebraic variables.")
+        .def("algebraic_variable", [](const libOpenCOR::SedEnsemble &self, size_t pMemberIndex, size_t pIndex) {
+            const auto &data = self.algebraicVariable(pMemberIndex, pIndex);
+            size_t shape[1] = {data.size()};
+
+            return nb::ndarray<nb::numpy, const double>(data.data(), 1, shape, nb::cast(self, nb::rv_policy::reference));
+        },
+             "Return the values of the algebraic variable at the given index for the given member as a zero-copy NumPy array.", nb::arg("member_index"), nb::arg("index"))
+        .def("algebraic_variable_name", &libOpenCOR::SedEnsemble::algebraicVariableName, "Return the name of the algebraic variable at the given index.", nb::arg("index"))
+        .def("algebraic_variable_unit", &libOpenCOR::SedEnsemble::algebraicVariableUnit, "Return the unit of the algebraic variable at the given index.", nb::arg("index"));
 
     // SedInstance API.
 
@@ -103,12 +143,15 @@ void sedApi(nb::module_ &m)
 
     sedInstance.def_prop_ro("status", &libOpenCOR::SedInstance::status, "Return the status of this instance.")
         .def("run", &libOpenCOR::SedInstance::run, "Run all the tasks associated with this instance.", nb::call_guard<nb::gil_scoped_release>())
+        .def("continue_run", &libOpenCOR::SedInstance::continueRun, "Continue running all the tasks associated with this instance.", nb::arg("end_time"), nb::arg("number_of_steps"), nb::call_guard<nb::gil_scoped_release>())
         .def("start_run", &libOpenCOR::SedInstance::startRun, "Start running, in a background thread, all the tasks associated with this instance.")
         .def("wait_for_run", &libOpenCOR::SedInstance::waitForRun, "Wait for any currently-running instance to complete.", nb::call_guard<nb::gil_scoped_release>())
         .def("pause_run", &libOpenCOR::SedInstance::pauseRun, "Pause a currently-running instance.")
         .def("resume_run", &libOpenCOR::SedInstance::resumeRun, "Resume a currently-paused instance.")
         .def("stop_run", &libOpenCOR::SedInstance::stopRun, "Stop any currently-running instance.")
         .def_prop_ro("progress", &libOpenCOR::SedInstance::progress, "Return the progress of the current instance run.")
+        .def("checkpoint", &libOpenCOR::SedInstance::checkpoint, "Return a checkpoint of this instance.")
+        .def("restore", &libOpenCOR::SedInstance::restore, "Restore this instance from the given checkpoint.", nb::arg("checkpoint"))
         .def_prop_ro("has_tasks", &libOpenCOR::SedInstance::hasTasks, "Return whether there are some tasks.")
         .def_prop_ro("task_count", &libOpenCOR::SedInstance::taskCount, "Return the number of tasks.")
         .def_prop_ro("tasks", &libOpenCOR::SedInstance::tasks, "Return all the tasks.")
@@ -122,6 +165,28 @@ void sedApi(nb::module_ &m)
 
     nb::class_<libOpenCOR::SedInstanceTask, libOpenCOR::Logger> sedInstanceTask(m, "SedInstanceTask");
 
+    nb::enum_<libOpenCOR::SedInstanceTask::Phase>(sedInstanceTask, "Phase")
+        .value("Parsing", libOpenCOR::SedInstanceTask::Phase::PARSING)
+        .value("Analysis", libOpenCOR::SedInstanceTask::Phase::ANALYSIS)
+        .value("CodeGeneration", libOpenCOR::SedInstanceTask::Phase::CODE_GENERATION)
+        .value("Compilation", libOpenCOR::SedInstanceTask::Phase::COMPILATION)
+        .value("JitLinking", libOpenCOR::SedInstanceTask::Phase::JIT_LINKING)
+        .value("Initialisation", libOpenCOR::SedInstanceTask::Phase::INITIALISATION)
+        .value("OdeSolving", libOpenCOR::SedInstanceTask::Phase::ODE_SOLVING)
+        .value("NlaSolving", libOpenCOR::SedInstanceTask::Phase::NLA_SOLVING)
+        .value("VariableComputation", libOpenCOR::SedInstanceTask::Phase::VARIABLE_COMPUTATION)
+        .value("ResultRecording", libOpenCOR::SedInstanceTask::Phase::RESULT_RECORDING);
+
+    nb::enum_<libOpenCOR::SedInstanceTask::Statistic>(sedInstanceTask, "Statistic")
+        .value("OdeStepCount", libOpenCOR::SedInstanceTask::Statistic::ODE_STEP_COUNT)
+        .value("RhsEvaluationCount", libOpenCOR::SedInstanceTask::Statistic::RHS_EVALUATION_COUNT)
+        .value("LinearSolverSetupCount", libOpenCOR::SedInstanceTask::Statistic::LINEAR_SOLVER_SETUP_COUNT)
+        .value("JacobianEvaluationCount", libOpenCOR::SedInstanceTask::Statistic::JACOBIAN_EVALUATION_COUNT)
+        .value("ErrorTestFailureCount", libOpenCOR::SedInstanceTask::Statistic::ERROR_TEST_FAILURE_COUNT)
+        .value("NlaSolveCount", libOpenCOR::SedInstanceTask::Statistic::NLA_SOLVE_COUNT)
+        .value("NlaIterationCount", libOpenCOR::SedInstanceTask::Statistic::NLA_ITERATION_COUNT)
+        .value("ResultByteCount", libOpenCOR::SedInstanceTask::Statistic::RESULT_BYTE_COUNT);
+
     sedInstanceTask.def_prop_ro("progress", &libOpenCOR::SedInstanceTask::progress, "Return the progress of this task.")
         .def_prop_ro("voi", [](const libOpenCOR::SedInstanceTask &self) {
             const auto &data = self.voi();
@@ -181,7 +246,37 @@ void sedApi(nb::module_ &m)
         },
              "Return the values of the algebraic variable at the given index as a zero-copy NumPy array.", nb::arg("index"))
         .def("algebraic_variable_name", &libOpenCOR::SedInstanceTask::algebraicVariableName, "Return the name of the algebraic variable at the given index.", nb::arg("index"))
-        .def("algebraic_variable_unit", &libOpenCOR::SedInstanceTask::algebraicVariableUnit, "Return the unit of the algebraic variable at the given index.", nb::arg("index"));
+        .def("algebraic_variable_unit", &libOpenCOR::SedInstanceTask::algebraicVariableUnit, "Return the unit of the algebraic variable at the given index.", nb::arg("index"))
+        .def_prop_ro("sensitivity_parameter_count", &libOpenCOR::SedInstanceTask::sensitivityParameterCount, "Return the number of sensitivity parameters.")
+        .def("sensitivity_parameter_name", &libOpenCOR::SedInstanceTask::sensitivityParameterName, "Return the name of the sensitivity parameter at the given index.", nb::arg("parameter_index"))
+        .def("sensitivity", [](const libOpenCOR::SedInstanceTask &self, size_t pStateIndex, size_t pParameterIndex) {
+            const auto &data = self.sensitivity(pStateIndex, pParameterIndex);
+            size_t shape[1] = {data.size()};
+
+            return nb::ndarray<nb::numpy, const double>(data.data(), 1, shape, nb::cast(self, nb::rv_policy::reference));
+        },
+             "Return the values of the sensitivity of the given state with respect to the given sensitivity parameter as a zero-copy NumPy array.", nb::arg("state_index"), nb::arg("parameter_index"))
+        .def("set_initial_state", &libOpenCOR::SedInstanceTask::setInitialState, "Set the initial value of the state at the given index.", nb::arg("index"), nb::arg("value"))
+        .def("set_constant", &libOpenCOR::SedInstanceTask::setConstant, "Set the value of the constant at the given index.", nb::arg("index"), nb::arg("value"))
+        .def("reset_initial_states_and_constants", &libOpenCOR::SedInstanceTask::resetInitialStatesAndConstants, "Reset the initial values of the states and the values of the constants.")
+        .def("add_objective_data", &libOpenCOR::SedInstanceTask::addObjectiveData, "Add some objective data for the given state.", nb::arg("state_index"), nb::arg("values"))
+        .def("remove_all_objective_data", &libOpenCOR::SedInstanceTask::removeAllObjectiveData, "Remove all the objective data.")
+        .def_prop_ro("objective", &libOpenCOR::SedInstanceTask::objective, "Return the value of the objective.")
+        .def_prop_ro("objective_gradient", [](const libOpenCOR::SedInstanceTask &self) {
+            const auto &data = self.objectiveGradient();
+            size_t shape[1] = {data.size()};
+
+            return nb::ndarray<nb::numpy, const double>(data.data(), 1, shape, nb::cast(self, nb::rv_policy::reference));
+        },
+                     "Return the gradient of the objective as a zero-copy NumPy array.")
+        .def_prop_rw("checkpoint_interval", &libOpenCOR::SedInstanceTask::checkpointInterval, &libOpenCOR::SedInstanceTask::setCheckpointInterval, "The interval, in steps, at which a checkpoint is taken while the task is running.")
+        .def("checkpoint", &libOpenCOR::SedInstanceTask::checkpoint, "Return a checkpoint of the task.")
+        .def("restore", &libOpenCOR::SedInstanceTask::restore, "Restore the task from the given checkpoint.", nb::arg("checkpoint"))
+        .def_prop_rw("instrumented", &libOpenCOR::SedInstanceTask::instrumented, &libOpenCOR::SedInstanceTask::setInstrumented, "Whether the task is instrumented.")
+        .def("phase_time", &libOpenCOR::SedInstanceTask::phaseTime, "Return the time spent in the given phase.", nb::arg("phase"))
+        .def("statistic", &libOpenCOR::SedInstanceTask::statistic, "Return the value of the given statistic.", nb::arg("statistic"))
+        .def_prop_ro("nla_system_count", &libOpenCOR::SedInstanceTask::nlaSystemCount, "Return the number of NLA systems that were solved.")
+        .def("nla_system_solve_count", &libOpenCOR::SedInstanceTask::nlaSystemSolveCount, "Return the number of times that the given NLA system was solved.", nb::arg("index"));
 
     // SedModel API.
 
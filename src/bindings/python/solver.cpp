@@ -76,6 +76,10 @@ void solverApi(nb::module_ &m)
         .value("No", libOpenCOR::SolverCvode::Preconditioner::NO)
         .value("Banded", libOpenCOR::SolverCvode::Preconditioner::BANDED);
 
+    nb::enum_<libOpenCOR::SolverCvode::SensitivityMethod>(solverCvode, "SensitivityMethod")
+        .value("Simultaneous", libOpenCOR::SolverCvode::SensitivityMethod::SIMULTANEOUS)
+        .value("Staggered", libOpenCOR::SolverCvode::SensitivityMethod::STAGGERED);
+
     solverCvode.def(nb::new_(&libOpenCOR::SolverCvode::create), "Create a SolverCvode object.")
         .def_prop_rw("maximum_step", &libOpenCOR::SolverCvode::maximumStep, &libOpenCOR::SolverCvode::setMaximumStep, "The maximum step.")
         .def_prop_rw("maximum_number_of_steps", &libOpenCOR::SolverCvode::maximumNumberOfSteps, &libOpenCOR::SolverCvode::setMaximumNumberOfSteps, "The maximum number of steps.")
@@ -87,7 +91,14 @@ void solverApi(nb::module_ &m)
         .def_prop_rw("lower_half_bandwidth", &libOpenCOR::SolverCvode::lowerHalfBandwidth, &libOpenCOR::SolverCvode::setLowerHalfBandwidth, "The lower half-bandwidth.")
         .def_prop_rw("relative_tolerance", &libOpenCOR::SolverCvode::relativeTolerance, &libOpenCOR::SolverCvode::setRelativeTolerance, "The relative tolerance.")
         .def_prop_rw("absolute_tolerance", &libOpenCOR::SolverCvode::absoluteTolerance, &libOpenCOR::SolverCvode::setAbsoluteTolerance, "The absolute tolerance.")
-        .def_prop_rw("interpolate_solution", &libOpenCOR::SolverCvode::interpolateSolution, &libOpenCOR::SolverCvode::setInterpolateSolution, "Whether the solution should be interpolated.");
+        .def_prop_rw("interpolate_solution", &libOpenCOR::SolverCvode::interpolateSolution, &libOpenCOR::SolverCvode::setInterpolateSolution, "Whether the solution should be interpolated.")
+        .def_prop_rw("thread_count", &libOpenCOR::SolverCvode::threadCount, &libOpenCOR::SolverCvode::setThreadCount, "The number of threads used by the vector operations.")
+        .def_prop_rw("sensitivity_method", &libOpenCOR::SolverCvode::sensitivityMethod, &libOpenCOR::SolverCvode::setSensitivityMethod, "The sensitivity method.")
+        .def_prop_ro("has_sensitivity_parameters", &libOpenCOR::SolverCvode::hasSensitivityParameters, "Return whether there are some sensitivity parameters.")
+        .def_prop_ro("sensitivity_parameter_count", &libOpenCOR::SolverCvode::sensitivityParameterCount, "Return the number of sensitivity parameters.")
+        .def("sensitivity_parameter", &libOpenCOR::SolverCvode::sensitivityParameter, "Return the sensitivity parameter at the given index.", nb::arg("index"))
+        .def("add_sensitivity_parameter", &libOpenCOR::SolverCvode::addSensitivityParameter, "Add the model constant at the given index as a sensitivity parameter.", nb::arg("constant_index"))
+        .def("remove_all_sensitivity_parameters", &libOpenCOR::SolverCvode::removeAllSensitivityParameters, "Remove all the sensitivity parameters.");
 
     // SolverForwardEuler API.
 
@@ -122,7 +133,8 @@ void solverApi(nb::module_ &m)
         .def_prop_rw("maximum_number_of_iterations", &libOpenCOR::SolverKinsol::maximumNumberOfIterations, &libOpenCOR::SolverKinsol::setMaximumNumberOfIterations, "The maximum number of iterations.")
         .def_prop_rw("linear_solver", &libOpenCOR::SolverKinsol::linearSolver, &libOpenCOR::SolverKinsol::setLinearSolver, "The linear solver.")
         .def_prop_rw("upper_half_bandwidth", &libOpenCOR::SolverKinsol::upperHalfBandwidth, &libOpenCOR::SolverKinsol::setUpperHalfBandwidth, "The upper half-bandwidth.")
-        .def_prop_rw("lower_half_bandwidth", &libOpenCOR::SolverKinsol::lowerHalfBandwidth, &libOpenCOR::SolverKinsol::setLowerHalfBandwidth, "The lower half-bandwidth.");
+        .def_prop_rw("lower_half_bandwidth", &libOpenCOR::SolverKinsol::lowerHalfBandwidth, &libOpenCOR::SolverKinsol::setLowerHalfBandwidth, "The lower half-bandwidth.")
+        .def_prop_rw("thread_count", &libOpenCOR::SolverKinsol::threadCount, &libOpenCOR::SolverKinsol::setThreadCount, "The number of threads used by the vector operations.");
 
     // SolverSecondOrderRungeKutta API.
 
@@ -0,0 +1,31 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <libopencor>
+
+#include <nanobind/stl/string.h>
+
+namespace nb = nanobind;
+
+void tracingApi(nb::module_ &m)
+{
+    // Tracing API.
+
+    m.def("tracing_enabled", &libOpenCOR::tracingEnabled, "Return whether tracing is enabled.")
+        .def("set_tracing_enabled", &libOpenCOR::setTracingEnabled, "Set whether tracing is enabled.")
+        .def("clear_trace", &libOpenCOR::clearTrace, "Clear all the events that have been recorded so far.")
+        .def("trace_json", &libOpenCOR::traceJson, "Return all the events that have been recorded so far, in the Chrome trace event format.");
+}
@@ -17,8 +17,11 @@ limitations under the License.
 #include "file_p.h"
 #include "filemanager_p.h"
 
+#include "tracer.h"
 #include "utils.h"
 
+#include <string_view>
+
 namespace libOpenCOR {
 
 File::Impl::Impl(const std::string &pFileNameOrUrl, bool pRetrieveContents)
@@ -36,14 +39,18 @@ File::Impl::Impl(const std::string &pFileNameOrUrl, bool pRetrieveContents)
     }
 
 #ifndef __EMSCRIPTEN__
-    // Download a local copy of the remote file, if needed and requested.
+    // Download the contents of the remote file straight into memory, if needed and requested.
+    // Note: we still give the remote file a (unique) file path, even though nothing gets written to it. This is so that
+    //       the files in a remote COMBINE archive, for instance, have a unique file name.
 
     if (mFilePath.empty()) {
         if (pRetrieveContents) {
-            auto [res, filePath] {downloadFile(mUrl)};
+            auto [res, contents] {downloadFileContents(mUrl)};
 
             if (res) {
-                mFilePath = filePath;
+                mFilePath = downloadedFilePath(mUrl);
+
+                setContents(std::move(contents));
             } else {
                 mType = Type::IRRETRIEVABLE_FILE;
 
@@ -66,13 +73,138 @@ File::Impl::Impl(const std::string &pFileNameOrUrl, bool pRetrieveContents)
     mFileName = pathToString(mFilePath);
 }
 
-File::Impl::~Impl()
+File::Impl::~Impl() = default;
+
+File::Type File::Impl::sniffType()
 {
-    // Delete the local file associated with a remote file.
+    // Sniff the type of the file using only the first few KB of its contents. A COMBINE archive is a ZIP file, so it
+    // starts with the ZIP magic number. A CellML file is an XML file which root element is a model element in a CellML
+    // namespace while a SED-ML file is an XML file which root element is a sedML element in a SED-ML namespace.
+    // Note: we don't check whether the file is well formed, this is up to the parser that we will end up using. We
+    //       only return Type::UNKNOWN_FILE if we cannot tell the type of the file.
+
+    static constexpr size_t SNIFF_SIZE {4096};
+    static constexpr std::string_view ZIP_MAGIC_NUMBER {"PK\x03\x04"};
+    static constexpr std::string_view UTF8_BOM {"\xEF\xBB\xBF"};
+    static constexpr std::string_view WHITESPACES {" \t\r\n"};
+    static constexpr std::string_view CELLML_NAMESPACE {"http://www.cellml.org/cellml/"};
+    static constexpr std::string_view SEDML_NAMESPACE {"http://sed-ml.org/"};
+
+    auto fileContents {contentsView()};
+    std::string_view header {reinterpret_cast<const char *>(fileContents.data()), std::min(fileContents.size(), SNIFF_SIZE)}; // NOLINT
+
+    if (header.starts_with(ZIP_MAGIC_NUMBER)) {
+        return Type::COMBINE_ARCHIVE;
+    }
+
+    // Skip the byte order mark, if any, as well as the XML declaration, processing instructions, comments, and
+    // document type declaration that may precede the root element.
+
+    if (header.starts_with(UTF8_BOM)) {
+        header.remove_prefix(UTF8_BOM.size());
+    }
+
+    while (true) {
+        auto start {header.find_first_not_of(WHITESPACES)};
+
+        if ((start == std::string_view::npos) || (header[start] != '<')) {
+            return Type::UNKNOWN_FILE;
+        }
+
+        header.remove_prefix(start);
+
+        std::string_view terminator;
+
+        if (header.starts_with("<?")) {
+            terminator = "?>";
+        } else if (header.starts_with("<!--")) {
+            terminator = "-->";
+        } else if (header.starts_with("<!")) {
+            terminator = ">";
+        } else {
+            break;
+        }
+
+        auto end {header.find(terminator)};
+
+        if (end == std::string_view::npos) {
+            return Type::UNKNOWN_FILE;
+        }
+
+        header.remove_prefix(end + terminator.size());
+    }
+
+    // Retrieve the (qualified) name of the root element and the namespace associated with its prefix, if any.
 
-    if (!mUrl.empty() && !mFilePath.empty()) {
-        std::filesystem::remove(mFilePath);
+    auto tagEnd {header.find('>')};
+
+    if (tagEnd == std::string_view::npos) {
+        return Type::UNKNOWN_FILE;
     }
+
+    auto tag {header.substr(1, tagEnd - 1)};
+    auto nameEnd {std::min(tag.find_first_of(WHITESPACES), tag.find('/'))};
+    auto qualifiedName {tag.substr(0, nameEnd)};
+    auto colon {qualifiedName.find(':')};
+    auto name {(colon == std::string_view::npos) ? qualifiedName : qualifiedName.substr(colon + 1)};
+    auto namespaceAttribute {(colon == std::string_view::npos) ? std::string("xmlns") : "xmlns:" + std::string(qualifiedName.substr(0, colon))};
+    auto attributes {(nameEnd == std::string_view::npos) ? std::string_view {} : tag.substr(nameEnd)};
+    std::string_view namespaceUri;
+
+    while (true) {
+        auto attributeStart {attributes.find_first_not_of(WHITESPACES)};
+
+        if (attributeStart == std::string_view::npos) {
+            break;
+        }
+
+        attributes.remove_prefix(attributeStart);
+
+        auto equal {attributes.find('=')};
+
+        if (equal == std::string_view::npos) {
+            break;
+        }
+
+        auto attributeName {attributes.substr(0, std::min(equal, attributes.find_first_of(WHITESPACES)))};
+
+        attributes.remove_prefix(equal + 1);
+
+        auto valueStart {attributes.find_first_not_of(WHITESPACES)};
+
+        if ((valueStart == std::string_view::npos)
+            || ((attributes[valueStart] != '"') && (attributes[valueStart] != '\''))) {
+            break;
+        }
+
+        auto quote {attributes[valueStart]};
+
+        attributes.remove_prefix(valueStart + 1);
+
+        auto valueEnd {attributes.find(quote)};
+
+        if (valueEnd == std::string_view::npos) {
+            break;
+        }
+
+        if (attributeName == namespaceAttribute) {
+            namespaceUri = attributes.substr(0, valueEnd);
+
+            break;
+        }
+
+        attributes.remove_prefix(valueEnd + 1);
+    }
+
+    if ((name == "model") && namespaceUri.starts_with(CELLML_NAMESPACE)) {
+        return Type::CELLML_FILE;
+    }
+
+    if ((name == "sedML") && namespaceUri.starts_with(SEDML_NAMESPACE)) {
+        return Type::SEDML_FILE;
+    }
+
+    return Type::UNKNOWN_FILE;
 }
 
 void File::Impl::checkType(const FilePtr &pOwner, bool pResetType)
@@ -90,23 +222,29 @@ void File::Impl::checkType(const FilePtr &pOwner, bool pResetType)
     }
 
     // Try to get a CellML file, a SED-ML file, or a COMBINE archive, but only if we have some contents.
+    // Note: we first sniff the type of the file so that we only use the parser that can handle it. If we cannot tell
+    //       the type of the file then we try the CellML and SED-ML parsers in turn. There is no need to try to get a
+    //       COMBINE archive in that case since it would have been sniffed as such.
+
+    if (!contentsView().empty()) {
+        auto sniffedType {sniffType()};
+        auto unknownType {sniffedType == Type::UNKNOWN_FILE};
 
-    if (!contents().empty()) {
-        mCellmlFile = CellmlFile::create(pOwner);
+        mCellmlFile = (unknownType || (sniffedType == Type::CELLML_FILE)) ? CellmlFile::create(pOwner) : nullptr;
 
         if (mCellmlFile != nullptr) {
             mType = Type::CELLML_FILE;
 
             addIssues(mCellmlFile, "CellML file");
         } else {
-            mSedmlFile = SedmlFile::create(pOwner);
+            mSedmlFile = (unknownType || (sniffedType == Type::SEDML_FILE)) ? SedmlFile::create(pOwner) : nullptr;
 
             if (mSedmlFile != nullptr) {
                 mType = Type::SEDML_FILE;
 
                 addIssues(mSedmlFile, "SED-ML file");
             } else {
-                mCombineArchive = CombineArchive::create(pOwner);
+                mCombineArchive = (sniffedType == Type::COMBINE_ARCHIVE) ? CombineArchive::create(pOwner) : nullptr;
 
                 if (mCombineArchive != nullptr) {
                     mType = Type::COMBINE_ARCHIVE;
@@ -119,6 +257,10 @@ void File::Impl::checkType(const FilePtr &pOwner, bool pResetType)
         }
     }
 
+    // Release our memory mapped file, if any, now that we are done parsing it.
+
+    releaseMappedFile();
+
     // Keep track of the fact that we have checked the type of the file.
 
     mTypeChecked = true;
@@ -144,15 +286,76 @@ const std::string &File::Impl::path() const
     return mUrl.empty() ? mFileName : mUrl;
 }
 
-const UnsignedChars &File::Impl::contents()
+void File::Impl::retrieveContents()
 {
 #ifndef __EMSCRIPTEN__
-    // Retrieve the contents of the file, if needed.
+    // Retrieve the contents of the file, if needed, by mapping the file in memory or, if that is not possible (e.g.,
+    // the file is empty), by reading it.
 
     if (mRetrieveContents && !mContentsRetrieved) {
-        setContents(fileContents(mFilePath));
+        auto mappedFile {std::make_unique<MappedFile>(mFilePath)};
+
+        if (mappedFile->isValid()) {
+            mContents.clear();
+
+            mMappedFile = std::move(mappedFile);
+
+            mTypeChecked = false;
+            mContentsRetrieved = true;
+        } else {
+            setContents(fileContents(mFilePath));
+        }
+    } else if (mMappedFileReleased) {
+        // Our contents were memory mapped, but our memory mapped file was released once we were done parsing it, so
+        // read them.
+
+        mContents = fileContents(mFilePath);
+        mMappedFileReleased = false;
     }
 #endif
+}
+
+void File::Impl::releaseMappedFile()
+{
+#ifndef __EMSCRIPTEN__
+    // Release our memory mapped file, if any, so that it doesn't get mapped for as long as we exist, i.e. so that it
+    // cannot get truncated from under us (resulting in a SIGBUS on POSIX) and it doesn't remain locked (on Windows).
+    // Note: our contents will be read if they are needed again, unless they have already been copied from our memory
+    //       mapped file.
+
+    if (mMappedFile != nullptr) {
+        mMappedFile = nullptr;
+        mMappedFileReleased = mContents.empty();
+    }
+#endif
+}
+
+std::span<const unsigned char> File::Impl::contentsView()
+{
+    // Return a view of our contents, which doesn't require our contents to be copied if they are memory mapped.
+
+    retrieveContents();
+
+    if (mMappedFile != nullptr) {
+        return mMappedFile->contents();
+    }
+
+    return mContents;
+}
+
+const UnsignedChars &File::Impl::contents()
+{
+    // Return our contents, copying them from our memory mapped file, if needed.
+    // Note: a memory mapped file is never empty, so if our contents are empty then it means that they have not yet been
+    //       copied.
+
+    retrieveContents();
+
+    if ((mMappedFile != nullptr) && mContents.empty()) {
+        auto mappedContents {mMappedFile->contents()};
+
+        mContents.assign(mappedContents.begin(), mappedContents.end());
+    }
 
     return mContents;
 }
@@ -160,11 +363,57 @@ const UnsignedChars &File::Impl::contents()
 void File::Impl::setContents(const UnsignedChars &pContents)
 {
     mContents = pContents;
+    mMappedFile = nullptr;
+    mMappedFileReleased = false;
+
+    mTypeChecked = false;
+    mContentsRetrieved = true;
+}
+
+void File::Impl::setContents(UnsignedChars &&pContents)
+{
+    mContents = std::move(pContents);
+    mMappedFile = nullptr;
+    mMappedFileReleased = false;
 
     mTypeChecked = false;
     mContentsRetrieved = true;
 }
 
+void File::Impl::setContentsExtractor(const std::function<UnsignedChars()> &pContentsExtractor)
+{
+    // Keep track of the function that will extract our contents when they are first needed.
+
+    mContentsExtractor = pContentsExtractor;
+    mContentsExtracted = false;
+}
+
+void File::Impl::extractContents(File *pOwner)
+{
+    // Extract our contents and check our type, if it hasn't already been done.
+    // Note: checking our type may result in our contents being requested again (e.g., when trying to get a CellML
+    //       file), hence we keep track of the fact that we are extracting our contents.
+
+    if (mContentsExtracted) {
+        return;
+    }
+
+    const std::scoped_lock lock(mMutex);
+
+    if (mContentsExtracted || mExtractingContents) {
+        return;
+    }
+
+    mExtractingContents = true;
+
+    setContents(mContentsExtractor());
+    checkType(pOwner->shared_from_this(), true);
+
+    mContentsExtractor = nullptr;
+    mExtractingContents = false;
+    mContentsExtracted = true;
+}
+
 bool File::Impl::hasChildFiles() const
 {
     if (mType == Type::COMBINE_ARCHIVE) {
@@ -257,12 +506,27 @@ const File::Impl *File::pimpl() const
     return static_cast<const Impl *>(Logger::mPimpl.get());
 }
 
+void File::extractContents() const
+{
+    // Extract our contents, if they are still to be extracted from a COMBINE archive.
+    // Note: this is a constant method, but extracting our contents is only about retrieving them on demand, hence it
+    //       is fine for us to use a non-constant version of ourselves.
+
+    if (!pimpl()->mContentsExtracted) {
+        auto *self {const_cast<File *>(this)}; // NOLINT
+
+        self->pimpl()->extractContents(self);
+    }
+}
+
 #ifdef __EMSCRIPTEN__
 FilePtr File::create(const std::string &pFileNameOrUrl)
 #else
 FilePtr File::create(const std::string &pFileNameOrUrl, bool pRetrieveContents)
 #endif
 {
+    const TraceScope traceScope {"File::create", "file"};
+
     // Check whether the given file name or URL is already managed and if so then return it otherwise create, manage,
     // and return a new file object.
 
@@ -306,6 +570,8 @@ FilePtr File::create(const std::string &pFileNameOrUrl, bool pRetrieveContents)
 
 File::Type File::type() const noexcept
 {
+    extractContents();
+
     return pimpl()->type();
 }
 
@@ -326,11 +592,22 @@ const std::string &File::path() const noexcept
 
 const UnsignedChars &File::contents()
 {
+    extractContents();
+
     return pimpl()->contents();
 }
 
 void File::setContents(const UnsignedChars &pContents)
 {
+    // Our contents are being set, so there is no need for them to be extracted anymore.
+    // Note: we lock our mutex, as is done when extracting our contents, so that we don't reset our extractor while
+    //       another thread is using it.
+
+    const std::scoped_lock lock(pimpl()->mMutex);
+
+    pimpl()->mContentsExtractor = nullptr;
+    pimpl()->mContentsExtracted = true;
+
     pimpl()->setContents(pContents);
 
     pimpl()->checkType(shared_from_this(), true);
@@ -338,26 +615,36 @@ void File::setContents(const UnsignedChars &pContents)
 
 bool File::hasChildFiles() const noexcept
 {
+    extractContents();
+
     return pimpl()->hasChildFiles();
 }
 
 size_t File::childFileCount() const noexcept
 {
+    extractContents();
+
     return pimpl()->childFileCount();
 }
 
 const Strings &File::childFileNames() const noexcept
 {
+    extractContents();
+
     return pimpl()->childFileNames();
 }
 
 const FilePtrs &File::childFiles() const noexcept
 {
+    extractContents();
+
     return pimpl()->childFiles();
 }
 
 const FilePtr &File::childFile(size_t pIndex) const noexcept
 {
+    extractContents();
+
     return pimpl()->childFile(pIndex);
 }
 
@@ -367,6 +654,8 @@ const FilePtr &File::childFileFromFileName(const std::string &pFileName) const n
 const FilePtr &File::childFile(const std::string &pFileName) const noexcept
 #endif
 {
+    extractContents();
+
 #ifdef __EMSCRIPTEN__
     return pimpl()->childFileFromFileName(pFileName);
 #else
@@ -20,11 +20,14 @@ limitations under the License.
 
 #include "cellmlfile.h"
 #include "combinearchive.h"
+#include "mappedfile.h"
 #include "sedmlfile.h"
 
 #include "libopencor/file.h"
 
+#include <atomic>
 #include <filesystem>
+#include <functional>
 
 namespace libOpenCOR {
 
@@ -42,6 +45,12 @@ public:
     bool mRetrieveContents {true};
     bool mContentsRetrieved {false};
     UnsignedChars mContents;
+    std::unique_ptr<MappedFile> mMappedFile;
+    bool mMappedFileReleased {false};
+
+    std::atomic<bool> mContentsExtracted {true};
+    bool mExtractingContents {false};
+    std::function<UnsignedChars()> mContentsExtractor;
 
     CellmlFilePtr mCellmlFile;
     SedmlFilePtr mSedmlFile;
@@ -50,6 +59,7 @@ public:
     explicit Impl(const std::string &pFileNameOrUrl, bool pRetrieveContents);
     ~Impl() override;
 
+    Type sniffType();
     void checkType(const FilePtr &pOwner, bool pResetType = false);
 
     Type type() const;
@@ -57,8 +67,15 @@ public:
     const std::string &url() const;
     const std::string &path() const;
 
+    void retrieveContents();
+    void releaseMappedFile();
+    std::span<const unsigned char> contentsView();
     const UnsignedChars &contents();
     void setContents(const UnsignedChars &pContents);
+    void setContents(UnsignedChars &&pContents);
+
+    void setContentsExtractor(const std::function<UnsignedChars()> &pContentsExtractor);
+    void extractContents(File *pOwner);
 
     bool hasChildFiles() const;
     size_t childFileCount() const;
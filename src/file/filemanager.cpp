@@ -14,6 +14,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#include "file_p.h"
 #include "filemanager_p.h"
 
 #include "utils.h"
@@ -31,48 +32,98 @@ FileManager::Impl &FileManager::Impl::instance()
     return instance;
 }
 
-FilePtr FileManager::Impl::manage(const FilePtr &pFile)
+const std::string &FileManager::Impl::key(const File *pFile)
+{
+    // Return the key used to index the given file, i.e. its file name if it is a local file or its URL otherwise.
+
+    return pFile->url().empty() ? pFile->fileName() : pFile->url();
+}
+
+FileManagerShard &FileManager::Impl::shard(const std::string &pKey)
+{
+    return mShards[std::hash<std::string> {}(pKey) % SHARD_COUNT];
+}
+
+const FileManagerShard &FileManager::Impl::shard(const std::string &pKey) const
+{
+    return mShards[std::hash<std::string> {}(pKey) % SHARD_COUNT];
+}
+
+FilePtr FileManager::Impl::managedFile(const FileManagerShard &pShard, const std::string &pKey) const
 {
-    const std::unique_lock<std::shared_mutex> lock(mMutex);
+    // Return the file, if any, that is managed under the given key in the given shard.
+    // Note: the caller must have locked the shard.
 
-    // Opportunistically remove any expired entries and correct our file count.
+    auto entry {pShard.entries.find(pKey)};
 
-    const auto expiredEnd = std::ranges::remove_if(mFiles.begin(), mFiles.end(), [](const auto &file) {
-                                return file.expired();
-                            }).begin();
+    if (entry == pShard.entries.end()) {
+        return nullptr;
+    }
 
-    mFileCount -= static_cast<size_t>(mFiles.end() - expiredEnd);
+    return entry->second.weakFile.lock();
+}
 
-    mFiles.erase(expiredEnd, mFiles.end());
+size_t FileManager::Impl::addOrderedFile(const FilePtr &pFile)
+{
+    // Add the given file to our ordered files and return its order.
+    // Note: the caller must have locked the shard of the file.
+
+    const std::unique_lock<std::shared_mutex> lock(mOrderedFilesMutex);
+
+    mOrderedFiles.emplace_back(mOrder, pFile);
+
+    return mOrder++;
+}
+
+void FileManager::Impl::removeOrderedFile(size_t pOrder)
+{
+    // Remove the file with the given order from our ordered files.
+    // Note: the caller must have locked the shard of the file. Also, our ordered files are sorted by order, so we can
+    //       look the file up using a binary search.
+
+    const std::unique_lock<std::shared_mutex> lock(mOrderedFilesMutex);
+    auto orderedFile {std::ranges::lower_bound(mOrderedFiles, pOrder, {}, &std::pair<size_t, std::weak_ptr<File>>::first)};
+
+    if ((orderedFile != mOrderedFiles.end()) && (orderedFile->first == pOrder)) {
+        mOrderedFiles.erase(orderedFile);
+    }
+}
+
+FilePtr FileManager::Impl::manage(const FilePtr &pFile)
+{
+    const auto &fileKey {key(pFile.get())};
+    auto &fileShard {shard(fileKey)};
+    const std::unique_lock<std::shared_mutex> lock(fileShard.mutex);
 
     // Check whether we already manage a file with the same name or URL. This must be done under the exclusive lock to
     // avoid a TOCTOU race with another thread that might have just managed the same file between our caller's existence
     // check and this call.
+    // Note: a file that has expired but whose destructor has not yet unmanaged it gets replaced with the given file,
+    //       in which case the number of managed files doesn't change.
 
-    const bool isLocalFile = pFile->url().empty();
-    const auto &fileNameOrUrl = isLocalFile ? pFile->fileName() : pFile->url();
+    auto [entry, inserted] {fileShard.entries.try_emplace(fileKey)};
 
-    for (const auto &file : mFiles) {
-        auto managedFile {file.lock()};
+    if (!inserted) {
+        auto existingFile {entry->second.weakFile.lock()};
 
-        if (isLocalFile ? managedFile->fileName() == fileNameOrUrl : managedFile->url() == fileNameOrUrl) {
-            return managedFile;
+        if (existingFile != nullptr) {
+            return existingFile;
         }
-    }
 
-    // No duplicate found, so manage the new file.
+        removeOrderedFile(entry->second.order);
+    } else {
+        ++mFileCount;
+    }
 
-    mFiles.emplace_back(pFile);
+    // No duplicate found, so manage the given file.
 
-    ++mFileCount;
+    entry->second = {pFile.get(), pFile, addOrderedFile(pFile)};
 
     return pFile;
 }
 
 void FileManager::Impl::unmanage(File *pFile)
 {
-    const std::unique_lock<std::shared_mutex> lock(mMutex);
-
     // Iteratively unmanage the file and all its child files.
     // Note: it would be much simpler to use recursion, but Clang-Tidy does not like it.
 
@@ -88,32 +139,55 @@ void FileManager::Impl::unmanage(File *pFile)
         files.pop();
 
         // Add the child files to the stack.
+        // Note: we use our file's private implementation so that we don't extract the contents of a file that is still
+        //       to be extracted from a COMBINE archive (such a file cannot have child files anyway).
 
-        for (const auto &childFile : file->childFiles()) {
+        for (const auto &childFile : file->pimpl()->childFiles()) {
             files.push(childFile.get());
         }
 
-        // Unmanage the current file.
+        // Unmanage the current file, but only if it is the file managed under its name or URL.
+        // Note: an expired file may have been replaced with another file with the same name or URL (see manage()).
 
-        const auto removeEnd = std::ranges::remove_if(mFiles.begin(), mFiles.end(), [&file](const auto &managedFile) {
-                                   auto managedFilePtr {managedFile.lock()};
+        const auto &fileKey {key(file)};
+        auto &fileShard {shard(fileKey)};
+        const std::unique_lock<std::shared_mutex> lock(fileShard.mutex);
+        auto entry {fileShard.entries.find(fileKey)};
 
-                                   return (managedFilePtr == nullptr) || (managedFilePtr.get() == file);
-                               }).begin();
+        if ((entry != fileShard.entries.end()) && (entry->second.file == file)) {
+            removeOrderedFile(entry->second.order);
 
-        mFileCount -= static_cast<size_t>(mFiles.end() - removeEnd);
+            fileShard.entries.erase(entry);
 
-        mFiles.erase(removeEnd, mFiles.end());
+            --mFileCount;
+        }
     }
 }
 
 void FileManager::Impl::reset()
 {
-    const std::unique_lock<std::shared_mutex> lock(mMutex);
+    for (auto &fileShard : mShards) {
+        const std::unique_lock<std::shared_mutex> lock(fileShard.mutex);
+        std::vector<size_t> orders;
+
+        orders.reserve(fileShard.entries.size());
+
+        for (const auto &[fileKey, entry] : fileShard.entries) {
+            orders.push_back(entry.order);
+        }
+
+        std::ranges::sort(orders);
 
-    mFiles.clear();
+        const std::unique_lock<std::shared_mutex> orderedFilesLock(mOrderedFilesMutex);
 
-    mFileCount = 0;
+        std::erase_if(mOrderedFiles, [&orders](const auto &pOrderedFile) {
+            return std::ranges::binary_search(orders, pOrderedFile.first);
+        });
+
+        mFileCount -= fileShard.entries.size();
+
+        fileShard.entries.clear();
+    }
 }
 
 bool FileManager::Impl::hasFiles() const
@@ -133,12 +207,19 @@ size_t FileManager::Impl::fileCount() const
 
 FilePtrs FileManager::Impl::files() const
 {
-    const std::shared_lock<std::shared_mutex> lock(mMutex);
+    // Retrieve all our (non-expired) files and return them in the order in which they were managed.
 
+    const std::shared_lock<std::shared_mutex> lock(mOrderedFilesMutex);
     FilePtrs res;
 
-    for (const auto &file : mFiles) {
-        res.push_back(file.lock());
+    res.reserve(mOrderedFiles.size());
+
+    for (const auto &[order, weakFile] : mOrderedFiles) {
+        auto file {weakFile.lock()};
+
+        if (file != nullptr) {
+            res.push_back(std::move(file));
+        }
     }
 
     return res;
@@ -146,19 +227,19 @@ FilePtrs FileManager::Impl::files() const
 
 FilePtr FileManager::Impl::file(size_t pIndex) const
 {
-    const std::shared_lock<std::shared_mutex> lock(mMutex);
-
-    size_t index {0};
+    // Return the file at the given index in our ordered files.
+    // Note: unlike files(), we don't skip a file that has expired but whose destructor has not yet unmanaged it (see
+    //       the note in hasFiles()), in which case we return nullptr. This means that, like fileCount(), file() may
+    //       briefly lag behind, but that it doesn't need to retrieve all our files. To iterate over our files, use
+    //       files() instead.
 
-    for (const auto &file : mFiles) {
-        if (index == pIndex) {
-            return file.lock();
-        }
+    const std::shared_lock<std::shared_mutex> lock(mOrderedFilesMutex);
 
-        ++index;
+    if (pIndex >= mOrderedFiles.size()) {
+        return nullptr;
     }
 
-    return nullptr;
+    return mOrderedFiles[pIndex].second.lock();
 }
 
 #ifdef __EMSCRIPTEN__
@@ -167,25 +248,11 @@ FilePtr FileManager::Impl::fileFromFileNameOrUrl(const std::string &pFileNameOrU
 FilePtr FileManager::Impl::file(const std::string &pFileNameOrUrl) const
 #endif
 {
-    const std::shared_lock<std::shared_mutex> lock(mMutex);
+    auto fileNameOrUrl {std::get<1>(retrieveFileInfo(pFileNameOrUrl))};
+    const auto &fileShard {shard(fileNameOrUrl)};
+    const std::shared_lock<std::shared_mutex> lock(fileShard.mutex);
 
-#if __clang_major__ < 16
-    auto [tIsLocalFile, tFileNameOrUrl] {retrieveFileInfo(pFileNameOrUrl)};
-    auto isLocalFile {tIsLocalFile};
-    auto fileNameOrUrl {tFileNameOrUrl};
-#else
-    auto [isLocalFile, fileNameOrUrl] {retrieveFileInfo(pFileNameOrUrl)};
-#endif
-
-    for (const auto &file : mFiles) {
-        auto managedFile {file.lock()};
-
-        if (isLocalFile ? managedFile->fileName() == fileNameOrUrl : managedFile->url() == fileNameOrUrl) {
-            return managedFile;
-        }
-    }
-
-    return nullptr;
+    return managedFile(fileShard, fileNameOrUrl);
 }
 
 FileManager &FileManager::instance()
@@ -248,4 +315,36 @@ FilePtr FileManager::file(const std::string &pFileNameOrUrl) const
 #endif
 }
 
+#ifndef __EMSCRIPTEN__
+std::string FileManager::cacheDirectory() const
+{
+    return pathToString(downloadCacheSettings().directory);
+}
+
+void FileManager::setCacheDirectory(const std::string &pCacheDirectory)
+{
+    setDownloadCacheDirectory(stringToPath(pCacheDirectory));
+}
+
+size_t FileManager::cacheSizeLimit() const
+{
+    return downloadCacheSettings().sizeLimit;
+}
+
+void FileManager::setCacheSizeLimit(size_t pCacheSizeLimit)
+{
+    setDownloadCacheSizeLimit(pCacheSizeLimit);
+}
+
+bool FileManager::offline() const
+{
+    return downloadCacheSettings().offline;
+}
+
+void FileManager::setOffline(bool pOffline)
+{
+    setDownloadCacheOffline(pOffline);
+}
+#endif
+
 } // namespace libOpenCOR
@@ -18,24 +18,58 @@ limitations under the License.
 
 #include "libopencor/filemanager.h"
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace libOpenCOR {
 
-using Files = std::vector<std::weak_ptr<File>>;
+struct FileManagerEntry
+{
+    File *file {nullptr};
+    std::weak_ptr<File> weakFile;
+    size_t order {0};
+};
+
+struct FileManagerShard
+{
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string, FileManagerEntry> entries;
+};
 
 class FileManager::Impl
 {
 public:
-    mutable std::shared_mutex mMutex;
+    // Note: our files are indexed by their file name or URL, and spread over several shards, each of which has its own
+    //       lock. This means that looking up, managing, or unmanaging a file only requires one shard to be locked. We
+    //       also keep track of our files in the order in which they were managed, and under their own lock (always
+    //       acquired after a shard lock), since files are accessible by index.
+
+    static constexpr size_t SHARD_COUNT {16};
 
-    Files mFiles;
+    std::array<FileManagerShard, SHARD_COUNT> mShards;
     mutable std::atomic<size_t> mFileCount {0};
 
+    mutable std::shared_mutex mOrderedFilesMutex;
+    std::vector<std::pair<size_t, std::weak_ptr<File>>> mOrderedFiles;
+    size_t mOrder {0};
+
     static Impl &instance();
 
+    static const std::string &key(const File *pFile);
+
+    FileManagerShard &shard(const std::string &pKey);
+    const FileManagerShard &shard(const std::string &pKey) const;
+
+    FilePtr managedFile(const FileManagerShard &pShard, const std::string &pKey) const;
+
+    size_t addOrderedFile(const FilePtr &pFile);
+    void removeOrderedFile(size_t pOrder);
+
     FilePtr manage(const FilePtr &pFile);
     void unmanage(File *pFile);
 
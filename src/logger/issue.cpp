@@ -18,28 +18,32 @@ limitations under the License.
 
 namespace libOpenCOR {
 
-Issue::Impl::Impl(Type pType, const std::string &pDescription, const std::string &pContext)
+Issue::Impl::Impl(Type pType, std::shared_ptr<const std::string> pDescription, std::string pContext)
     : mType(pType)
-    , mDescription(pDescription)
-    , mContext(pContext)
+    , mDescription(std::move(pDescription))
+    , mContext(std::move(pContext))
 {
     // Check whether we have some context to add to the description.
+    // Note: our description may be shared with other issues (e.g., when the issues of a logger are added to another
+    //       logger), so we never modify it.
 
     if (!mContext.empty()) {
-        mDescriptionWithContext.reserve(mContext.size() + 2 + mDescription.size()); // NOLINT
+        const auto &description {*mDescription};
+
+        mDescriptionWithContext.reserve(mContext.size() + 2 + description.size()); // NOLINT
 
         mDescriptionWithContext = mContext;
         mDescriptionWithContext += ": ";
 
 #ifndef CODE_COVERAGE_ENABLED
-        mDescriptionWithContext += (std::isupper(mDescription[0]) != 0) ?
-                                       static_cast<char>(std::tolower(mDescription[0])) :
-                                       mDescription[0];
+        mDescriptionWithContext += (std::isupper(description[0]) != 0) ?
+                                       static_cast<char>(std::tolower(description[0])) :
+                                       description[0];
 #else
-        mDescriptionWithContext += static_cast<char>(std::tolower(mDescription[0]));
+        mDescriptionWithContext += static_cast<char>(std::tolower(description[0]));
 #endif
 
-        mDescriptionWithContext += mDescription.substr(1);
+        mDescriptionWithContext.append(description, 1);
     }
 }
 
@@ -62,11 +66,16 @@ const std::string &Issue::Impl::description() const
         return mDescriptionWithContext;
     }
 
-    return mDescription;
+    return *mDescription;
+}
+
+Issue::Issue(Type pType, std::string pDescription, std::string pContext)
+    : mPimpl(std::make_unique<Impl>(pType, std::make_shared<const std::string>(std::move(pDescription)), std::move(pContext)))
+{
 }
 
-Issue::Issue(Type pType, const std::string &pDescription, const std::string &pContext)
-    : mPimpl(std::make_unique<Impl>(pType, pDescription, pContext))
+Issue::Issue(Type pType, const std::shared_ptr<const std::string> &pDescription, std::string pContext)
+    : mPimpl(std::make_unique<Impl>(pType, pDescription, std::move(pContext)))
 {
 }
 
@@ -18,17 +18,19 @@ limitations under the License.
 
 #include "libopencor/issue.h"
 
+#include <memory>
+
 namespace libOpenCOR {
 
 class Issue::Impl
 {
 public:
     Type mType;
-    std::string mDescription;
+    std::shared_ptr<const std::string> mDescription;
     std::string mContext;
     std::string mDescriptionWithContext;
 
-    explicit Impl(Type pType, const std::string &pDescription, const std::string &pContext);
+    explicit Impl(Type pType, std::shared_ptr<const std::string> pDescription, std::string pContext);
 
     Type type() const;
     const std::string &typeAsString() const;
@@ -19,107 +19,165 @@ limitations under the License.
 
 namespace libOpenCOR {
 
-bool Logger::Impl::hasIssues() const
+LoggerIssuesPtr Logger::Impl::issuesSnapshot() const
 {
+    // Return a snapshot of our issues, which only requires our lock to be held while retrieving it.
+
+    static const LoggerIssuesPtr NO_ISSUES {std::make_shared<const LoggerIssues>()};
+
     const std::scoped_lock<std::recursive_mutex> lock(mMutex);
 
-    return !mIssues.empty();
+    if (mIssues == nullptr) {
+        return NO_ISSUES;
+    }
+
+    return mIssues;
 }
 
-size_t Logger::Impl::issueCount() const
+LoggerIssues &Logger::Impl::mutableIssues()
 {
-    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
+    // Return our issues so that they can be modified, copying them if a snapshot of them is still referenced elsewhere.
+    // Note: the caller must have locked our mutex. A snapshot of our issues can only be retrieved while our mutex is
+    //       locked, so if we are the only one to reference our issues then no one else can start referencing them.
+
+    if (mIssues == nullptr) {
+        mIssues = std::make_shared<LoggerIssues>();
+    } else if (mIssues.use_count() != 1) {
+        mIssues = std::make_shared<LoggerIssues>(*mIssues);
+    }
 
-    return mIssues.size();
+    return *mIssues;
 }
 
-IssuePtrs Logger::Impl::issues() const
+bool Logger::Impl::hasIssues() const
 {
-    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
+    return mIssueCount.load(std::memory_order_acquire) != 0;
+}
 
-    return mIssues;
+size_t Logger::Impl::issueCount() const
+{
+    return mIssueCount.load(std::memory_order_acquire);
+}
+
+IssuePtrs Logger::Impl::issues() const
+{
+    return issuesSnapshot()->issues;
 }
 
 IssuePtr Logger::Impl::issue(size_t pIndex) const
 {
     const std::scoped_lock<std::recursive_mutex> lock(mMutex);
 
-    if (pIndex >= mIssues.size()) {
+    if ((mIssues == nullptr) || (pIndex >= mIssues->issues.size())) {
         return nullptr;
     }
 
-    return mIssues[pIndex];
+    return mIssues->issues[pIndex];
 }
 
 bool Logger::Impl::hasErrors() const
 {
-    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
-
-    return !mErrors.empty();
+    return mErrorCount.load(std::memory_order_acquire) != 0;
 }
 
 size_t Logger::Impl::errorCount() const
 {
-    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
-
-    return mErrors.size();
+    return mErrorCount.load(std::memory_order_acquire);
 }
 
 IssuePtrs Logger::Impl::errors() const
 {
-    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
-
-    return mErrors;
+    return issuesSnapshot()->errors;
 }
 
 IssuePtr Logger::Impl::error(size_t pIndex) const
 {
     const std::scoped_lock<std::recursive_mutex> lock(mMutex);
 
-    if (pIndex >= mErrors.size()) {
+    if ((mIssues == nullptr) || (pIndex >= mIssues->errors.size())) {
         return nullptr;
     }
 
-    return mErrors[pIndex];
+    return mIssues->errors[pIndex];
 }
 
 bool Logger::Impl::hasWarnings() const
 {
-    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
-
-    return !mWarnings.empty();
+    return mWarningCount.load(std::memory_order_acquire) != 0;
 }
 
 size_t Logger::Impl::warningCount() const
 {
-    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
-
-    return mWarnings.size();
+    return mWarningCount.load(std::memory_order_acquire);
 }
 
 IssuePtrs Logger::Impl::warnings() const
 {
-    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
-
-    return mWarnings;
+    return issuesSnapshot()->warnings;
 }
 
 IssuePtr Logger::Impl::warning(size_t pIndex) const
 {
     const std::scoped_lock<std::recursive_mutex> lock(mMutex);
 
-    if (pIndex >= mWarnings.size()) {
+    if ((mIssues == nullptr) || (pIndex >= mIssues->warnings.size())) {
         return nullptr;
     }
 
-    return mWarnings[pIndex];
+    return mIssues->warnings[pIndex];
 }
 
-void Logger::Impl::addIssues(const LoggerPtr &pLogger, const std::string &pContext)
+void Logger::Impl::addIssues(const LoggerIssuesPtr &pIssues)
 {
-    for (const auto &issue : pLogger->issues()) {
-        addIssue(issue->type(), issue->mPimpl->mDescription,
-                 issue->mPimpl->mContext.empty() ? pContext : pContext + " | " + issue->mPimpl->mContext);
+    if (pIssues == nullptr) {
+        return;
+    }
+
+    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
+
+    // Share the given issues if we don't have any issues ourselves, since they cannot be modified (see
+    // mutableIssues()), or add them one by one otherwise.
+
+    if (mIssueCount.load(std::memory_order_acquire) == 0) {
+        mIssues = std::const_pointer_cast<LoggerIssues>(pIssues);
+
+        mIssueCount.store(pIssues->issues.size(), std::memory_order_release);
+        mErrorCount.store(pIssues->errors.size(), std::memory_order_release);
+        mWarningCount.store(pIssues->warnings.size(), std::memory_order_release);
+
+        return;
+    }
+
+    for (const auto &issue : pIssues->issues) {
+        addIssue(issue);
+    }
+}
+
+void Logger::Impl::addIssues(const LoggerPtr &pLogger, std::string_view pContext)
+{
+    // Add the issues of the given logger, prefixing their context with the given one.
+    // Note: we take a snapshot of the issues of the given logger, which means that we never hold both locks at the
+    //       same time (and therefore don't depend on a lock order), that the given logger can be ourselves, and that
+    //       its issues don't get copied. Also, the description of an issue is shared with the issue that we create
+    //       from it.
+
+    const auto issues {pLogger->mPimpl->issuesSnapshot()};
+    const std::scoped_lock<std::recursive_mutex> lock(mMutex);
+
+    for (const auto &issue : issues->issues) {
+        const auto &issueContext {issue->mPimpl->mContext};
+        std::string context;
+
+        context.reserve(pContext.size() + (issueContext.empty() ? 0 : 3 + issueContext.size())); // NOLINT
+
+        context += pContext;
+
+        if (!issueContext.empty()) {
+            context += " | ";
+            context += issueContext;
+        }
+
+        addIssue(issue->type(), issue->mPimpl->mDescription, std::move(context));
     }
 }
 
@@ -137,38 +195,63 @@ void Logger::Impl::addIssues(const libcellml::LoggerPtr &pLogger, const std::str
     }
 }
 
-void Logger::Impl::addIssue(Issue::Type pType, const std::string &pDescription, const std::string &pContext)
+void Logger::Impl::addIssue(const IssuePtr &pIssue)
 {
     const std::scoped_lock<std::recursive_mutex> lock(mMutex);
+    auto &issues {mutableIssues()};
 
-    auto issue {IssuePtr {new Issue {pType, pDescription, pContext}}};
-    mIssues.push_back(issue);
+    issues.issues.push_back(pIssue);
 
-    if (pType == Issue::Type::ERROR) {
-        mErrors.push_back(std::move(issue));
+    if (pIssue->type() == Issue::Type::ERROR) {
+        issues.errors.push_back(pIssue);
+
+        mErrorCount.store(issues.errors.size(), std::memory_order_release);
     } else {
-        mWarnings.push_back(std::move(issue));
+        issues.warnings.push_back(pIssue);
+
+        mWarningCount.store(issues.warnings.size(), std::memory_order_release);
     }
+
+    mIssueCount.store(issues.issues.size(), std::memory_order_release);
+}
+
+void Logger::Impl::addIssue(Issue::Type pType, std::string pDescription, std::string pContext)
+{
+    addIssue(IssuePtr {new Issue {pType, std::move(pDescription), std::move(pContext)}});
+}
+
+void Logger::Impl::addIssue(Issue::Type pType, const std::shared_ptr<const std::string> &pDescription, std::string pContext)
+{
+    addIssue(IssuePtr {new Issue {pType, pDescription, std::move(pContext)}});
 }
 
-void Logger::Impl::addError(const std::string &pDescription)
+void Logger::Impl::addError(std::string pDescription)
 {
-    addIssue(Issue::Type::ERROR, pDescription);
+    addIssue(Issue::Type::ERROR, std::move(pDescription));
 }
 
-void Logger::Impl::addWarning(const std::string &pDescription)
+void Logger::Impl::addWarning(std::string pDescription)
 {
-    addIssue(Issue::Type::WARNING, pDescription);
+    addIssue(Issue::Type::WARNING, std::move(pDescription));
 }
 
 void Logger::Impl::removeAllIssues()
 {
+    // Note: we may be called a lot (e.g., every time KINSOL solves an NLA system), so we only lock our mutex if there
+    //       are some issues to remove. Also, we don't clear our issues since a snapshot of them may still be referenced
+    //       elsewhere.
+
+    if (mIssueCount.load(std::memory_order_acquire) == 0) {
+        return;
+    }
+
     const std::scoped_lock<std::recursive_mutex> lock(mMutex);
 
-    mIssues.clear();
+    mIssues = nullptr;
 
-    mErrors.clear();
-    mWarnings.clear();
+    mIssueCount.store(0, std::memory_order_release);
+    mErrorCount.store(0, std::memory_order_release);
+    mWarningCount.store(0, std::memory_order_release);
 }
 
 Logger::Logger(std::unique_ptr<Impl> pPimpl)
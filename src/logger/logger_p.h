@@ -22,22 +22,47 @@ limitations under the License.
 #include "libopencor/issue.h"
 #include "libopencor/logger.h"
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <string_view>
 
 namespace libOpenCOR {
 
+// The issues of a logger. They are never modified once they have been shared, i.e. a snapshot of them can be iterated
+// over without holding the lock of their logger and without them being copied.
+
+struct LoggerIssues
+{
+    IssuePtrs issues;
+    IssuePtrs errors;
+    IssuePtrs warnings;
+};
+
+using LoggerIssuesPtr = std::shared_ptr<const LoggerIssues>;
+
 class Logger::Impl
 {
 public:
     mutable std::recursive_mutex mMutex;
 
-    IssuePtrs mIssues;
+    // Note: our issues are copied on write, i.e. only if a snapshot of them is still referenced elsewhere (see
+    //       mutableIssues()).
+
+    std::shared_ptr<LoggerIssues> mIssues;
 
-    IssuePtrs mErrors;
-    IssuePtrs mWarnings;
+    // Note: our counts are kept in sync with our lists of issues, but they can be read without locking our mutex, so
+    //       that checking whether there are some issues (something that we do a lot) is cheap.
+
+    std::atomic<size_t> mIssueCount {0};
+    std::atomic<size_t> mErrorCount {0};
+    std::atomic<size_t> mWarningCount {0};
 
     virtual ~Impl() = default;
 
+    LoggerIssuesPtr issuesSnapshot() const;
+    LoggerIssues &mutableIssues();
+
     bool hasIssues() const;
     size_t issueCount() const;
     IssuePtrs issues() const;
@@ -53,13 +78,16 @@ public:
     IssuePtrs warnings() const;
     IssuePtr warning(size_t pIndex) const;
 
-    void addIssues(const LoggerPtr &pLogger, const std::string &pContext);
+    void addIssues(const LoggerIssuesPtr &pIssues);
+    void addIssues(const LoggerPtr &pLogger, std::string_view pContext);
     void addIssues(const libcellml::LoggerPtr &pLogger, const std::string &pContext);
 
-    void addIssue(Issue::Type pType, const std::string &pDescription, const std::string &pContext = "");
+    void addIssue(const IssuePtr &pIssue);
+    void addIssue(Issue::Type pType, std::string pDescription, std::string pContext = {});
+    void addIssue(Issue::Type pType, const std::shared_ptr<const std::string> &pDescription, std::string pContext);
 
-    void addError(const std::string &pDescription);
-    void addWarning(const std::string &pDescription);
+    void addError(std::string pDescription);
+    void addWarning(std::string pDescription);
 
     void removeAllIssues();
 };
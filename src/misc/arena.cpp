@@ -0,0 +1,69 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "arena.h"
+
+#include <new>
+
+namespace libOpenCOR {
+
+namespace {
+
+constexpr size_t DOUBLES_PER_CACHE_LINE {CACHE_LINE_SIZE / sizeof(double)};
+
+} // namespace
+
+Arena::~Arena()
+{
+    if (mData != nullptr) {
+        ::operator delete(mData, std::align_val_t {CACHE_LINE_SIZE});
+    }
+}
+
+size_t Arena::capacity() const noexcept
+{
+    return mCapacity;
+}
+
+size_t Arena::paddedSize(size_t pSize) noexcept
+{
+    // Round the given number of doubles up to a whole number of cache lines, so that the next array starts on its own
+    // cache line.
+
+    return (pSize + DOUBLES_PER_CACHE_LINE - 1) / DOUBLES_PER_CACHE_LINE * DOUBLES_PER_CACHE_LINE;
+}
+
+double *Arena::reserve(size_t pSize)
+{
+    // Grow our allocation, if needed.
+    // Note: there is no need to copy our current values since carving arrays doesn't preserve them.
+
+    if (pSize > mCapacity) {
+        if (mData != nullptr) {
+            ::operator delete(mData, std::align_val_t {CACHE_LINE_SIZE});
+
+            mData = nullptr;
+            mCapacity = 0;
+        }
+
+        mData = static_cast<double *>(::operator new(pSize * sizeof(double), std::align_val_t {CACHE_LINE_SIZE}));
+        mCapacity = pSize;
+    }
+
+    return mData;
+}
+
+} // namespace libOpenCOR
@@ -0,0 +1,81 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace libOpenCOR {
+
+// The size of a cache line.
+// Note: we don't use std::hardware_destructive_interference_size since its value may vary between compilers and
+//       compiler options.
+
+constexpr size_t CACHE_LINE_SIZE {64};
+
+// An arena of doubles, i.e. a single allocation, aligned on a cache line, from which several arrays of doubles are
+// carved, each of them starting on its own cache line.
+// Note: an arena only ever grows, so carving arrays that fit in it doesn't involve any allocation, which means that an
+//       arena can be reused (e.g., from one run to another) at no cost. However, carving arrays invalidates the arrays
+//       that were previously carved and it doesn't initialise their values.
+
+class Arena
+{
+public:
+    Arena() = default;
+    ~Arena();
+
+    Arena(const Arena &pOther) = delete;
+    Arena(Arena &&pOther) noexcept = delete;
+
+    Arena &operator=(const Arena &pRhs) = delete;
+    Arena &operator=(Arena &&pRhs) noexcept = delete;
+
+    template<size_t N>
+    std::array<std::span<double>, N> carve(const std::array<size_t, N> &pSizes)
+    {
+        std::array<size_t, N> offsets {};
+        size_t size {0};
+
+        for (size_t i {0}; i < N; ++i) {
+            offsets[i] = size;
+            size += paddedSize(pSizes[i]);
+        }
+
+        auto *data {reserve(size)};
+        std::array<std::span<double>, N> res;
+
+        for (size_t i {0}; i < N; ++i) {
+            res[i] = (pSizes[i] == 0) ? std::span<double> {} : std::span<double> {data + offsets[i], pSizes[i]}; // NOLINT
+        }
+
+        return res;
+    }
+
+    size_t capacity() const noexcept;
+
+private:
+    double *mData {nullptr};
+    size_t mCapacity {0};
+
+    static size_t paddedSize(size_t pSize) noexcept;
+
+    double *reserve(size_t pSize);
+};
+
+} // namespace libOpenCOR
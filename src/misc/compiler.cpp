@@ -299,7 +299,7 @@ static void patchWasmSharedMemory(UnsignedChars &pWasmModule)
 #ifdef __EMSCRIPTEN__
 bool Compiler::Impl::compile(const std::string &pCode, UnsignedChars &pWasmModule)
 #else
-bool Compiler::Impl::compile(const std::string &pCode)
+bool Compiler::Impl::compile(const std::string &pCode, bool pTargetHost)
 #endif
 {
     // Reset ourselves.
@@ -338,7 +338,25 @@ bool Compiler::Impl::compile(const std::string &pCode)
                                                                    "-funroll-loops",
                                                                    DUMMY_FILE_NAME}};
 
+#ifdef __EMSCRIPTEN__
     std::unique_ptr<clang::driver::Compilation> compilation(driver.BuildCompilation(COMPILATION_ARGUMENTS));
+#else
+    // Target the host CPU, if requested, so that vectorised code can make full use of its SIMD instructions.
+    // Note: we disable floating-point contractions so that the results we get are the same as the ones we would get
+    //       without targeting the host CPU.
+
+    auto compilationArguments {COMPILATION_ARGUMENTS};
+
+    if (pTargetHost) {
+#    if defined(__x86_64__) || defined(_M_X64)
+        compilationArguments.insert(compilationArguments.end() - 1, {"-march=native", "-ffp-contract=off"});
+#    else
+        compilationArguments.insert(compilationArguments.end() - 1, {"-mcpu=native", "-ffp-contract=off"});
+#    endif
+    }
+
+    std::unique_ptr<clang::driver::Compilation> compilation(driver.BuildCompilation(compilationArguments));
+#endif
 
 #ifndef CODE_COVERAGE_ENABLED
     if (compilation == nullptr) {
@@ -377,7 +395,7 @@ bool Compiler::Impl::compile(const std::string &pCode)
         error += commandName;
         error += "'.";
 
-        addError(error);
+        addError(std::move(error));
 
         return false;
     }
@@ -516,7 +534,7 @@ extern double atanh(double);
                 std::getline(input, line);
             }
 
-            addError(error);
+            addError(std::move(error));
         }
 
         return false;
@@ -582,7 +600,7 @@ extern double atanh(double);
         targetError += ") could not be found: ";
         targetError += error;
 
-        addError(targetError);
+        addError(std::move(targetError));
 
         return false;
     }
@@ -651,7 +669,7 @@ extern double atanh(double);
         error += llvmError;
         error += ".";
 
-        addError(error);
+        addError(std::move(error));
 
         return false;
     }
@@ -674,7 +692,7 @@ extern double atanh(double);
         error += llvmError;
         error += ".";
 
-        addError(error);
+        addError(std::move(error));
 
         return false;
     }
@@ -723,7 +741,7 @@ bool Compiler::Impl::addFunction(const std::string &pName, void *pFunction)
         error += pName;
         error += "() function could not be added to the compiler.";
 
-        addError(error);
+        addError(std::move(error));
     }
 #    endif
 
@@ -773,9 +791,9 @@ bool Compiler::compile(const std::string &pCode, UnsignedChars &pWasmModule)
     return pimpl()->compile(pCode, pWasmModule);
 }
 #else
-bool Compiler::compile(const std::string &pCode)
+bool Compiler::compile(const std::string &pCode, bool pTargetHost)
 {
-    return pimpl()->compile(pCode);
+    return pimpl()->compile(pCode, pTargetHost);
 }
 
 bool Compiler::addFunction(const std::string &pName, void *pFunction)
@@ -43,7 +43,7 @@ public:
 #ifdef __EMSCRIPTEN__
     bool compile(const std::string &pCode, UnsignedChars &pWasmModule);
 #else
-    bool compile(const std::string &pCode);
+    bool compile(const std::string &pCode, bool pTargetHost = false);
 
     bool addFunction(const std::string &pName, void *pFunction);
 
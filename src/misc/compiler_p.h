@@ -34,7 +34,7 @@ public:
 #else
     std::unique_ptr<llvm::orc::LLJIT> mLljit;
 
-    bool compile(const std::string &pCode);
+    bool compile(const std::string &pCode, bool pTargetHost);
 
     bool addFunction(const std::string &pName, void *pFunction);
 
@@ -0,0 +1,118 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "mappedfile.h"
+
+#ifdef BUILDING_ON_WINDOWS
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace libOpenCOR {
+
+MappedFile::MappedFile(const std::filesystem::path &pFilePath)
+{
+    // Map the given file in memory, unless it is empty since an empty file cannot be mapped.
+    // Note: we don't keep the file open since the mapping remains valid once the file has been closed.
+
+#ifdef BUILDING_ON_WINDOWS
+    auto *file {CreateFileW(pFilePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if ((GetFileSizeEx(file, &fileSize) != 0) && (fileSize.QuadPart > 0)) {
+        mMapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (mMapping != nullptr) {
+            auto *data {MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0)};
+
+            if (data != nullptr) {
+                mData = static_cast<const unsigned char *>(data);
+                mSize = static_cast<size_t>(fileSize.QuadPart);
+            } else {
+                CloseHandle(mMapping);
+
+                mMapping = nullptr;
+            }
+        }
+    }
+
+    CloseHandle(file);
+#else
+    auto file {open(pFilePath.c_str(), O_RDONLY)}; // NOLINT
+
+    if (file == -1) {
+        return;
+    }
+
+    struct stat fileStat {};
+
+    if ((fstat(file, &fileStat) == 0) && (fileStat.st_size > 0)) {
+        auto fileSize {static_cast<size_t>(fileStat.st_size)};
+        auto *data {mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0)};
+
+        if (data != MAP_FAILED) { // NOLINT
+            mData = static_cast<const unsigned char *>(data);
+            mSize = fileSize;
+        }
+    }
+
+    close(file);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+    // Unmap our file, if it was mapped.
+
+    if (mData == nullptr) {
+        return;
+    }
+
+#ifdef BUILDING_ON_WINDOWS
+    UnmapViewOfFile(mData);
+    CloseHandle(mMapping);
+#else
+    munmap(const_cast<unsigned char *>(mData), mSize); // NOLINT
+#endif
+}
+
+bool MappedFile::isValid() const
+{
+    return mData != nullptr;
+}
+
+std::span<const unsigned char> MappedFile::contents() const
+{
+    return {mData, mSize};
+}
+
+} // namespace libOpenCOR
@@ -0,0 +1,54 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+
+namespace libOpenCOR {
+
+// A read-only memory mapping of a local file, which means that the contents of the file can be accessed without having
+// to be read into (and copied around in) memory.
+// Note: the mapping only exists for as long as the MappedFile object exists, so a span returned by contents() must not
+//       outlive it. A MappedFile object should also be short lived since, while it exists, the file is locked on
+//       Windows and its truncation results in a SIGBUS on POSIX.
+
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::filesystem::path &pFilePath);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &pOther) = delete;
+    MappedFile(MappedFile &&pOther) noexcept = delete;
+
+    MappedFile &operator=(const MappedFile &pRhs) = delete;
+    MappedFile &operator=(MappedFile &&pRhs) noexcept = delete;
+
+    bool isValid() const;
+
+    std::span<const unsigned char> contents() const;
+
+private:
+#ifdef BUILDING_ON_WINDOWS
+    void *mMapping {nullptr};
+#endif
+    const unsigned char *mData {nullptr};
+    size_t mSize {0};
+};
+
+} // namespace libOpenCOR
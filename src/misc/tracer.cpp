@@ -0,0 +1,198 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "tracer.h"
+
+#include "libopencor/tracing.h"
+
+#include <atomic>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace libOpenCOR {
+
+namespace {
+
+// A trace event, with its start time and duration in nanoseconds since the trace origin.
+
+struct TraceEvent
+{
+    const char *name;
+    const char *category;
+    int64_t start;
+    int64_t duration;
+};
+
+// The trace buffer of a thread.
+// Note: a trace buffer is only ever contended when the trace is being cleared or exported, so locking its mutex is
+//       cheap while recording events. Also, to prevent a long simulation from exhausting memory, we stop recording
+//       events once a trace buffer is full.
+
+struct TraceBuffer
+{
+    static constexpr size_t MAXIMUM_EVENT_COUNT {1048576};
+
+    uint64_t threadId {0};
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    size_t droppedEventCount {0};
+};
+
+using TraceBufferPtr = std::shared_ptr<TraceBuffer>;
+
+std::atomic<bool> sTracingEnabled {false}; // NOLINT
+const auto sTraceOrigin {std::chrono::steady_clock::now()}; // NOLINT
+
+// The trace buffers of all the threads that have recorded some events.
+// Note: we keep track of the trace buffer of a thread even after the thread has finished, so that its events can still
+//       be exported.
+
+std::mutex sTraceBuffersMutex; // NOLINT
+std::vector<TraceBufferPtr> sTraceBuffers; // NOLINT
+uint64_t sTraceThreadCount {0}; // NOLINT
+
+TraceBuffer &threadTraceBuffer()
+{
+    thread_local const TraceBufferPtr traceBuffer {[]() {
+        auto res {std::make_shared<TraceBuffer>()};
+        const std::scoped_lock<std::mutex> lock(sTraceBuffersMutex);
+
+        res->threadId = ++sTraceThreadCount;
+
+        sTraceBuffers.push_back(res);
+
+        return res;
+    }()};
+
+    return *traceBuffer;
+}
+
+int64_t traceTime(const std::chrono::steady_clock::time_point &pTimePoint)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(pTimePoint - sTraceOrigin).count();
+}
+
+} // namespace
+
+TraceScope::TraceScope(const char *pName, const char *pCategory) noexcept
+    : mName(pName)
+    , mCategory(pCategory)
+    , mTracing(sTracingEnabled.load(std::memory_order_relaxed))
+{
+    if (mTracing) {
+        mStartTime = std::chrono::steady_clock::now();
+    }
+}
+
+TraceScope::~TraceScope()
+{
+    if (!mTracing) {
+        return;
+    }
+
+    const auto endTime {std::chrono::steady_clock::now()};
+    auto &traceBuffer {threadTraceBuffer()};
+    const std::scoped_lock<std::mutex> lock(traceBuffer.mutex);
+
+    if (traceBuffer.events.size() == TraceBuffer::MAXIMUM_EVENT_COUNT) {
+        ++traceBuffer.droppedEventCount;
+
+        return;
+    }
+
+    traceBuffer.events.push_back({mName, mCategory, traceTime(mStartTime), traceTime(endTime) - traceTime(mStartTime)});
+}
+
+bool tracingEnabled() noexcept
+{
+    return sTracingEnabled.load(std::memory_order_relaxed);
+}
+
+void setTracingEnabled(bool pEnabled) noexcept
+{
+    sTracingEnabled.store(pEnabled, std::memory_order_relaxed);
+}
+
+void clearTrace()
+{
+    // Clear the events of all our trace buffers and stop tracking the trace buffers of the threads that have finished.
+
+    const std::scoped_lock<std::mutex> lock(sTraceBuffersMutex);
+
+    for (const auto &traceBuffer : sTraceBuffers) {
+        const std::scoped_lock<std::mutex> traceBufferLock(traceBuffer->mutex);
+
+        traceBuffer->events.clear();
+        traceBuffer->droppedEventCount = 0;
+    }
+
+    std::erase_if(sTraceBuffers, [](const auto &pTraceBuffer) {
+        return pTraceBuffer.use_count() == 1;
+    });
+}
+
+std::string traceJson()
+{
+    // Export the events of all our trace buffers as complete ("X") events, with timestamps and durations in
+    // microseconds, as well as the name of each thread as a metadata ("M") event.
+    // Note: the name and category of an event are string literals that don't need to be escaped.
+
+    static constexpr double NANOSECONDS_PER_MICROSECOND {1000.0};
+
+    std::string res {R"({"displayTimeUnit":"ms","traceEvents":[)"};
+    auto firstEvent {true};
+    auto addEvent = [&](const std::string &pEvent) {
+        if (firstEvent) {
+            firstEvent = false;
+        } else {
+            res += ",";
+        }
+
+        res += pEvent;
+    };
+
+    addEvent(R"({"name":"process_name","ph":"M","pid":1,"tid":0,"args":{"name":"libOpenCOR"}})");
+
+    const std::scoped_lock<std::mutex> lock(sTraceBuffersMutex);
+
+    for (const auto &traceBuffer : sTraceBuffers) {
+        const std::scoped_lock<std::mutex> traceBufferLock(traceBuffer->mutex);
+
+        addEvent(std::format(R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":"Thread {}"}}}})",
+                             traceBuffer->threadId, traceBuffer->threadId));
+
+        for (const auto &event : traceBuffer->events) {
+            addEvent(std::format(R"({{"name":"{}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{}}})",
+                                 event.name, event.category,
+                                 static_cast<double>(event.start) / NANOSECONDS_PER_MICROSECOND,
+                                 static_cast<double>(event.duration) / NANOSECONDS_PER_MICROSECOND,
+                                 traceBuffer->threadId));
+        }
+
+        if (traceBuffer->droppedEventCount != 0) {
+            addEvent(std::format(R"({{"name":"dropped_events","ph":"M","pid":1,"tid":{},"args":{{"count":{}}}}})",
+                                 traceBuffer->threadId, traceBuffer->droppedEventCount));
+        }
+    }
+
+    res += "]}";
+
+    return res;
+}
+
+} // namespace libOpenCOR
@@ -0,0 +1,47 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+
+namespace libOpenCOR {
+
+// A scope that, if tracing is enabled when it is created, records a complete event in the trace buffer of the current
+// thread when it is destroyed.
+// Note: when tracing is disabled, the cost of a scope is that of a relaxed atomic load. Also, the name and category of
+//       an event are not copied, so they must be string literals.
+
+class TraceScope
+{
+public:
+    explicit TraceScope(const char *pName, const char *pCategory) noexcept;
+    ~TraceScope();
+
+    TraceScope(const TraceScope &pOther) = delete;
+    TraceScope(TraceScope &&pOther) noexcept = delete;
+
+    TraceScope &operator=(const TraceScope &pRhs) = delete;
+    TraceScope &operator=(TraceScope &&pRhs) noexcept = delete;
+
+private:
+    const char *mName {nullptr};
+    const char *mCategory {nullptr};
+    std::chrono::steady_clock::time_point mStartTime;
+    bool mTracing {false};
+};
+
+} // namespace libOpenCOR
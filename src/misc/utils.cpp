@@ -23,17 +23,16 @@ limitations under the License.
 #    include "curl/curl.h"
 #endif
 
-#ifdef BUILDING_USING_MSVC
-#    include <process.h>
-#else
-#    include <unistd.h>
-#endif
-
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <cmath>
 #include <cstring>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <mutex>
+#include <random>
 #include <regex>
 #include <sstream>
 
@@ -380,148 +379,511 @@ std::string urlPath(const std::string &pPath)
 #ifndef __EMSCRIPTEN__
 namespace {
 
-using TimeVal = struct
+// The settings of our download cache, which is disabled by default.
+
+std::mutex sDownloadCacheMutex; // NOLINT
+DownloadCacheSettings sDownloadCacheSettings; // NOLINT
+
+// A download, i.e. the URL to download, the contents that we got for it, and the information needed to revalidate a
+// cached copy of it.
+
+struct Download
 {
-    uint64_t seconds;
-    uint64_t microeconds;
+    std::string url;
+    bool res {false};
+    UnsignedChars contents;
+    std::string eTag;
+    std::string lastModified;
+    bool cached {false};
+    bool revalidated {false};
+    UnsignedChars cachedContents;
+    std::string cachedETag;
+    std::string cachedLastModified;
+    curl_slist *headers {nullptr};
 };
 
-void getTimeOfDay(TimeVal &pTimeVal)
+// A cURL session, which is shared by all our downloads. This means that cURL is only initialised once and that DNS
+// lookups, TLS sessions, and connections are cached and reused across downloads (i.e. keep-alive).
+
+class CurlSession
 {
-    // Based off https://stackoverflow.com/a/58162122.
+public:
+    static CurlSession &instance()
+    {
+        static CurlSession instance;
+
+        return instance;
+    }
 
-    const auto duration {std::chrono::system_clock::now().time_since_epoch()};
-    const auto seconds {std::chrono::duration_cast<std::chrono::seconds>(duration)};
+    CurlSession(const CurlSession &pOther) = delete;
+    CurlSession(CurlSession &&pOther) noexcept = delete;
+
+    CurlSession &operator=(const CurlSession &pRhs) = delete;
+    CurlSession &operator=(CurlSession &&pRhs) noexcept = delete;
+
+    CURL *newHandle(Download *pDownload) const
+    {
+        auto *res {curl_easy_init()};
+
+        curl_easy_setopt(res, CURLOPT_FOLLOWLOCATION, 1);
+        curl_easy_setopt(res, CURLOPT_SSL_VERIFYPEER, 0);
+        curl_easy_setopt(res, CURLOPT_URL, encodeUrl(pDownload->url).c_str());
+        curl_easy_setopt(res, CURLOPT_WRITEDATA, static_cast<void *>(pDownload));
+        curl_easy_setopt(res, CURLOPT_WRITEFUNCTION, writeFunction);
+        curl_easy_setopt(res, CURLOPT_HEADERDATA, static_cast<void *>(pDownload));
+        curl_easy_setopt(res, CURLOPT_HEADERFUNCTION, headerFunction);
+        curl_easy_setopt(res, CURLOPT_SHARE, mShare);
+        curl_easy_setopt(res, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(res, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        curl_easy_setopt(res, CURLOPT_PIPEWAIT, 1L);
+
+        // Revalidate our cached copy of the file, if any.
+
+        if (pDownload->cached) {
+            if (!pDownload->cachedETag.empty()) {
+                pDownload->headers = curl_slist_append(pDownload->headers, ("If-None-Match: " + pDownload->cachedETag).c_str());
+            }
+
+            if (!pDownload->cachedLastModified.empty()) {
+                pDownload->headers = curl_slist_append(pDownload->headers, ("If-Modified-Since: " + pDownload->cachedLastModified).c_str());
+            }
 
-    pTimeVal.seconds = static_cast<uint64_t>(seconds.count());
-    pTimeVal.microeconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration - seconds).count());
+            curl_easy_setopt(res, CURLOPT_HTTPHEADER, pDownload->headers);
+        }
+
+        return res;
+    }
+
+private:
+    CURLSH *mShare {nullptr};
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> mMutexes;
+
+    CurlSession()
+    {
+        curl_global_init(CURL_GLOBAL_DEFAULT);
+
+        mShare = curl_share_init();
+
+        curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        curl_share_setopt(mShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+        curl_share_setopt(mShare, CURLSHOPT_LOCKFUNC, lockFunction);
+        curl_share_setopt(mShare, CURLSHOPT_UNLOCKFUNC, unlockFunction);
+        curl_share_setopt(mShare, CURLSHOPT_USERDATA, static_cast<void *>(this));
+    }
+
+    ~CurlSession()
+    {
+        curl_share_cleanup(mShare);
+        curl_global_cleanup();
+    }
+
+    static void lockFunction(CURL *pHandle, curl_lock_data pData, curl_lock_access pAccess, void *pUserData)
+    {
+        (void)pHandle;
+        (void)pAccess;
+
+        static_cast<CurlSession *>(pUserData)->mMutexes[static_cast<size_t>(pData)].lock();
+    }
+
+    static void unlockFunction(CURL *pHandle, curl_lock_data pData, void *pUserData)
+    {
+        (void)pHandle;
+
+        static_cast<CurlSession *>(pUserData)->mMutexes[static_cast<size_t>(pData)].unlock();
+    }
+
+    static size_t writeFunction(char *pData, size_t pSize, size_t pDataSize, void *pUserData)
+    {
+        const auto realDataSize {pSize * pDataSize};
+        auto &contents {static_cast<Download *>(pUserData)->contents};
+
+        contents.insert(contents.end(), pData, pData + realDataSize); // NOLINT
+
+        return realDataSize;
+    }
+
+    static size_t headerFunction(char *pData, size_t pSize, size_t pDataSize, void *pUserData)
+    {
+        // Keep track of the ETag and Last-Modified headers of the last response (we may get several responses if we
+        // are redirected).
+
+        const auto realDataSize {pSize * pDataSize};
+        auto *download {static_cast<Download *>(pUserData)};
+        std::string_view header {pData, realDataSize};
+
+        if (header.starts_with("HTTP/")) {
+            download->eTag.clear();
+            download->lastModified.clear();
+        } else if (auto colon {header.find(':')}; colon != std::string_view::npos) {
+            static constexpr std::string_view WHITESPACES {" \t\r\n"};
+
+            std::string name {header.substr(0, colon)};
+            auto value {header.substr(colon + 1)};
+            auto valueStart {value.find_first_not_of(WHITESPACES)};
+
+            value = (valueStart == std::string_view::npos) ? std::string_view {} : value.substr(valueStart, value.find_last_not_of(WHITESPACES) - valueStart + 1);
+
+            std::ranges::transform(name, name.begin(), [](unsigned char character) {
+                return static_cast<char>(std::tolower(character));
+            });
+
+            if (name == "etag") {
+                download->eTag = value;
+            } else if (name == "last-modified") {
+                download->lastModified = value;
+            }
+        }
+
+        return realDataSize;
+    }
+};
+
+std::filesystem::path cacheFilePath(const std::filesystem::path &pCacheDirectory, const std::string &pUrl,
+                                    const char *pExtension)
+{
+    return pCacheDirectory / std::format("{:016x}.{}", std::hash<std::string> {}(pUrl), pExtension);
 }
 
-std::filesystem::path uniqueFilePath()
+void retrieveCachedFile(const std::filesystem::path &pCacheDirectory, Download &pDownload)
 {
-    // This is based off glibc's __gen_tempname() method, which is used in std::tmpfile(). The only reason we don't use
-    // std::tmpfile() is that it creates the file for us and as soon as we would be closing (though an automatic call
-    // to std::fclose()), the file would get automatically deleted, which is not what we want. See
-    // https://code.woboq.org/userspace/glibc/sysdeps/posix/tempname.c.html#__gen_tempname.
+    // Retrieve the cached copy of the given download, if any, making sure that it is for the right URL. Our cache
+    // consists of a data file, i.e. the contents of the downloaded file, and a meta file, which contains the URL, ETag,
+    // Last-Modified value, and size of the downloaded file, each on its own line.
+    // Note: the size of the downloaded file allows us to detect a data file that doesn't go with its meta file (e.g.,
+    //       if another process updated our cache in between our reading of the meta file and of the data file).
+
+    std::ifstream metaFile(cacheFilePath(pCacheDirectory, pDownload.url, "meta"));
+    std::string url;
+    std::string cachedETag;
+    std::string cachedLastModified;
+    std::string size;
+
+    if (!metaFile.is_open() || !std::getline(metaFile, url) || (url != pDownload.url)
+        || !std::getline(metaFile, cachedETag) || !std::getline(metaFile, cachedLastModified)
+        || !std::getline(metaFile, size)) {
+        return;
+    }
 
-    // The number of times to attempt to generate a temporary file name.
-    // Note: ATTEMPTS_MIN is equal to 62x62x62 where 62 is the number of characters in LETTERS.
+    auto cachedContents {fileContents(cacheFilePath(pCacheDirectory, pDownload.url, "data"))};
 
-#    ifndef CODE_COVERAGE_ENABLED
-    static constexpr uint64_t ATTEMPTS_MIN {238328U};
-    static constexpr uint64_t MAX_ATTEMPTS {(ATTEMPTS_MIN < TMP_MAX) ? TMP_MAX : ATTEMPTS_MIN};
-#    endif
+    if (std::to_string(cachedContents.size()) != size) {
+        return;
+    }
 
-    // Get some more or less random data.
+    pDownload.cached = true;
+    pDownload.cachedContents = std::move(cachedContents);
+    pDownload.cachedETag = std::move(cachedETag);
+    pDownload.cachedLastModified = std::move(cachedLastModified);
+}
 
-    static const std::string LETTERS {"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"};
-    static const uint64_t LETTERS_SIZE {LETTERS.size()};
+void touchCachedFile(const std::filesystem::path &pCacheDirectory, const Download &pDownload)
+{
+    // Mark the cached copy of the given download as having just been used, so that it is not among the first ones to
+    // be evicted from our cache.
 
-    static auto testFile {pathToString(std::filesystem::temp_directory_path() / "libOpenCOR_XXXXXX.tmp")};
+    std::error_code errorCode;
 
-    static const size_t XXXXXX_POS {testFile.size() - 6 - 4};
-    static constexpr uint64_t MICROSECONDS_SHIFT {16U};
-    static constexpr uint64_t PID_SHIFT {32U};
-#    ifndef CODE_COVERAGE_ENABLED
-    static constexpr uint64_t VALUE_SHIFT {7777U};
-#    endif
-    static constexpr uint64_t XXXXXX_POS_SHIFT {6U};
+    std::filesystem::last_write_time(cacheFilePath(pCacheDirectory, pDownload.url, "data"),
+                                     std::filesystem::file_time_type::clock::now(), errorCode);
+}
 
-    TimeVal timeVal;
+void removeCachedFile(const std::filesystem::path &pCacheDirectory, const Download &pDownload)
+{
+    // Remove the cached copy of the given download, starting with its meta file so that its data file cannot be used
+    // anymore.
 
-    getTimeOfDay(timeVal);
+    std::error_code errorCode;
 
-    auto value {(timeVal.microeconds << MICROSECONDS_SHIFT) ^ timeVal.seconds};
+    std::filesystem::remove(cacheFilePath(pCacheDirectory, pDownload.url, "meta"), errorCode);
+    std::filesystem::remove(cacheFilePath(pCacheDirectory, pDownload.url, "data"), errorCode);
+}
 
-#    ifdef BUILDING_USING_MSVC
-    value ^= static_cast<uint64_t>(_getpid()) << PID_SHIFT;
-#    else
-    value ^= static_cast<uint64_t>(getpid()) << PID_SHIFT;
-#    endif
+bool writeCacheFile(const std::filesystem::path &pFilePath, const char *pData, size_t pSize)
+{
+    // Write the given data to a temporary file next to the given file and then rename it to the given file, so that
+    // the given file is never seen partially written, be it because we get interrupted or by another process.
+    // Note: a temporary file may be left behind if we get interrupted, hence evictCachedFiles() removes old ones.
 
-    std::string res;
+    static constexpr auto RANDOM_NUMBER_SHIFT {32U};
+
+    std::random_device randomDevice;
+    auto temporaryFilePath {pFilePath};
+
+    temporaryFilePath += std::format(".{:016x}.tmp", (static_cast<uint64_t>(randomDevice()) << RANDOM_NUMBER_SHIFT) | randomDevice());
+
+    std::error_code errorCode;
+
+    {
+        std::ofstream file(temporaryFilePath, std::ios_base::binary);
+
+        file.write(pData, static_cast<std::streamsize>(pSize));
+        file.close();
+
+        if (file.fail()) {
+            std::filesystem::remove(temporaryFilePath, errorCode);
+
+            return false;
+        }
+    }
+
+    std::filesystem::rename(temporaryFilePath, pFilePath, errorCode);
+
+    if (errorCode) {
+        std::filesystem::remove(temporaryFilePath, errorCode);
+
+        return false;
+    }
+
+    return true;
+}
+
+void cacheFile(const std::filesystem::path &pCacheDirectory, const Download &pDownload)
+{
+    // Cache the given download, but only if it can be revalidated.
+    // Note: we write our data file before our meta file. This means that, should we fail or get interrupted in
+    //       between, the old meta file, if any, goes with some new data, something that is detected by
+    //       retrieveCachedFile() since the size of the data doesn't match. Otherwise, the new ETag/Last-Modified would
+    //       go with some old data, which would then be served on a 304.
+
+    std::error_code errorCode;
+
+    std::filesystem::create_directories(pCacheDirectory, errorCode);
+
+    if (!writeCacheFile(cacheFilePath(pCacheDirectory, pDownload.url, "data"),
+                        reinterpret_cast<const char *>(pDownload.contents.data()), pDownload.contents.size())) { // NOLINT
+        removeCachedFile(pCacheDirectory, pDownload);
+
+        return;
+    }
+
+    const auto meta {std::format("{}\n{}\n{}\n{}\n", pDownload.url, pDownload.eTag, pDownload.lastModified, pDownload.contents.size())};
+
+    if (!writeCacheFile(cacheFilePath(pCacheDirectory, pDownload.url, "meta"), meta.data(), meta.size())) {
+        removeCachedFile(pCacheDirectory, pDownload);
+    }
+}
+
+void evictCachedFiles(const std::filesystem::path &pCacheDirectory, size_t pSizeLimit)
+{
+    // Evict the least recently used files from our cache until its size is within the given limit, as well as the
+    // temporary files that may have been left behind by an interrupted cacheFile() call.
 
-#    ifndef CODE_COVERAGE_ENABLED
-    for (uint64_t attempt {0}; attempt < MAX_ATTEMPTS; value += VALUE_SHIFT, ++attempt) {
-#    endif
-        uint64_t val {value};
+    static constexpr std::chrono::hours TEMPORARY_FILE_LIFETIME {1};
 
-        for (uint64_t i {0}; i < XXXXXX_POS_SHIFT; ++i) {
-            testFile[XXXXXX_POS + i] = LETTERS[val % LETTERS_SIZE];
-            val /= LETTERS_SIZE;
+    std::vector<std::tuple<std::filesystem::file_time_type, std::filesystem::path, uintmax_t>> dataFiles;
+    uintmax_t cacheSize {0};
+    std::error_code errorCode;
+
+    const auto now {std::filesystem::file_time_type::clock::now()};
+
+    for (const auto &entry : std::filesystem::directory_iterator(pCacheDirectory, errorCode)) {
+        if ((entry.path().extension() == ".tmp") && (now - entry.last_write_time(errorCode) > TEMPORARY_FILE_LIFETIME)) {
+            std::filesystem::remove(entry.path(), errorCode);
+        } else if (entry.path().extension() == ".data") {
+            auto dataFileSize {entry.file_size(errorCode)};
+
+            dataFiles.emplace_back(entry.last_write_time(errorCode), entry.path(), dataFileSize);
+
+            cacheSize += dataFileSize;
         }
+    }
 
-#    ifndef CODE_COVERAGE_ENABLED
-        if (!std::filesystem::exists(testFile)) {
-#    endif
-            res = testFile;
+    std::ranges::sort(dataFiles);
 
-#    ifndef CODE_COVERAGE_ENABLED
+    for (const auto &[lastWriteTime, dataFilePath, dataFileSize] : dataFiles) {
+        if (cacheSize <= pSizeLimit) {
             break;
         }
+
+        auto metaFilePath {dataFilePath};
+
+        std::filesystem::remove(dataFilePath, errorCode);
+        std::filesystem::remove(metaFilePath.replace_extension(".meta"), errorCode);
+
+        cacheSize -= dataFileSize;
     }
-#    endif
+}
 
-    return res;
+} // namespace
+
+DownloadCacheSettings downloadCacheSettings()
+{
+    const std::scoped_lock lock(sDownloadCacheMutex);
+
+    return sDownloadCacheSettings;
 }
 
-size_t curlWriteFunction(char *pData, size_t pSize, size_t pDataSize, void *pUserData)
+// Note: our download cache settings are set one at a time, and under our mutex, so that concurrent calls to different
+//       setters cannot overwrite each other's value.
+
+void setDownloadCacheDirectory(const std::filesystem::path &pDirectory)
 {
-    const auto realDataSize {pSize * pDataSize};
+    const std::scoped_lock lock(sDownloadCacheMutex);
 
-    static_cast<std::ofstream *>(pUserData)->write(pData, static_cast<std::streamsize>(realDataSize));
+    sDownloadCacheSettings.directory = pDirectory;
+}
 
-    return realDataSize;
+void setDownloadCacheSizeLimit(size_t pSizeLimit)
+{
+    const std::scoped_lock lock(sDownloadCacheMutex);
+
+    sDownloadCacheSettings.sizeLimit = pSizeLimit;
 }
 
-} // namespace
+void setDownloadCacheOffline(bool pOffline)
+{
+    const std::scoped_lock lock(sDownloadCacheMutex);
+
+    sDownloadCacheSettings.offline = pOffline;
+}
 
-std::tuple<bool, std::filesystem::path> downloadFile(const std::string &pUrl)
+std::filesystem::path downloadedFilePath(const std::string &pUrl)
 {
-    static const std::tuple<bool, std::filesystem::path> NO_TUPLE {false, std::filesystem::path()};
+    // Return a file path that is unique to the given URL.
 
-    auto filePath {uniqueFilePath()};
-    std::ofstream file(filePath, std::ios_base::binary);
+    return std::filesystem::temp_directory_path() / std::format("libOpenCOR_{:016x}.tmp", std::hash<std::string> {}(pUrl));
+}
 
-#    ifndef CODE_COVERAGE_ENABLED
-    if (!file.is_open()) {
-        return NO_TUPLE;
+std::tuple<bool, UnsignedChars> downloadFileContents(const std::string &pUrl)
+{
+    return downloadFilesContents({pUrl})[0];
+}
+
+std::vector<std::tuple<bool, UnsignedChars>> downloadFilesContents(const Strings &pUrls)
+{
+    // Download the contents of the given URLs straight into memory and in parallel, multiplexing them over the same
+    // HTTP/2 connection whenever possible. If our download cache is enabled then we use the cached copy of a file,
+    // revalidating it first unless we are offline. If we are offline then we only use our download cache.
+
+    static constexpr int64_t HTTP_OK {200};
+    static constexpr int64_t HTTP_NOT_MODIFIED {304};
+    static constexpr int POLL_TIMEOUT {1000};
+
+    auto settings {downloadCacheSettings()};
+    auto useCache {!settings.directory.empty()};
+    std::vector<Download> downloads(pUrls.size());
+
+    if (useCache) {
+        const std::scoped_lock lock(sDownloadCacheMutex);
+
+        for (size_t i {0}; i < pUrls.size(); ++i) {
+            downloads[i].url = pUrls[i];
+
+            retrieveCachedFile(settings.directory, downloads[i]);
+        }
+    } else {
+        for (size_t i {0}; i < pUrls.size(); ++i) {
+            downloads[i].url = pUrls[i];
+        }
     }
-#    endif
 
-    curl_global_init(CURL_GLOBAL_DEFAULT);
+    if (!settings.offline) {
+        auto &curlSession {CurlSession::instance()};
+        std::vector<CURL *> handles;
+        auto *multiHandle {curl_multi_init()};
 
-    auto res {false};
-    auto *curl {curl_easy_init()};
+        handles.reserve(downloads.size());
 
-    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1);
-    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0);
-    curl_easy_setopt(curl, CURLOPT_URL, encodeUrl(pUrl).c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, static_cast<void *>(&file));
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, curlWriteFunction);
+        curl_multi_setopt(multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
 
-    if (curl_easy_perform(curl) == CURLE_OK) {
-        static constexpr int64_t HTTP_OK {200};
+        for (auto &download : downloads) {
+            auto *handle {curlSession.newHandle(&download)};
 
-        int64_t responseCode {0};
+            curl_multi_add_handle(multiHandle, handle);
 
-        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
+            handles.push_back(handle);
+        }
 
-        res = responseCode == HTTP_OK;
-    }
+        int runningHandles {0};
+
+        do {
+            if (curl_multi_perform(multiHandle, &runningHandles) != CURLM_OK) {
+                break;
+            }
+
+            if (runningHandles != 0) {
+                curl_multi_poll(multiHandle, nullptr, 0, POLL_TIMEOUT, nullptr);
+            }
+        } while (runningHandles != 0);
+
+        // Check which downloads were successful, using our cached copy of a file if it hasn't been modified.
+
+        CURLMsg *message {nullptr};
+        int messageCount {0};
 
-    curl_easy_cleanup(curl);
-    curl_global_cleanup();
+        while ((message = curl_multi_info_read(multiHandle, &messageCount)) != nullptr) {
+            if ((message->msg == CURLMSG_DONE) && (message->data.result == CURLE_OK)) {
+                int64_t responseCode {0};
+                auto &download {downloads[static_cast<size_t>(std::ranges::find(handles, message->easy_handle) - handles.begin())]};
 
-    file.close();
+                curl_easy_getinfo(message->easy_handle, CURLINFO_RESPONSE_CODE, &responseCode);
 
-    if (res) {
-        return {true, filePath};
+                if (responseCode == HTTP_OK) {
+                    download.res = true;
+                } else if ((responseCode == HTTP_NOT_MODIFIED) && download.cached) {
+                    download.res = true;
+                    download.revalidated = true;
+                    download.contents = std::move(download.cachedContents);
+                    download.eTag.clear();
+                    download.lastModified.clear();
+                }
+            }
+        }
+
+        for (size_t i {0}; i < handles.size(); ++i) {
+            curl_multi_remove_handle(multiHandle, handles[i]);
+            curl_easy_cleanup(handles[i]);
+            curl_slist_free_all(downloads[i].headers);
+        }
+
+        curl_multi_cleanup(multiHandle);
+    } else {
+        for (auto &download : downloads) {
+            if (download.cached) {
+                download.res = true;
+                download.contents = std::move(download.cachedContents);
+            }
+        }
     }
 
-    std::filesystem::remove(filePath);
+    // Update our download cache, if needed, i.e. cache the files that we have just downloaded (rather than revalidated),
+    // mark the ones that we have revalidated or used offline as having just been used, and remove the ones that we
+    // have just downloaded but cannot be revalidated (since their cached copy is now stale).
+
+    if (useCache) {
+        const std::scoped_lock lock(sDownloadCacheMutex);
+
+        for (const auto &download : downloads) {
+            if (download.res) {
+                if (!download.eTag.empty() || !download.lastModified.empty()) {
+                    cacheFile(settings.directory, download);
+                } else if (download.revalidated || settings.offline) {
+                    touchCachedFile(settings.directory, download);
+                } else if (download.cached) {
+                    removeCachedFile(settings.directory, download);
+                }
+            }
+        }
+
+        evictCachedFiles(settings.directory, settings.sizeLimit);
+    }
 
-    return NO_TUPLE;
+    // Return the contents of our downloads, making sure that the contents of a failed download is empty.
+
+    std::vector<std::tuple<bool, UnsignedChars>> res;
+
+    res.reserve(downloads.size());
+
+    for (auto &download : downloads) {
+        if (!download.res) {
+            download.contents.clear();
+        }
+
+        res.emplace_back(download.res, std::move(download.contents));
+    }
+
+    return res;
 }
 
 UnsignedChars fileContents(const std::filesystem::path &pFilePath)
@@ -552,6 +914,13 @@ bool isInfOrNan(double pNumber)
     return std::isinf(pNumber) || std::isnan(pNumber);
 }
 
+double elapsedTime(const TimePoint &pStartTime)
+{
+    // Return the time elapsed since the given start time, in milliseconds.
+
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - pStartTime).count();
+}
+
 bool toBool(const std::string &pString)
 {
     return pString == "true";
@@ -628,11 +997,31 @@ std::string toString(double pNumber)
     return res.str();
 }
 
-std::string toString(const UnsignedChars &pBytes)
+std::string toString(std::span<const unsigned char> pBytes)
 {
     return {reinterpret_cast<const char *>(pBytes.data()), pBytes.size()};
 }
 
+void appendBytes(UnsignedChars &pBytes, const void *pData, size_t pSize)
+{
+    const auto *data {static_cast<const unsigned char *>(pData)};
+
+    pBytes.insert(pBytes.end(), data, data + pSize); // NOLINT
+}
+
+bool extractBytes(std::span<const unsigned char> pBytes, size_t &pOffset, void *pData, size_t pSize)
+{
+    if ((pOffset > pBytes.size()) || (pSize > pBytes.size() - pOffset)) {
+        return false;
+    }
+
+    std::memcpy(pData, pBytes.data() + pOffset, pSize); // NOLINT
+
+    pOffset += pSize;
+
+    return true;
+}
+
 const xmlChar *toConstXmlCharPtr(const std::string &pString)
 {
     return reinterpret_cast<const xmlChar *>(pString.c_str());
@@ -653,4 +1042,23 @@ std::string name(const libcellml::VariablePtr &pVariable)
     return name(owningComponent(pVariable)->name(), pVariable->name());
 }
 
+#ifdef __EMSCRIPTEN__
+// clang-format off
+EM_JS(intptr_t, toFloat64ArrayJS, (const void* data, size_t size), {
+    if (size === 0) {
+        return Emval.toHandle(new Float64Array(0));
+    }
+
+    return Emval.toHandle(new Float64Array(HEAPU8.subarray(data, data + 8 * size).buffer, data, size));
+    // Note: we use HEAPU8.subarray() to create a view over the WASM heap's Float64Array buffer because it is safer than
+    //       accessing HEAPU8.buffer directly in case the WASM heap was ever to grow (we don't allow this to happen, but
+    //       it is still safer to use HEAPU8.subarray()) since it creates a view with the correct byte offset.
+}); // clang-format on
+
+emscripten::val toFloat64Array(std::span<const double> pData)
+{
+    return emscripten::val::take_ownership(reinterpret_cast<emscripten::EM_VAL>(toFloat64ArrayJS(pData.data(), pData.size())));
+}
+#endif
+
 } // namespace libOpenCOR
@@ -22,10 +22,16 @@ limitations under the License.
 
 #include "libxml/xmlstring.h"
 
+#ifdef __EMSCRIPTEN__
+#    include <emscripten/val.h>
+#endif
+
 #ifndef NDEBUG
 #    include <cassert>
 #endif
+#include <chrono>
 #include <filesystem>
+#include <span>
 #include <unordered_map>
 #include <libcellml>
 
@@ -45,6 +51,7 @@ static constexpr auto INF {std::numeric_limits<double>::infinity()};
 static constexpr auto NAN {std::numeric_limits<double>::quiet_NaN()};
 
 using StringStringMap = std::unordered_map<std::string, std::string>;
+using TimePoint = std::chrono::high_resolution_clock::time_point;
 
 #if defined(NDEBUG) || defined(CODE_COVERAGE_ENABLED)
 #    define ASSERT_EQ(x, y) \
@@ -102,13 +109,31 @@ std::string relativePath(const std::string &pPath, const std::string &pBasePath)
 std::string urlPath(const std::string &pPath);
 
 #ifndef __EMSCRIPTEN__
-std::tuple<bool, std::filesystem::path> downloadFile(const std::string &pUrl);
+struct DownloadCacheSettings
+{
+    static constexpr size_t DEFAULT_SIZE_LIMIT {100 * 1024 * 1024};
+
+    std::filesystem::path directory;
+    size_t sizeLimit {DEFAULT_SIZE_LIMIT};
+    bool offline {false};
+};
+
+DownloadCacheSettings downloadCacheSettings();
+void setDownloadCacheDirectory(const std::filesystem::path &pDirectory);
+void setDownloadCacheSizeLimit(size_t pSizeLimit);
+void setDownloadCacheOffline(bool pOffline);
+
+std::filesystem::path downloadedFilePath(const std::string &pUrl);
+std::tuple<bool, UnsignedChars> downloadFileContents(const std::string &pUrl);
+std::vector<std::tuple<bool, UnsignedChars>> downloadFilesContents(const Strings &pUrls);
 
 UnsignedChars LIBOPENCOR_UNIT_TESTING_EXPORT fileContents(const std::filesystem::path &pFilePath);
 #endif
 
 bool LIBOPENCOR_UNIT_TESTING_EXPORT isInfOrNan(double pNumber);
 
+double elapsedTime(const TimePoint &pStartTime);
+
 bool toBool(const std::string &pString);
 std::string toString(bool pBoolean);
 
@@ -122,7 +147,10 @@ bool isDouble(const std::string &pString);
 double toDouble(const std::string &pString);
 std::string toString(double pNumber);
 
-std::string LIBOPENCOR_UNIT_TESTING_EXPORT toString(const UnsignedChars &pBytes);
+std::string LIBOPENCOR_UNIT_TESTING_EXPORT toString(std::span<const unsigned char> pBytes);
+
+void appendBytes(UnsignedChars &pBytes, const void *pData, size_t pSize);
+bool extractBytes(std::span<const unsigned char> pBytes, size_t &pOffset, void *pData, size_t pSize);
 
 const xmlChar *toConstXmlCharPtr(const std::string &pString);
 
@@ -131,4 +159,8 @@ libcellml::ComponentPtr owningComponent(const libcellml::VariablePtr &pVariable)
 std::string name(const std::string &pComponentName, const std::string &pVariableName);
 std::string name(const libcellml::VariablePtr &pVariable);
 
+#ifdef __EMSCRIPTEN__
+emscripten::val toFloat64Array(std::span<const double> pData);
+#endif
+
 } // namespace libOpenCOR
@@ -28,6 +28,7 @@ SedChangeAttribute::Impl::Impl(const std::string &pComponentName, const std::str
     : mComponentName(pComponentName)
     , mVariableName(pVariableName)
     , mNewValue(pNewValue)
+    , mNewDoubleValue(toDouble(pNewValue))
 {
     updateTarget();
 }
@@ -39,6 +40,8 @@ void SedChangeAttribute::Impl::setTarget(const std::string &pTarget)
 
 void SedChangeAttribute::Impl::updateTarget()
 {
+    mName = name(mComponentName, mVariableName);
+
     setTarget("/cellml:model/cellml:component[@name='" + mComponentName + "']/cellml:variable[@name='" + mVariableName + "']");
 }
 
@@ -74,6 +77,7 @@ const std::string &SedChangeAttribute::Impl::newValue() const
 void SedChangeAttribute::Impl::setNewValue(const std::string &pNewValue)
 {
     mNewValue = pNewValue;
+    mNewDoubleValue = toDouble(pNewValue);
 }
 
 void SedChangeAttribute::Impl::serialise(xmlNodePtr pNode) const
@@ -105,95 +109,60 @@ void SedChangeAttribute::Impl::apply(const SedInstanceTaskPtr &pInstanceTask,
         warning += pComponentName;
         warning += "' cannot be changed. Only state variables and constants can be changed.";
 
-        addWarning(warning);
+        addWarning(std::move(warning));
     };
 
-    auto *instanceTaskPimpl {pInstanceTask->pimpl()};
-    auto changeName {name(mComponentName, mVariableName)};
-    const auto stateCount = instanceTaskPimpl->stateCount();
-    const auto constantCount = instanceTaskPimpl->constantCount();
-    const auto computedConstantCount = instanceTaskPimpl->computedConstantCount();
-    const auto algebraicVariableCount = instanceTaskPimpl->algebraicVariableCount();
-
-    if (instanceTaskPimpl->voiName() == changeName) {
-        auto voiVariable {pAnalyserModel->voi()->variable()};
-        auto voiComponent {owningComponent(voiVariable)};
+    // Look up our variable, using the variable map of our runtime, and set its value, if possible.
 
-        addCannotChangeWarning(voiVariable->name(), voiComponent->name(), "variable of integration");
+    const auto *instanceTaskPimpl {pInstanceTask->pimpl()};
+    const auto *variableInfo {instanceTaskPimpl->mRuntime->variableInfo(mName)};
 
-        return;
-    }
+    if (variableInfo == nullptr) {
+        std::string warning;
 
-    auto isParameterSet {false};
+        warning.reserve(mVariableName.size() + mComponentName.size() + 72); // NOLINT
 
-    for (size_t i {0}; i < stateCount; ++i) {
-        if (instanceTaskPimpl->stateName(i) == changeName) {
-            instanceTaskPimpl->mStates[i] = toDouble(newValue()); // NOLINT
+        warning += "The variable '";
+        warning += mVariableName;
+        warning += "' in component '";
+        warning += mComponentName;
+        warning += "' could not be found and therefore could not be changed.";
 
-            isParameterSet = true;
+        addWarning(std::move(warning));
 
-            break;
-        }
+        return;
     }
 
-    if (!isParameterSet) {
-        for (size_t i {0}; i < constantCount; ++i) {
-            if (instanceTaskPimpl->constantName(i) == changeName) {
-                instanceTaskPimpl->mConstants[i] = toDouble(newValue()); // NOLINT
+    switch (variableInfo->type) {
+    case CellmlFileRuntime::VariableType::VARIABLE_OF_INTEGRATION: {
+        auto voiVariable {pAnalyserModel->voi()->variable()};
 
-                isParameterSet = true;
+        addCannotChangeWarning(voiVariable->name(), owningComponent(voiVariable)->name(), "variable of integration");
 
-                break;
-            }
-        }
+        break;
     }
+    case CellmlFileRuntime::VariableType::STATE:
+        instanceTaskPimpl->mStates[variableInfo->index] = mNewDoubleValue; // NOLINT
 
-    if (!isParameterSet) {
-        const auto &computedConstants = pAnalyserModel->computedConstants();
-
-        for (size_t i {0}; i < computedConstantCount; ++i) {
-            if (instanceTaskPimpl->computedConstantName(i) == changeName) {
-                auto computedConstantVariable {computedConstants[i]->variable()};
-                auto computedConstantComponent {owningComponent(computedConstantVariable)};
+        break;
+    case CellmlFileRuntime::VariableType::CONSTANT:
+        instanceTaskPimpl->mConstants[variableInfo->index] = mNewDoubleValue; // NOLINT
 
-                addCannotChangeWarning(computedConstantVariable->name(), computedConstantComponent->name(), "computed constant");
+        break;
+    case CellmlFileRuntime::VariableType::COMPUTED_CONSTANT: {
+        auto computedConstantVariable {pAnalyserModel->computedConstants()[variableInfo->index]->variable()};
 
-                isParameterSet = true;
+        addCannotChangeWarning(computedConstantVariable->name(), owningComponent(computedConstantVariable)->name(), "computed constant");
 
-                break;
-            }
-        }
+        break;
     }
+    case CellmlFileRuntime::VariableType::ALGEBRAIC_VARIABLE: {
+        auto algebraicVariable {pAnalyserModel->algebraicVariables()[variableInfo->index]->variable()};
 
-    if (!isParameterSet) {
-        const auto &algebraicVariables = pAnalyserModel->algebraicVariables();
+        addCannotChangeWarning(algebraicVariable->name(), owningComponent(algebraicVariable)->name(), "algebraic variable");
 
-        for (size_t i {0}; i < algebraicVariableCount; ++i) {
-            if (instanceTaskPimpl->algebraicVariableName(i) == changeName) {
-                auto algebraicVariable {algebraicVariables[i]->variable()};
-                auto algebraicComponent {owningComponent(algebraicVariable)};
-
-                addCannotChangeWarning(algebraicVariable->name(), algebraicComponent->name(), "algebraic variable");
-
-                isParameterSet = true;
-
-                break;
-            }
-        }
+        break;
     }
-
-    if (!isParameterSet) {
-        std::string warning;
-
-        warning.reserve(mVariableName.size() + mComponentName.size() + 72); // NOLINT
-
-        warning += "The variable '";
-        warning += mVariableName;
-        warning += "' in component '";
-        warning += mComponentName;
-        warning += "' could not be found and therefore could not be changed.";
-
-        addWarning(warning);
     }
 }
 
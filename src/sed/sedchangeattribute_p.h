@@ -18,6 +18,8 @@ limitations under the License.
 
 #include "sedchange_p.h"
 
+#include "utils.h"
+
 #include "libopencor/sedchangeattribute.h"
 #include "libopencor/sedinstancetask.h"
 
@@ -29,6 +31,8 @@ public:
     std::string mComponentName;
     std::string mVariableName;
     std::string mNewValue;
+    std::string mName;
+    double mNewDoubleValue {NAN};
 
     explicit Impl(const std::string &pComponent, const std::string &pVariable, const std::string &pNewValue);
 
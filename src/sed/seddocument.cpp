@@ -16,6 +16,7 @@ limitations under the License.
 
 #include "file_p.h"
 #include "seddocument_p.h"
+#include "sedensemble_p.h"
 #include "sedinstance_p.h"
 #include "sedmodel_p.h"
 #include "sedsimulation_p.h"
@@ -610,4 +611,9 @@ SedInstancePtr SedDocument::instantiate()
     return SedInstance::Impl::create(shared_from_this());
 }
 
+SedEnsemblePtr SedDocument::instantiateEnsemble(const Strings &pParameterNames, const Doubles &pParameterValues)
+{
+    return SedEnsemble::Impl::create(shared_from_this(), pParameterNames, pParameterValues);
+}
+
 } // namespace libOpenCOR
@@ -0,0 +1,685 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "sedensemble_p.h"
+#include "sedinstancetask_p.h"
+#include "solverode_p.h"
+
+#include "libopencor/seddocument.h"
+#include "libopencor/sedinstance.h"
+#include "libopencor/solverodefixedstep.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <thread>
+
+namespace libOpenCOR {
+
+SedEnsemblePtr SedEnsemble::Impl::create(const SedDocumentPtr &pDocument, const Strings &pParameterNames,
+                                         const Doubles &pParameterValues)
+{
+    return SedEnsemblePtr {new SedEnsemble(pDocument, pParameterNames, pParameterValues)};
+}
+
+SedEnsemble::Impl::Impl(const SedDocumentPtr &pDocument, const Strings &pParameterNames, const Doubles &pParameterValues)
+    : Logger::Impl()
+    , mParameterNames(pParameterNames)
+    , mParameterValues(pParameterValues)
+{
+    // Make sure that our simulation experiment description has only one task and that it can be instantiated.
+
+    if (pDocument->taskCount() != 1) {
+        addError("An ensemble can only be created for a simulation experiment description with one task.");
+
+        return;
+    }
+
+    mInstance = pDocument->instantiate();
+
+    if (mInstance->hasIssues()) {
+        addIssues(mInstance, "Instance");
+
+        if (mInstance->hasErrors()) {
+            mEnsembleIssues = issuesSnapshot();
+
+            return;
+        }
+    }
+
+    // Make sure that our task is for an ODE model that is simulated using a uniform time course.
+
+    mInstanceTask = mInstance->tasks()[0];
+
+    auto *instanceTaskPimpl {mInstanceTask->pimpl()};
+
+    if ((instanceTaskPimpl->mAnalyserModel->type() != libcellml::AnalyserModel::Type::ODE)
+        || (instanceTaskPimpl->mSedUniformTimeCourse == nullptr)) {
+        addError("An ensemble can only be created for an ODE model that is simulated using a uniform time course.");
+
+        mEnsembleIssues = issuesSnapshot();
+
+        return;
+    }
+
+    // Determine which states and/or constants our parameters are.
+
+    mParameters.reserve(mParameterNames.size());
+
+    for (const auto &parameterName : mParameterNames) {
+        const auto *variableInfo {instanceTaskPimpl->mRuntime->variableInfo(parameterName)};
+
+        if ((variableInfo == nullptr)
+            || ((variableInfo->type != CellmlFileRuntime::VariableType::STATE)
+                && (variableInfo->type != CellmlFileRuntime::VariableType::CONSTANT))) {
+            std::string error;
+
+            error.reserve(parameterName.size() + 54); // NOLINT
+
+            error += "The parameter '";
+            error += parameterName;
+            error += "' is neither a state nor a constant.";
+
+            addError(std::move(error));
+        } else {
+            mParameters.push_back({variableInfo->type == CellmlFileRuntime::VariableType::STATE, variableInfo->index});
+        }
+    }
+
+    if (hasErrors()) {
+        mEnsembleIssues = issuesSnapshot();
+
+        return;
+    }
+
+    // Make sure that we have some parameter values and that there are as many of them for each member.
+
+    const auto parameterCount {mParameters.size()};
+
+    if ((parameterCount == 0) || mParameterValues.empty() || ((mParameterValues.size() % parameterCount) != 0)) {
+        const auto parameterValueCount {toString(mParameterValues.size())};
+        const auto parameterCountString {toString(parameterCount)};
+        std::string error;
+
+        error.reserve(parameterValueCount.size() + parameterCountString.size() + 93); // NOLINT
+
+        error += "The number of parameter values (";
+        error += parameterValueCount;
+        error += ") must be a non-zero multiple of the number of parameters (";
+        error += parameterCountString;
+        error += ").";
+
+        addError(std::move(error));
+
+        mEnsembleIssues = issuesSnapshot();
+
+        return;
+    }
+
+    mMemberCount = mParameterValues.size() / parameterCount;
+
+    // Keep track of our runtime and ODE solver, and of our model and simulation settings.
+
+    mRuntime = instanceTaskPimpl->mRuntime;
+    mOdeSolver = instanceTaskPimpl->mOdeSolver;
+
+    mStateCount = instanceTaskPimpl->mStateCount;
+    mConstantCount = instanceTaskPimpl->mConstantCount;
+    mComputedConstantCount = instanceTaskPimpl->mComputedConstantCount;
+    mAlgebraicVariableCount = instanceTaskPimpl->mAlgebraicVariableCount;
+
+    const auto &sedUniformTimeCourse {instanceTaskPimpl->mSedUniformTimeCourse};
+
+    mInitialTime = sedUniformTimeCourse->initialTime();
+    mOutputStartTime = sedUniformTimeCourse->outputStartTime();
+    mOutputEndTime = sedUniformTimeCourse->outputEndTime();
+    mNumberOfSteps = static_cast<size_t>(sedUniformTimeCourse->numberOfSteps());
+
+    // Use an ensemble runtime if our ODE solver is a fixed-step solver. Indeed, the members of a block of lanes can then
+    // be integrated in lock step since a fixed-step solver only updates our states element-wise. Otherwise, we integrate
+    // our members one at a time.
+
+    if (std::dynamic_pointer_cast<SolverOdeFixedStep>(mOdeSolver) != nullptr) {
+        mEnsembleRuntime = instanceTaskPimpl->mCellmlFile->ensembleRuntime(ENSEMBLE_WIDTH);
+
+        if (!mEnsembleRuntime->hasErrors()) {
+            mLaneCount = ENSEMBLE_WIDTH;
+        }
+    }
+
+    mBlockCount = (mMemberCount + mLaneCount - 1) / mLaneCount;
+
+    // Allocate the data of all our members in one contiguous block of memory, which we split in one region per kind of
+    // variable. Within a region, the data of a block of lanes is contiguous and laid out as a structure of arrays, i.e.
+    // the value of the i-th variable in the j-th lane is at index i*W+j, where W is the number of lanes.
+
+    const auto laneMemberCount {mBlockCount * mLaneCount};
+
+    mArena.resize(laneMemberCount * (2 * mStateCount + mConstantCount + mComputedConstantCount + mAlgebraicVariableCount));
+
+    mStates = mArena.data();
+    mRates = mStates + laneMemberCount * mStateCount; // NOLINT
+    mConstants = mRates + laneMemberCount * mStateCount; // NOLINT
+    mComputedConstants = mConstants + laneMemberCount * mConstantCount; // NOLINT
+    mAlgebraicVariables = mComputedConstants + laneMemberCount * mComputedConstantCount; // NOLINT
+
+    // Allocate our results, also in one contiguous block of memory, with the results of a given member being contiguous.
+
+    mResultsSize = mNumberOfSteps + 1;
+
+    mVoiResults.resize(mResultsSize);
+    mResults.resize(mMemberCount * (mStateCount + mAlgebraicVariableCount) * mResultsSize);
+
+    const auto voiInterval {(mOutputEndTime - mOutputStartTime) / static_cast<double>(mNumberOfSteps)};
+
+    for (size_t i {0}; i < mResultsSize; ++i) {
+        mVoiResults[i] = (i == mNumberOfSteps) ? mOutputEndTime : mOutputStartTime + static_cast<double>(i) * voiInterval;
+    }
+
+    mEnsembleIssues = issuesSnapshot();
+}
+
+std::string SedEnsemble::Impl::membersContext(size_t pBlock) const
+{
+    const auto firstMember {pBlock * mLaneCount};
+    const auto lastMember {std::min(firstMember + mLaneCount, mMemberCount) - 1};
+
+    if (firstMember == lastMember) {
+        return std::format("Member {}", firstMember);
+    }
+
+    return std::format("Members {} to {}", firstMember, lastMember);
+}
+
+void SedEnsemble::Impl::trackResults(size_t pBlock, size_t pIndex, const double *pStates, const double *pAlgebraicVariables)
+{
+    const auto variableCount {mStateCount + mAlgebraicVariableCount};
+
+    for (size_t lane {0}; lane < mLaneCount; ++lane) {
+        const auto member {pBlock * mLaneCount + lane};
+
+        if (member >= mMemberCount) {
+            break;
+        }
+
+        auto *results {mResults.data() + member * variableCount * mResultsSize + pIndex};
+
+        for (size_t i {0}; i < mStateCount; ++i) {
+            results[i * mResultsSize] = pStates[i * mLaneCount + lane]; // NOLINT
+        }
+
+        results += mStateCount * mResultsSize; // NOLINT
+
+        for (size_t i {0}; i < mAlgebraicVariableCount; ++i) {
+            results[i * mResultsSize] = pAlgebraicVariables[i * mLaneCount + lane]; // NOLINT
+        }
+    }
+}
+
+void SedEnsemble::Impl::runBlock(size_t pBlock, const SolverOdePtr &pOdeSolver)
+{
+    // Retrieve the data of our block of lanes.
+
+    const auto laneOffset {pBlock * mLaneCount};
+    auto *states {mStates + laneOffset * mStateCount}; // NOLINT
+    auto *rates {mRates + laneOffset * mStateCount}; // NOLINT
+    auto *constants {mConstants + laneOffset * mConstantCount}; // NOLINT
+    auto *computedConstants {mComputedConstants + laneOffset * mComputedConstantCount}; // NOLINT
+    auto *algebraicVariables {mAlgebraicVariables + laneOffset * mAlgebraicVariableCount}; // NOLINT
+    const auto &runtime {(mLaneCount == 1) ? mRuntime : mEnsembleRuntime};
+
+    // Initialise the states and constants of our lanes using those of our template instance task, and then set the
+    // value of our parameters.
+    // Note: unused lanes, i.e. those past our last member, replicate our last member.
+
+    const auto *instanceTaskPimpl {mInstanceTask->pimpl()};
+    const auto parameterCount {mParameters.size()};
+
+    for (size_t lane {0}; lane < mLaneCount; ++lane) {
+        const auto member {std::min(laneOffset + lane, mMemberCount - 1)};
+
+        for (size_t i {0}; i < mStateCount; ++i) {
+            states[i * mLaneCount + lane] = instanceTaskPimpl->mStates[i]; // NOLINT
+        }
+
+        for (size_t i {0}; i < mConstantCount; ++i) {
+            constants[i * mLaneCount + lane] = instanceTaskPimpl->mConstants[i]; // NOLINT
+        }
+
+        for (size_t i {0}; i < parameterCount; ++i) {
+            const auto &parameter {mParameters[i]};
+
+            (parameter.state ? states : constants)[parameter.index * mLaneCount + lane] = mParameterValues[member * parameterCount + i]; // NOLINT
+        }
+    }
+
+    // Compute our computed constants, rates, and variables, and initialise our ODE solver.
+
+    auto voi {mInitialTime};
+
+#ifdef __EMSCRIPTEN__
+    runtime->computeComputedConstantsForDifferentialModel(voi, states, rates, constants, computedConstants, algebraicVariables);
+    runtime->computeRates(voi, states, rates, constants, computedConstants, algebraicVariables);
+    runtime->computeVariablesForDifferentialModel(voi, states, rates, constants, computedConstants, algebraicVariables);
+#else
+    const auto computeVariablesForDifferentialModel {runtime->computeVariablesForDifferentialModel()};
+
+    runtime->computeComputedConstantsForDifferentialModel()(voi, states, rates, constants, computedConstants, algebraicVariables);
+    runtime->computeRates()(voi, states, rates, constants, computedConstants, algebraicVariables);
+    computeVariablesForDifferentialModel(voi, states, rates, constants, computedConstants, algebraicVariables);
+#endif
+
+    auto *odeSolverPimpl {pOdeSolver->pimpl()};
+    size_t index {0};
+    auto handleFailure = [&]() {
+        addIssues(pOdeSolver, membersContext(pBlock) + " | " + pOdeSolver->name());
+
+        for (size_t lane {0}; lane < mLaneCount; ++lane) {
+            const auto member {laneOffset + lane};
+
+            if (member >= mMemberCount) {
+                break;
+            }
+
+            auto *results {mResults.data() + member * (mStateCount + mAlgebraicVariableCount) * mResultsSize};
+
+            for (size_t i {0}, iMax {mStateCount + mAlgebraicVariableCount}; i < iMax; ++i) {
+                std::fill(results + i * mResultsSize + index, results + (i + 1) * mResultsSize, NAN); // NOLINT
+            }
+        }
+    };
+
+    if (!odeSolverPimpl->initialise(voi, mStateCount * mLaneCount, states, rates, constants, computedConstants, algebraicVariables, runtime)) {
+        handleFailure();
+
+        return;
+    }
+
+    // Run our lanes from the initial time to the output start time, if needed.
+
+    if (!fuzzyCompare(mInitialTime, mOutputStartTime) && !odeSolverPimpl->solve(voi, mOutputStartTime)) {
+        handleFailure();
+
+        return;
+    }
+
+    // Run our lanes from the output start time to the output end time, tracking our results.
+
+    for (;;) {
+#ifdef __EMSCRIPTEN__
+        runtime->computeVariablesForDifferentialModel(voi, states, rates, constants, computedConstants, algebraicVariables);
+#else
+        computeVariablesForDifferentialModel(voi, states, rates, constants, computedConstants, algebraicVariables);
+#endif
+
+        trackResults(pBlock, index, states, algebraicVariables);
+
+        if (++index == mResultsSize) {
+            break;
+        }
+
+        if (!odeSolverPimpl->solve(voi, mVoiResults[index])) {
+            handleFailure();
+
+            return;
+        }
+    }
+}
+
+size_t SedEnsemble::Impl::memberCount() const noexcept
+{
+    return mMemberCount;
+}
+
+size_t SedEnsemble::Impl::parameterCount() const noexcept
+{
+    return mParameters.size();
+}
+
+const std::string &SedEnsemble::Impl::parameterName(size_t pIndex) const noexcept
+{
+    static const std::string NO_NAME;
+
+    if (pIndex >= mParameters.size()) {
+        return NO_NAME;
+    }
+
+    return mParameterNames[pIndex];
+}
+
+size_t SedEnsemble::Impl::threadCount() const noexcept
+{
+    if (mThreadCount == 0) {
+        return std::max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    return mThreadCount;
+}
+
+void SedEnsemble::Impl::setThreadCount(size_t pThreadCount)
+{
+    mThreadCount = pThreadCount;
+}
+
+double SedEnsemble::Impl::run()
+{
+    // Reset ourselves.
+
+    {
+        const std::scoped_lock<std::recursive_mutex> lock(mMutex);
+
+        removeAllIssues();
+        addIssues(mEnsembleIssues);
+    }
+
+    if (hasErrors()) {
+        return 0.0;
+    }
+
+    // Start our timer.
+
+    auto startTime {std::chrono::high_resolution_clock::now()};
+
+    // Run our blocks of lanes across a pool of threads, each of which uses its own copy of our ODE solver and picks the
+    // next block to run until there are no more blocks to run.
+
+    std::atomic<size_t> nextBlock {0};
+    auto worker = [this, &nextBlock]() {
+#ifdef __EMSCRIPTEN__
+        // Initialise our per-worker WASM runtime data.
+
+        const auto &runtime {(mLaneCount == 1) ? mRuntime : mEnsembleRuntime};
+
+        runtime->initialiseWorkerWasm();
+#endif
+
+        auto odeSolver {std::dynamic_pointer_cast<SolverOde>(mOdeSolver->pimpl()->duplicate())};
+
+        for (auto block {nextBlock.fetch_add(1, std::memory_order_relaxed)};
+             block < mBlockCount;
+             block = nextBlock.fetch_add(1, std::memory_order_relaxed)) {
+            runBlock(block, odeSolver);
+        }
+
+#ifdef __EMSCRIPTEN__
+        runtime->cleanupWorkerWasm();
+#endif
+    };
+
+    const auto threadCount {std::min(this->threadCount(), mBlockCount)};
+    std::vector<std::thread> threads;
+
+    threads.reserve(threadCount);
+
+    for (size_t i {0}; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // Stop our timer and return the elapsed time in milliseconds.
+
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+std::span<const double> SedEnsemble::Impl::voi() const noexcept
+{
+    return mVoiResults;
+}
+
+const std::string &SedEnsemble::Impl::voiName() const noexcept
+{
+    static const std::string NO_NAME;
+
+    return (mInstanceTask != nullptr) ? mInstanceTask->voiName() : NO_NAME;
+}
+
+const std::string &SedEnsemble::Impl::voiUnit() const noexcept
+{
+    static const std::string NO_UNIT;
+
+    return (mInstanceTask != nullptr) ? mInstanceTask->voiUnit() : NO_UNIT;
+}
+
+size_t SedEnsemble::Impl::stateCount() const noexcept
+{
+    return mStateCount;
+}
+
+std::span<const double> SedEnsemble::Impl::state(size_t pMemberIndex, size_t pIndex) const noexcept
+{
+    if ((pMemberIndex >= mMemberCount) || (pIndex >= mStateCount)) {
+        return {};
+    }
+
+    return {mResults.data() + (pMemberIndex * (mStateCount + mAlgebraicVariableCount) + pIndex) * mResultsSize, mResultsSize};
+}
+
+const std::string &SedEnsemble::Impl::stateName(size_t pIndex) const noexcept
+{
+    static const std::string NO_NAME;
+
+    return (mInstanceTask != nullptr) ? mInstanceTask->stateName(pIndex) : NO_NAME;
+}
+
+const std::string &SedEnsemble::Impl::stateUnit(size_t pIndex) const noexcept
+{
+    static const std::string NO_UNIT;
+
+    return (mInstanceTask != nullptr) ? mInstanceTask->stateUnit(pIndex) : NO_UNIT;
+}
+
+size_t SedEnsemble::Impl::algebraicVariableCount() const noexcept
+{
+    return mAlgebraicVariableCount;
+}
+
+std::span<const double> SedEnsemble::Impl::algebraicVariable(size_t pMemberIndex, size_t pIndex) const noexcept
+{
+    if ((pMemberIndex >= mMemberCount) || (pIndex >= mAlgebraicVariableCount)) {
+        return {};
+    }
+
+    return {mResults.data() + (pMemberIndex * (mStateCount + mAlgebraicVariableCount) + mStateCount + pIndex) * mResultsSize, mResultsSize};
+}
+
+const std::string &SedEnsemble::Impl::algebraicVariableName(size_t pIndex) const noexcept
+{
+    static const std::string NO_NAME;
+
+    return (mInstanceTask != nullptr) ? mInstanceTask->algebraicVariableName(pIndex) : NO_NAME;
+}
+
+const std::string &SedEnsemble::Impl::algebraicVariableUnit(size_t pIndex) const noexcept
+{
+    static const std::string NO_UNIT;
+
+    return (mInstanceTask != nullptr) ? mInstanceTask->algebraicVariableUnit(pIndex) : NO_UNIT;
+}
+
+SedEnsemble::SedEnsemble(const SedDocumentPtr &pDocument, const Strings &pParameterNames, const Doubles &pParameterValues)
+    : Logger(std::make_unique<Impl>(pDocument, pParameterNames, pParameterValues))
+{
+}
+
+SedEnsemble::~SedEnsemble() = default;
+
+SedEnsemble::Impl *SedEnsemble::pimpl()
+{
+    return static_cast<Impl *>(Logger::mPimpl.get());
+}
+
+const SedEnsemble::Impl *SedEnsemble::pimpl() const
+{
+    return static_cast<const Impl *>(Logger::mPimpl.get());
+}
+
+size_t SedEnsemble::memberCount() const noexcept
+{
+    return pimpl()->memberCount();
+}
+
+size_t SedEnsemble::parameterCount() const noexcept
+{
+    return pimpl()->parameterCount();
+}
+
+const std::string &SedEnsemble::parameterName(size_t pIndex) const noexcept
+{
+    return pimpl()->parameterName(pIndex);
+}
+
+size_t SedEnsemble::threadCount() const noexcept
+{
+    return pimpl()->threadCount();
+}
+
+void SedEnsemble::setThreadCount(size_t pThreadCount)
+{
+    pimpl()->setThreadCount(pThreadCount);
+}
+
+double SedEnsemble::run()
+{
+    return pimpl()->run();
+}
+
+#ifdef __EMSCRIPTEN__
+const emscripten::val &SedEnsemble::voi() const noexcept
+{
+    static thread_local emscripten::val res;
+    static thread_local const double *cachedDataPtr {nullptr};
+    static thread_local auto cachedSize {SIZE_MAX};
+
+    const auto &data = pimpl()->voi();
+    const auto *dataPtr = data.data();
+    const auto dataSize = data.size();
+
+    if ((cachedDataPtr != dataPtr) || (cachedSize != dataSize)) {
+        res = toFloat64Array(data);
+
+        cachedDataPtr = dataPtr;
+        cachedSize = dataSize;
+    }
+
+    return res;
+}
+#else
+std::span<const double> SedEnsemble::voi() const noexcept
+{
+    return pimpl()->voi();
+}
+#endif
+
+const std::string &SedEnsemble::voiName() const noexcept
+{
+    return pimpl()->voiName();
+}
+
+const std::string &SedEnsemble::voiUnit() const noexcept
+{
+    return pimpl()->voiUnit();
+}
+
+size_t SedEnsemble::stateCount() const noexcept
+{
+    return pimpl()->stateCount();
+}
+
+#ifdef __EMSCRIPTEN__
+const emscripten::val &SedEnsemble::state(size_t pMemberIndex, size_t pIndex) const noexcept
+{
+    static thread_local emscripten::val res;
+    static thread_local const double *cachedDataPtr {nullptr};
+    static thread_local auto cachedSize {SIZE_MAX};
+
+    const auto &data = pimpl()->state(pMemberIndex, pIndex);
+    const auto *dataPtr = data.data();
+    const auto dataSize = data.size();
+
+    if ((cachedDataPtr != dataPtr) || (cachedSize != dataSize)) {
+        res = toFloat64Array(data);
+
+        cachedDataPtr = dataPtr;
+        cachedSize = dataSize;
+    }
+
+    return res;
+}
+#else
+std::span<const double> SedEnsemble::state(size_t pMemberIndex, size_t pIndex) const noexcept
+{
+    return pimpl()->state(pMemberIndex, pIndex);
+}
+#endif
+
+const std::string &SedEnsemble::stateName(size_t pIndex) const noexcept
+{
+    return pimpl()->stateName(pIndex);
+}
+
+const std::string &SedEnsemble::stateUnit(size_t pIndex) const noexcept
+{
+    return pimpl()->stateUnit(pIndex);
+}
+
+size_t SedEnsemble::algebraicVariableCount() const noexcept
+{
+    return pimpl()->algebraicVariableCount();
+}
+
+#ifdef __EMSCRIPTEN__
+const emscripten::val &SedEnsemble::algebraicVariable(size_t pMemberIndex, size_t pIndex) const noexcept
+{
+    static thread_local emscripten::val res;
+    static thread_local const double *cachedDataPtr {nullptr};
+    static thread_local auto cachedSize {SIZE_MAX};
+
+    const auto &data = pimpl()->algebraicVariable(pMemberIndex, pIndex);
+    const auto *dataPtr = data.data();
+    const auto dataSize = data.size();
+
+    if ((cachedDataPtr != dataPtr) || (cachedSize != dataSize)) {
+        res = toFloat64Array(data);
+
+        cachedDataPtr = dataPtr;
+        cachedSize = dataSize;
+    }
+
+    return res;
+}
+#else
+std::span<const double> SedEnsemble::algebraicVariable(size_t pMemberIndex, size_t pIndex) const noexcept
+{
+    return pimpl()->algebraicVariable(pMemberIndex, pIndex);
+}
+#endif
+
+const std::string &SedEnsemble::algebraicVariableName(size_t pIndex) const noexcept
+{
+    return pimpl()->algebraicVariableName(pIndex);
+}
+
+const std::string &SedEnsemble::algebraicVariableUnit(size_t pIndex) const noexcept
+{
+    return pimpl()->algebraicVariableUnit(pIndex);
+}
+
+} // namespace libOpenCOR
@@ -0,0 +1,118 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "logger_p.h"
+
+#include "cellmlfileruntime.h"
+#include "utils.h"
+
+#include "libopencor/sedensemble.h"
+
+#include <span>
+
+namespace libOpenCOR {
+
+struct SedEnsembleParameter
+{
+    bool state {false};
+    size_t index {0};
+};
+
+class SedEnsemble::Impl: public Logger::Impl
+{
+public:
+    // Note: the width of our ensemble runtime is such that a block of lanes fills an AVX-512 register, i.e. eight
+    //       doubles, or two AVX2 registers.
+
+    static constexpr auto ENSEMBLE_WIDTH {8};
+
+    SedInstancePtr mInstance;
+    SedInstanceTaskPtr mInstanceTask;
+    CellmlFileRuntimePtr mRuntime;
+    CellmlFileRuntimePtr mEnsembleRuntime;
+    SolverOdePtr mOdeSolver;
+
+    LoggerIssuesPtr mEnsembleIssues;
+
+    Strings mParameterNames;
+    std::vector<SedEnsembleParameter> mParameters;
+    Doubles mParameterValues;
+
+    size_t mMemberCount {0};
+    size_t mLaneCount {1};
+    size_t mBlockCount {0};
+    size_t mThreadCount {0};
+
+    size_t mStateCount {0};
+    size_t mConstantCount {0};
+    size_t mComputedConstantCount {0};
+    size_t mAlgebraicVariableCount {0};
+
+    double mInitialTime {0.0};
+    double mOutputStartTime {0.0};
+    double mOutputEndTime {0.0};
+    size_t mNumberOfSteps {0};
+
+    Doubles mArena;
+
+    double *mStates {nullptr};
+    double *mRates {nullptr};
+    double *mConstants {nullptr};
+    double *mComputedConstants {nullptr};
+    double *mAlgebraicVariables {nullptr};
+
+    size_t mResultsSize {0};
+
+    Doubles mVoiResults;
+    Doubles mResults;
+
+    static SedEnsemblePtr create(const SedDocumentPtr &pDocument, const Strings &pParameterNames,
+                                 const Doubles &pParameterValues);
+
+    explicit Impl(const SedDocumentPtr &pDocument, const Strings &pParameterNames, const Doubles &pParameterValues);
+
+    std::string membersContext(size_t pBlock) const;
+
+    void trackResults(size_t pBlock, size_t pIndex, const double *pStates, const double *pAlgebraicVariables);
+    void runBlock(size_t pBlock, const SolverOdePtr &pOdeSolver);
+
+    size_t memberCount() const noexcept;
+    size_t parameterCount() const noexcept;
+    const std::string &parameterName(size_t pIndex) const noexcept;
+
+    size_t threadCount() const noexcept;
+    void setThreadCount(size_t pThreadCount);
+
+    double run();
+
+    std::span<const double> voi() const noexcept;
+    const std::string &voiName() const noexcept;
+    const std::string &voiUnit() const noexcept;
+
+    size_t stateCount() const noexcept;
+    std::span<const double> state(size_t pMemberIndex, size_t pIndex) const noexcept;
+    const std::string &stateName(size_t pIndex) const noexcept;
+    const std::string &stateUnit(size_t pIndex) const noexcept;
+
+    size_t algebraicVariableCount() const noexcept;
+    std::span<const double> algebraicVariable(size_t pMemberIndex, size_t pIndex) const noexcept;
+    const std::string &algebraicVariableName(size_t pIndex) const noexcept;
+    const std::string &algebraicVariableUnit(size_t pIndex) const noexcept;
+};
+
+} // namespace libOpenCOR
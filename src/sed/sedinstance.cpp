@@ -21,6 +21,7 @@ limitations under the License.
 #include "libopencor/seddocument.h"
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 
 namespace libOpenCOR {
@@ -81,7 +82,7 @@ SedInstance::Impl::Impl(const SedDocumentPtr &pDocument)
 
         // Keep track of the issues of all the tasks.
 
-        mTasksIssues = mIssues;
+        mTasksIssues = issuesSnapshot();
     } else {
         addError("The simulation experiment description does not contain any tasks to run.");
     }
@@ -100,13 +101,23 @@ SedInstance::Status SedInstance::Impl::status() const
     return Status::RUNNING;
 }
 
-double SedInstance::Impl::run()
+void SedInstance::Impl::markTasksAsRunning()
+{
+    // Let all our tasks know that they are running, even if they have yet to be run, and clear their checkpoint, so
+    // that none of them returns the checkpoint of a previous run (or a checkpoint of a state that is about to change).
+
+    for (const auto &task : mTasks) {
+        task->pimpl()->clearCheckpoint();
+        task->pimpl()->mRunning.store(true, std::memory_order_release);
+    }
+}
+
+double SedInstance::Impl::runTasks(const std::function<double(SedInstanceTask::Impl *)> &pRunTask)
 {
     // Reset ourselves.
 
     removeAllIssues();
-
-    mIssues = mTasksIssues;
+    addIssues(mTasksIssues);
 
     // Reset our control flags and make sure that they are passed to each task so that they can be used by them.
 
@@ -123,9 +134,15 @@ double SedInstance::Impl::run()
 
     auto res {0.0};
 
+    markTasksAsRunning();
+
     for (const auto &task : mTasks) {
         if (!task->hasIssues()) {
-            res += task->pimpl()->run();
+            task->pimpl()->startInstrumentation();
+
+            res += pRunTask(task->pimpl());
+
+            task->pimpl()->stopInstrumentation();
 
             if (task->hasIssues()) {
                 addIssues(task, "Task");
@@ -135,6 +152,8 @@ double SedInstance::Impl::run()
                 task->pimpl()->removeAllIssues();
             }
         }
+
+        task->pimpl()->mRunning.store(false, std::memory_order_release);
     }
 
     // Reset and make sure that our control flags are no longer passed to each task.
@@ -149,6 +168,20 @@ double SedInstance::Impl::run()
     return res;
 }
 
+double SedInstance::Impl::run()
+{
+    return runTasks([](SedInstanceTask::Impl *pTask) {
+        return pTask->run();
+    });
+}
+
+double SedInstance::Impl::continueRun(double pEndTime, int pNumberOfSteps)
+{
+    return runTasks([pEndTime, pNumberOfSteps](SedInstanceTask::Impl *pTask) {
+        return pTask->continueRun(pEndTime, pNumberOfSteps);
+    });
+}
+
 bool SedInstance::Impl::startRun()
 {
     const std::scoped_lock<std::mutex> runLock(mRunMutex);
@@ -163,6 +196,8 @@ bool SedInstance::Impl::startRun()
 
     mRunning.store(true, std::memory_order_release);
 
+    markTasksAsRunning();
+
     mRunFuture = std::async(std::launch::async, [this]() {
         const auto result = run();
 
@@ -232,6 +267,92 @@ double SedInstance::Impl::progress() const
     return total / static_cast<double>(mTasks.size());
 }
 
+UnsignedChars SedInstance::Impl::checkpoint() const
+{
+    // Our checkpoint consists of the number of our tasks followed by the size and contents of the checkpoint of each of
+    // our tasks.
+
+    UnsignedChars res;
+    const uint64_t taskCount {mTasks.size()};
+
+    appendBytes(res, &taskCount, sizeof(taskCount));
+
+    for (const auto &task : mTasks) {
+        const auto taskCheckpoint {task->pimpl()->checkpoint()};
+
+        if (taskCheckpoint.empty()) {
+            return {};
+        }
+
+        const uint64_t taskCheckpointSize {taskCheckpoint.size()};
+
+        appendBytes(res, &taskCheckpointSize, sizeof(taskCheckpointSize));
+        appendBytes(res, taskCheckpoint.data(), taskCheckpoint.size());
+    }
+
+    return res;
+}
+
+bool SedInstance::Impl::restore(const UnsignedChars &pCheckpoint)
+{
+    // Make sure that we are not running and that the checkpoint is for the same number of tasks as ours.
+
+    if (mRunning.load(std::memory_order_acquire)) {
+        return false;
+    }
+
+    size_t offset {0};
+    uint64_t taskCount {};
+
+    if (!extractBytes(pCheckpoint, offset, &taskCount, sizeof(taskCount)) || (taskCount != mTasks.size())) {
+        return false;
+    }
+
+    // Retrieve and parse the checkpoint of each of our tasks, and only restore our tasks if all of their checkpoints
+    // are valid, so that we never end up with some of our tasks restored and others not.
+
+    std::vector<SedInstanceTaskCheckpoint> taskCheckpoints;
+
+    taskCheckpoints.reserve(mTasks.size());
+
+    for (const auto &task : mTasks) {
+        uint64_t taskCheckpointSize {};
+
+        if (!extractBytes(pCheckpoint, offset, &taskCheckpointSize, sizeof(taskCheckpointSize))
+            || (taskCheckpointSize > pCheckpoint.size() - offset)) {
+            return false;
+        }
+
+        UnsignedChars taskCheckpoint(taskCheckpointSize);
+
+        extractBytes(pCheckpoint, offset, taskCheckpoint.data(), taskCheckpoint.size());
+
+        auto parsedTaskCheckpoint {task->pimpl()->parseCheckpoint(taskCheckpoint)};
+
+        if (!parsedTaskCheckpoint.has_value()) {
+            return false;
+        }
+
+        taskCheckpoints.push_back(std::move(*parsedTaskCheckpoint));
+    }
+
+    if (offset != pCheckpoint.size()) {
+        return false;
+    }
+
+    // Restore our tasks.
+    // Note: restoring a task from a parsed checkpoint can only fail if the task needs to be fully reinitialised and
+    //       this fails, in which case the task has some issues and cannot be run anyway.
+
+    auto res {true};
+
+    for (size_t i {0}; i < mTasks.size(); ++i) {
+        res = mTasks[i]->pimpl()->restore(taskCheckpoints[i]) && res;
+    }
+
+    return res;
+}
+
 bool SedInstance::Impl::hasTasks() const
 {
     return !mTasks.empty();
@@ -288,6 +409,11 @@ double SedInstance::run()
     return pimpl()->run();
 }
 
+double SedInstance::continueRun(double pEndTime, int pNumberOfSteps)
+{
+    return pimpl()->continueRun(pEndTime, pNumberOfSteps);
+}
+
 bool SedInstance::startRun()
 {
     return pimpl()->startRun();
@@ -318,6 +444,16 @@ double SedInstance::progress() const noexcept
     return pimpl()->progress();
 }
 
+UnsignedChars SedInstance::checkpoint() const
+{
+    return pimpl()->checkpoint();
+}
+
+bool SedInstance::restore(const UnsignedChars &pCheckpoint)
+{
+    return pimpl()->restore(pCheckpoint);
+}
+
 bool SedInstance::hasTasks() const noexcept
 {
     return pimpl()->hasTasks();
@@ -22,6 +22,7 @@ limitations under the License.
 #include "libopencor/sedinstance.h"
 
 #include <condition_variable>
+#include <functional>
 #include <future>
 #include <mutex>
 
@@ -31,7 +32,7 @@ class SedInstance::Impl: public Logger::Impl
 {
 public:
     SedInstanceTaskPtrs mTasks;
-    IssuePtrs mTasksIssues;
+    LoggerIssuesPtr mTasksIssues;
 
     mutable std::atomic<bool> mRunning {false};
     mutable std::mutex mRunMutex;
@@ -49,7 +50,10 @@ public:
 
     Status status() const;
 
+    void markTasksAsRunning();
+    double runTasks(const std::function<double(SedInstanceTask::Impl *)> &pRunTask);
     double run();
+    double continueRun(double pEndTime, int pNumberOfSteps);
     bool startRun();
     double waitForRun();
     void pauseRun();
@@ -57,6 +61,9 @@ public:
     void stopRun();
     double progress() const;
 
+    UnsignedChars checkpoint() const;
+    bool restore(const UnsignedChars &pCheckpoint);
+
     bool hasTasks() const;
     size_t taskCount() const;
     const SedInstanceTaskPtrs &tasks() const;
@@ -18,10 +18,14 @@ limitations under the License.
 #include "sedchangeattribute_p.h"
 #include "sedinstancetask_p.h"
 #include "sedmodel_p.h"
+#include "sedsteadystate_p.h"
 #include "sedtask_p.h"
 #include "seduniformtimecourse_p.h"
+#include "solvercvode_p.h"
+#include "solverkinsol_p.h"
 #include "solvernla_p.h"
 #include "solverode_p.h"
+#include "tracer.h"
 
 #include <algorithm>
 #include <cmath>
@@ -32,25 +36,70 @@ limitations under the License.
 
 namespace libOpenCOR {
 
-#ifdef __EMSCRIPTEN__
-// clang-format off
-EM_JS(intptr_t, toFloat64ArrayJS, (const void* data, size_t size), {
-    if (size === 0) {
-        return Emval.toHandle(new Float64Array(0));
+namespace {
+
+constexpr std::array<unsigned char, 4> CHECKPOINT_SIGNATURE {'L', 'O', 'C', 'K'};
+constexpr uint32_t CHECKPOINT_VERSION {2};
+
+// The period at which a running task checks whether a pause or stop has been requested and publishes its progress, as
+// well as the maximum number of steps between two such checks.
+// Note: the number of steps between two checks is doubled (up to our maximum) whenever the steps since the previous
+//       check took less than half our period, so that the overhead of the checks is negligible for models with cheap
+//       steps. It is reset to 1 as soon as the steps since the previous check took more than our period. So, as long
+//       as the cost of a step is steady, the pause/stop latency is about our period (or the cost of a single step, if
+//       it is larger). If the cost of a step suddenly increases, then up to the number of steps between two checks
+//       (i.e. at most our maximum) may be computed at the new cost before the next check, after which we check after
+//       every step until steps are cheap again.
+
+constexpr auto RUN_CONTROL_CHECK_PERIOD {std::chrono::microseconds(1000)};
+constexpr size_t MAXIMUM_RUN_CONTROL_CHECK_INTERVAL {1024};
+
+template<typename T>
+void appendValue(UnsignedChars &pCheckpoint, T pValue)
+{
+    appendBytes(pCheckpoint, &pValue, sizeof(T));
+}
+
+void appendValues(UnsignedChars &pCheckpoint, const double *pValues, size_t pCount)
+{
+    appendValue<uint64_t>(pCheckpoint, pCount);
+    appendBytes(pCheckpoint, pValues, pCount * sizeof(double));
+}
+
+template<typename T>
+bool extractValue(const UnsignedChars &pCheckpoint, size_t &pOffset, T &pValue)
+{
+    return extractBytes(pCheckpoint, pOffset, &pValue, sizeof(T));
+}
+
+bool extractValues(const UnsignedChars &pCheckpoint, size_t &pOffset, Doubles &pValues)
+{
+    uint64_t count {};
+
+    if (!extractValue(pCheckpoint, pOffset, count) || (count > (pCheckpoint.size() - pOffset) / sizeof(double))) {
+        return false;
     }
 
-    return Emval.toHandle(new Float64Array(HEAPU8.subarray(data, data + 8 * size).buffer, data, size));
-    // Note: we use HEAPU8.subarray() to create a view over the WASM heap's Float64Array buffer because it is safer than
-    //       accessing HEAPU8.buffer directly in case the WASM heap was ever to grow (we don't allow this to happen, but
-    //       it is still safer to use HEAPU8.subarray()) since it creates a view with the correct byte offset.
-}); // clang-format on
+    pValues.resize(count);
 
-static emscripten::val toFloat64Array(std::span<const double> data)
+    return extractBytes(pCheckpoint, pOffset, pValues.data(), count * sizeof(double));
+}
+
+#ifndef __EMSCRIPTEN__
+void computeSteadyStateObjectiveFunction(double *pU, double *pF, void *pUserData)
 {
-    return emscripten::val::take_ownership(reinterpret_cast<emscripten::EM_VAL>(toFloat64ArrayJS(data.data(), data.size())));
+    // Our objective function is our rates, computed using the given states.
+
+    auto *instanceTaskPimpl {static_cast<SedInstanceTask::Impl *>(pUserData)};
+
+    instanceTaskPimpl->mRuntime->computeRates()(instanceTaskPimpl->mVoi, pU, pF, instanceTaskPimpl->mConstants,
+                                                instanceTaskPimpl->mComputedConstants,
+                                                instanceTaskPimpl->mAlgebraicVariables);
 }
 #endif
 
+} // namespace
+
 SedInstanceTaskPtr SedInstanceTask::Impl::create(const SedAbstractTaskPtr &pTask)
 {
     auto res {SedInstanceTaskPtr {new SedInstanceTask {pTask}}};
@@ -83,20 +132,46 @@ SedInstanceTask::Impl::Impl(const SedAbstractTaskPtr &pTask)
 
     mModel = task->pimpl()->mModel;
 
-    auto cellmlFile {mModel->pimpl()->mFile->pimpl()->mCellmlFile};
-    auto cellmlFileType {cellmlFile->type()};
+    mCellmlFile = mModel->pimpl()->mFile->pimpl()->mCellmlFile;
+
+    auto cellmlFileType {mCellmlFile->type()};
 
     mDifferentialModel = (cellmlFileType == libcellml::AnalyserModel::Type::ODE)
                          || (cellmlFileType == libcellml::AnalyserModel::Type::DAE);
     mSimulation = task->pimpl()->mSimulation;
     mSedUniformTimeCourse = mDifferentialModel ? std::dynamic_pointer_cast<SedUniformTimeCourse>(mSimulation) : nullptr;
+    mSedSteadyState = mDifferentialModel ? std::dynamic_pointer_cast<SedSteadyState>(mSimulation) : nullptr;
 
     const auto &odeSolver {mSimulation->odeSolver()};
     const auto &nlaSolver {mSimulation->nlaSolver()};
 
     mOdeSolver = (odeSolver != nullptr) ? std::dynamic_pointer_cast<SolverOde>(odeSolver->pimpl()->duplicate()) : nullptr;
     mNlaSolver = (nlaSolver != nullptr) ? std::dynamic_pointer_cast<SolverNla>(nlaSolver->pimpl()->duplicate()) : nullptr;
-    mRuntime = cellmlFile->runtime(mNlaSolver);
+    mRuntime = mCellmlFile->runtime(mNlaSolver);
+
+#ifndef __EMSCRIPTEN__
+    // Get a KINSOL solver to compute the steady state of our differential model, if needed.
+    // Note: we use our own KINSOL solver, using the settings of our NLA solver if it is a KINSOL solver, since our NLA
+    //       solver, if any, may be used to compute our rates.
+
+    if (mSedSteadyState != nullptr) {
+        auto kinsolSolver {std::dynamic_pointer_cast<SolverKinsol>(nlaSolver)};
+
+        mSteadyStateSolver = (kinsolSolver != nullptr) ?
+                                 std::dynamic_pointer_cast<SolverKinsol>(kinsolSolver->pimpl()->duplicate()) :
+                                 SolverKinsol::create();
+    }
+#endif
+
+    // Keep track of our CVODE solver, if any, since it can be used to compute some sensitivities.
+
+    if (mDifferentialModel) {
+        mCvodeSolver = std::dynamic_pointer_cast<SolverCvode>(mOdeSolver);
+
+        if (mCvodeSolver != nullptr) {
+            mSensitivityParameterCount = mCvodeSolver->sensitivityParameterCount();
+        }
+    }
 
 #ifndef CODE_COVERAGE_ENABLED
     if (mRuntime->hasErrors()) {
@@ -108,111 +183,111 @@ SedInstanceTask::Impl::Impl(const SedAbstractTaskPtr &pTask)
 
     // Create our various arrays.
 
-    mAnalyserModel = cellmlFile->analyserModel();
+    mAnalyserModel = mCellmlFile->analyserModel();
     mStateCount = mAnalyserModel->stateCount();
     mConstantCount = mAnalyserModel->constantCount();
     mComputedConstantCount = mAnalyserModel->computedConstantCount();
     mAlgebraicVariableCount = mAnalyserModel->algebraicVariableCount();
 
-    if (mDifferentialModel) {
-        mStateDoubles.resize(mStateCount);
-        mRateDoubles.resize(mStateCount);
-
-        mStates = mStateDoubles.data();
-        mRates = mRateDoubles.data();
-    }
-
-    mConstantDoubles.resize(mConstantCount);
-    mComputedConstantDoubles.resize(mComputedConstantCount);
-    mAlgebraicVariableDoubles.resize(mAlgebraicVariableCount);
+    // Note: our arrays, including the one used to keep track of their initial values, are all carved from our arena,
+    //       i.e. from a single allocation, and they are zero-initialised, as they would be if they were vectors.
 
-    mConstants = mConstantDoubles.data();
-    mComputedConstants = mComputedConstantDoubles.data();
-    mAlgebraicVariables = mAlgebraicVariableDoubles.data();
+    const auto stateCount {mDifferentialModel ? mStateCount : 0};
+    const auto arrays {mArena.carve<6>({stateCount, stateCount, mConstantCount, mComputedConstantCount,
+                                        mAlgebraicVariableCount,
+                                        2 * stateCount + mConstantCount + mComputedConstantCount + mAlgebraicVariableCount})};
 
-    // Retrieve our various strings.
+    for (const auto &array : arrays) {
+        std::fill(array.begin(), array.end(), 0.0);
+    }
 
     if (mDifferentialModel) {
-        auto variable = mAnalyserModel->voi()->variable();
-
-        mVoiName = name(variable);
-        mVoiUnit = variable->units()->name();
-
-        const auto stateCount = mStateCount;
-
-        mStateNames.resize(stateCount);
-        mStateUnits.resize(stateCount);
+        mStates = arrays[0].data();
+        mRates = arrays[1].data();
+    }
 
-        mRateNames.resize(stateCount);
-        mRateUnits.resize(stateCount);
+    mConstants = arrays[2].data();
+    mComputedConstants = arrays[3].data();
+    mAlgebraicVariables = arrays[4].data();
+    mInitialValues = arrays[5];
+}
 
-        const auto &states = mAnalyserModel->states();
+void SedInstanceTask::Impl::trackResults(size_t pIndex)
+{
+    mResults.voi[pIndex] = mVoi;
 
-        for (size_t i {0}; i < stateCount; ++i) {
-            mStateNames[i] = name(states[i]->variable());
-            mStateUnits[i] = states[i]->variable()->units()->name();
+    for (size_t i {0}; i < mStateCount; ++i) {
+        mResults.states[i * mResults.resultsSize + pIndex] = mStates[i]; // NOLINT
+        mResults.rates[i * mResults.resultsSize + pIndex] = mRates[i]; // NOLINT
+    }
 
-            mRateNames[i] = mStateNames[i] + "'";
-            mRateUnits[i] = mStateUnits[i] + "/" + mVoiUnit;
-        }
+    for (size_t i {0}; i < mConstantCount; ++i) {
+        mResults.constants[i * mResults.resultsSize + pIndex] = mConstants[i]; // NOLINT
     }
 
-    const auto constantCount = mConstantCount;
+    for (size_t i {0}; i < mComputedConstantCount; ++i) {
+        mResults.computedConstants[i * mResults.resultsSize + pIndex] = mComputedConstants[i]; // NOLINT
+    }
 
-    mConstantNames.resize(constantCount);
-    mConstantUnits.resize(constantCount);
+    for (size_t i {0}; i < mAlgebraicVariableCount; ++i) {
+        mResults.algebraicVariables[i * mResults.resultsSize + pIndex] = mAlgebraicVariables[i]; // NOLINT
+    }
 
-    const auto &constants = mAnalyserModel->constants();
+    for (size_t i {0}; i < mSensitivityParameterCount; ++i) {
+        const auto *sensitivities {mCvodeSolver->pimpl()->sensitivity(i)};
 
-    for (size_t i {0}; i < constantCount; ++i) {
-        mConstantNames[i] = name(constants[i]->variable());
-        mConstantUnits[i] = constants[i]->variable()->units()->name();
+        for (size_t j {0}; j < mStateCount; ++j) {
+            mResults.sensitivities[(i * mStateCount + j) * mResults.resultsSize + pIndex] = sensitivities[j]; // NOLINT
+        }
     }
+}
+
+void SedInstanceTask::Impl::trackPhaseTime(Phase pPhase, TimePoint &pStartTime)
+{
+    // Add the time elapsed since the given start time to the given phase and use the current time as our new start time.
 
-    const auto computedConstantCount = mComputedConstantCount;
+    const auto currentTime {std::chrono::high_resolution_clock::now()};
 
-    mComputedConstantNames.resize(computedConstantCount);
-    mComputedConstantUnits.resize(computedConstantCount);
+    mPhaseTimes[static_cast<size_t>(pPhase)] += std::chrono::duration<double, std::milli>(currentTime - pStartTime).count();
 
-    const auto &computedConstants = mAnalyserModel->computedConstants();
+    pStartTime = currentTime;
+}
 
-    for (size_t i {0}; i < computedConstantCount; ++i) {
-        mComputedConstantNames[i] = name(computedConstants[i]->variable());
-        mComputedConstantUnits[i] = computedConstants[i]->variable()->units()->name();
-    }
+std::array<std::pair<double *, size_t>, 5> SedInstanceTask::Impl::modelArrays() const
+{
+    return {{
+        {mStates, mDifferentialModel ? mStateCount : 0},
+        {mRates, mDifferentialModel ? mStateCount : 0},
+        {mConstants, mConstantCount},
+        {mComputedConstants, mComputedConstantCount},
+        {mAlgebraicVariables, mAlgebraicVariableCount},
+    }};
+}
 
-    const auto algebraicVariableCount = mAlgebraicVariableCount;
+void SedInstanceTask::Impl::saveInitialValues()
+{
+    // Keep track of the values of our model arrays, as initialised by our runtime, so that we don't need to use our
+    // runtime to reinitialise them the next time we are run.
 
-    mAlgebraicVariableNames.resize(algebraicVariableCount);
-    mAlgebraicVariableUnits.resize(algebraicVariableCount);
+    size_t offset {0};
 
-    const auto &algebraicVariables = mAnalyserModel->algebraicVariables();
+    for (const auto &[array, count] : modelArrays()) {
+        std::copy_n(array, count, mInitialValues.begin() + static_cast<std::ptrdiff_t>(offset));
 
-    for (size_t i {0}; i < algebraicVariableCount; ++i) {
-        mAlgebraicVariableNames[i] = name(algebraicVariables[i]->variable());
-        mAlgebraicVariableUnits[i] = algebraicVariables[i]->variable()->units()->name();
+        offset += count;
     }
+
+    mInitialValuesAvailable = true;
 }
 
-void SedInstanceTask::Impl::trackResults(size_t pIndex)
+void SedInstanceTask::Impl::restoreInitialValues()
 {
-    mResults.voi[pIndex] = mVoi;
-
-    for (size_t i {0}; i < mStateCount; ++i) {
-        mResults.states[i * mResults.resultsSize + pIndex] = mStates[i]; // NOLINT
-        mResults.rates[i * mResults.resultsSize + pIndex] = mRates[i]; // NOLINT
-    }
-
-    for (size_t i {0}; i < mConstantCount; ++i) {
-        mResults.constants[i * mResults.resultsSize + pIndex] = mConstants[i]; // NOLINT
-    }
+    auto initialValue {mInitialValues.begin()};
 
-    for (size_t i {0}; i < mComputedConstantCount; ++i) {
-        mResults.computedConstants[i * mResults.resultsSize + pIndex] = mComputedConstants[i]; // NOLINT
-    }
+    for (const auto &[array, count] : modelArrays()) {
+        std::copy_n(initialValue, count, array);
 
-    for (size_t i {0}; i < mAlgebraicVariableCount; ++i) {
-        mResults.algebraicVariables[i * mResults.resultsSize + pIndex] = mAlgebraicVariables[i]; // NOLINT
+        initialValue += static_cast<std::ptrdiff_t>(count);
     }
 }
 
@@ -234,6 +309,8 @@ void SedInstanceTask::Impl::applyChanges()
 
 void SedInstanceTask::Impl::initialise()
 {
+    const TraceScope traceScope {"SedInstanceTask::initialise", "sed"};
+
 #ifdef __EMSCRIPTEN__
     // Initialise our per-worker WASM runtime data.
 
@@ -250,13 +327,24 @@ void SedInstanceTask::Impl::initialise()
 #endif
     }
 
+    // We can only continue a simulation once our model has been successfully initialised, and we are not yet
+    // simulating anything.
+
+    mContinuable = false;
+    mPhase = SedInstanceTaskPhase::NONE;
+    mRestored = false;
+
     // Initialise our model, which means that for an ODE/DAE model we need to initialise our states, rates, and
     // variables, compute computed constants, rates, and variables, while for an algebraic/NLA model we need to
     // initialise our variables and compute computed constants and variables.
+    // Note: the values our runtime initialises our arrays with never change, so we only use our runtime the first time
+    //       and restore those values afterwards.
 
-    if (mSedUniformTimeCourse != nullptr) {
-        mVoi = mSedUniformTimeCourse->pimpl()->mInitialTime;
+    mVoi = (mSedUniformTimeCourse != nullptr) ? mSedUniformTimeCourse->pimpl()->mInitialTime : 0.0;
 
+    if (mInitialValuesAvailable) {
+        restoreInitialValues();
+    } else if (mDifferentialModel) {
 #ifdef __EMSCRIPTEN__
         mRuntime->initialiseArraysForDifferentialModel(mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
 #else
@@ -270,9 +358,24 @@ void SedInstanceTask::Impl::initialise()
 #endif
     }
 
+    if (!mInitialValuesAvailable) {
+        saveInitialValues();
+    }
+
+    // Apply our changes and then the initial values of our states and the values of our constants that were set
+    // directly.
+
     applyChanges();
 
-    if (mSedUniformTimeCourse != nullptr) {
+    for (const auto &[index, value] : mInitialStateValues) {
+        mStates[index] = value; // NOLINT
+    }
+
+    for (const auto &[index, value] : mConstantValues) {
+        mConstants[index] = value; // NOLINT
+    }
+
+    if (mDifferentialModel) {
 #ifdef __EMSCRIPTEN__
         mRuntime->computeComputedConstantsForDifferentialModel(mVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
         mRuntime->computeRates(mVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
@@ -301,21 +404,96 @@ void SedInstanceTask::Impl::initialise()
     }
 
     // Initialise the ODE solver, if needed.
+    // Note: if our ODE solver was successfully initialised before and it isn't used to compute some sensitivities or
+    //       the gradient of an objective then we only need to reinitialise it (e.g., call CVodeReInit() for CVODE).
 
     if (mDifferentialModel) {
+        const TraceScope odeSolverTraceScope {"SolverOde::initialise", "solver"};
+
+        if (mOdeSolverReinitialisable) {
+            mOdeSolver->pimpl()->reinitialise(mVoi);
+
+            mContinuable = true;
+
+            return;
+        }
+
         if (!mOdeSolver->pimpl()->initialise(mVoi, mStateCount, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables, mRuntime)) {
             addIssues(mOdeSolver, mOdeSolver->name());
 
             return;
         }
+
+        // Initialise our sensitivities, if needed.
+
+        if ((mSensitivityParameterCount != 0)
+            && !mCvodeSolver->pimpl()->initialiseSensitivities(mVoi, mConstantCount, mAlgebraicVariableCount)) {
+            addIssues(mOdeSolver, mOdeSolver->name());
+
+            return;
+        }
+
+        mOdeSolverReinitialisable = mSensitivityParameterCount == 0;
+        mContinuable = true;
+    }
+}
+
+void SedInstanceTask::Impl::resizeResults(size_t pResultsSize)
+{
+    // Carve our results from their arena, which only involves an allocation if our results have never been this big.
+    // Note: our results are not initialised since they are always either tracked or filled with NaN values.
+
+    mResults.resultsSize = pResultsSize;
+
+    const auto results {mResults.arena.carve<7>({mDifferentialModel ? pResultsSize : 0,
+                                                 mStateCount * pResultsSize,
+                                                 mStateCount * pResultsSize,
+                                                 mConstantCount * pResultsSize,
+                                                 mComputedConstantCount * pResultsSize,
+                                                 mAlgebraicVariableCount * pResultsSize,
+                                                 mSensitivityParameterCount * mStateCount * pResultsSize})};
+
+    mResults.voi = results[0];
+    mResults.states = results[1];
+    mResults.rates = results[2];
+    mResults.constants = results[3];
+    mResults.computedConstants = results[4];
+    mResults.algebraicVariables = results[5];
+    mResults.sensitivities = results[6];
+}
+
+bool SedInstanceTask::Impl::stopRequested() const
+{
+    // Wait for as long as a pause has been requested (unless a stop gets requested in the meantime), and return whether
+    // a stop has been requested.
+
+    if ((mRunControl->load(std::memory_order_relaxed) & INSTANCE_RUN_CONTROL_PAUSE) != 0) {
+        std::unique_lock<std::mutex> pauseLock(*mPauseMutex);
+
+        mPauseConditionVariable->wait(pauseLock, [this]() {
+            const auto runControl = mRunControl->load(std::memory_order_relaxed);
+
+            return ((runControl & INSTANCE_RUN_CONTROL_PAUSE) == 0) || ((runControl & INSTANCE_RUN_CONTROL_STOP) != 0);
+        });
     }
+
+    return (mRunControl->load(std::memory_order_relaxed) & INSTANCE_RUN_CONTROL_STOP) != 0;
 }
 
-void SedInstanceTask::Impl::run(double pVoiStart, double pVoiEnd, double pVoiInterval, bool pTrackResults)
+void SedInstanceTask::Impl::run(double pVoiStart, double pVoiEnd, double pVoiInterval, bool pTrackResults, size_t pFirstStep)
 {
+    // Keep track of where we are in our simulation, so that we can checkpoint it.
+
+    mPhase = pTrackResults ? SedInstanceTaskPhase::OUTPUT : SedInstanceTaskPhase::PRE_OUTPUT;
+    mPhaseVoiStart = pVoiStart;
+    mPhaseVoiEnd = pVoiEnd;
+    mPhaseVoiInterval = pVoiInterval;
+    mPhaseStep = pFirstStep;
+
     // Track our initial results.
+    // Note: if we resume our simulation from a checkpoint then our "initial" results are those of the checkpoint.
 
-    size_t index {0};
+    size_t index {pTrackResults ? pFirstStep : 0};
 
     if (pTrackResults) {
         trackResults(index);
@@ -324,12 +502,16 @@ void SedInstanceTask::Impl::run(double pVoiStart, double pVoiEnd, double pVoiInt
     // Set up a guard function to fill the tail of our results with NaN values in case we exit this function before
     // reaching the end of our simulation.
 
-    auto guard = [this, &index, pTrackResults]() {
+    size_t completedSteps {mCompletedSteps.load(std::memory_order_relaxed)};
+
+    auto guard = [this, &index, &completedSteps, pTrackResults]() {
+        mCompletedSteps.store(completedSteps, std::memory_order_relaxed);
+
         if (!pTrackResults) {
             return;
         }
 
-        auto nanFillRowTails = [index, this](Doubles &pResults, size_t pCount) {
+        auto nanFillRowTails = [index, this](std::span<double> pResults, size_t pCount) {
             for (size_t i {0}; i < pCount; ++i) {
                 const auto rowStart {i * mResults.resultsSize};
 
@@ -348,60 +530,93 @@ void SedInstanceTask::Impl::run(double pVoiStart, double pVoiEnd, double pVoiInt
         nanFillRowTails(mResults.constants, mConstantCount);
         nanFillRowTails(mResults.computedConstants, mComputedConstantCount);
         nanFillRowTails(mResults.algebraicVariables, mAlgebraicVariableCount);
+        nanFillRowTails(mResults.sensitivities, mSensitivityParameterCount * mStateCount);
     };
 
     // Compute the differential model.
 
     auto *odeSolverPimpl {mOdeSolver->pimpl()};
-    size_t voiCounter {0};
+    const auto checkpointInterval {mCheckpointInterval};
+    const auto instrumented {mInstrumented};
+    TimePoint startTime;
+    size_t voiCounter {pFirstStep};
+    size_t runControlCheckInterval {1};
+    size_t stepsBeforeRunControlCheck {0};
+    auto lastRunControlCheckTime {std::chrono::steady_clock::now()};
 
 #ifndef __EMSCRIPTEN__
     const auto computeVariablesForDifferentialModel = mRuntime->computeVariablesForDifferentialModel();
 #endif
 
     while (!fuzzyCompare(mVoi, pVoiEnd)) {
-        // Check whether a pause or stop has been requested.
+        // Check whether a pause or stop has been requested, publishing our progress at the same time.
+        // Note: we only do this every runControlCheckInterval steps, an interval that we adapt so that our checks
+        //       happen about every RUN_CONTROL_CHECK_PERIOD (see RUN_CONTROL_CHECK_PERIOD for the actual latency).
 
-        const auto runControl = mRunControl->load(std::memory_order_relaxed);
+        if (stepsBeforeRunControlCheck == 0) {
+            const auto elapsedTime {std::chrono::steady_clock::now() - lastRunControlCheckTime};
 
-        if ((runControl & INSTANCE_RUN_CONTROL_PAUSE) != 0) {
-            std::unique_lock<std::mutex> pauseLock(*mPauseMutex);
+            if (elapsedTime < RUN_CONTROL_CHECK_PERIOD / 2) {
+                runControlCheckInterval = std::min(2 * runControlCheckInterval, MAXIMUM_RUN_CONTROL_CHECK_INTERVAL);
+            } else if (elapsedTime > RUN_CONTROL_CHECK_PERIOD) {
+                runControlCheckInterval = 1;
+            }
 
-            mPauseConditionVariable->wait(pauseLock, [this]() {
-                const auto crtRunControl = mRunControl->load(std::memory_order_relaxed);
+            stepsBeforeRunControlCheck = runControlCheckInterval;
 
-                return ((crtRunControl & INSTANCE_RUN_CONTROL_PAUSE) == 0) || ((crtRunControl & INSTANCE_RUN_CONTROL_STOP) != 0);
-            });
+            mCompletedSteps.store(completedSteps, std::memory_order_relaxed);
 
-            if ((mRunControl->load(std::memory_order_relaxed) & INSTANCE_RUN_CONTROL_STOP) != 0) {
+            if (stopRequested()) {
                 guard();
 
                 return;
             }
-        }
 
-        if ((runControl & INSTANCE_RUN_CONTROL_STOP) != 0) {
-            guard();
+            // Don't account for the time we may have been paused when adapting our interval.
 
-            return;
+            lastRunControlCheckTime = std::chrono::steady_clock::now();
         }
 
+        --stepsBeforeRunControlCheck;
+
         // Update our model's state.
 
-        if (!odeSolverPimpl->solve(mVoi, std::min(pVoiStart + static_cast<double>(++voiCounter) * pVoiInterval, pVoiEnd))) {
+        if (instrumented) {
+            startTime = std::chrono::high_resolution_clock::now();
+        }
+
+        auto solved {false};
+
+        {
+            const TraceScope traceScope {"SolverOde::solve", "solver"};
+
+            solved = odeSolverPimpl->solve(mVoi, std::min(pVoiStart + static_cast<double>(++voiCounter) * pVoiInterval, pVoiEnd));
+        }
+
+        if (!solved) {
             addIssues(mOdeSolver, mOdeSolver->name());
 
+            mContinuable = false;
+
             guard();
 
             return;
         }
 
+        if (instrumented) {
+            trackPhaseTime(Phase::ODE_SOLVING, startTime);
+        }
+
 #ifdef __EMSCRIPTEN__
         mRuntime->computeVariablesForDifferentialModel(mVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
 #else
         computeVariablesForDifferentialModel(mVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
 #endif
 
+        if (instrumented) {
+            trackPhaseTime(Phase::VARIABLE_COMPUTATION, startTime);
+        }
+
         //---GRY--- WE NEED TO CHECK FOR POSSIBLE NLA ISSUES, BUT FOR CODE COVERAGE WE NEED A MODEL THAT WOULD TRIGGER
         //          NLA ISSUES HERE, WHICH WE DON'T HAVE YET HENCE WE DISABLE THE FOLLOWING CODE WHEN DOING CODE
         //          COVERAGE.
@@ -410,6 +625,8 @@ void SedInstanceTask::Impl::run(double pVoiStart, double pVoiEnd, double pVoiInt
         if ((mNlaSolver != nullptr) && mNlaSolver->hasIssues()) {
             addIssues(mNlaSolver, mNlaSolver->name());
 
+            mContinuable = false;
+
             guard();
 
             return;
@@ -417,321 +634,1298 @@ void SedInstanceTask::Impl::run(double pVoiStart, double pVoiEnd, double pVoiInt
 #endif
 
         // Update our progress.
+        // Note: our progress is only published when checking for a pause or stop, when taking a checkpoint, and when
+        //       we are done.
 
-        mCompletedSteps.fetch_add(1, std::memory_order_relaxed);
+        ++completedSteps;
 
         // Track our results, if needed.
 
         if (pTrackResults) {
             trackResults(++index);
+
+            if (instrumented) {
+                trackPhaseTime(Phase::RESULT_RECORDING, startTime);
+            }
+        }
+
+        // Take a checkpoint, if needed.
+
+        mPhaseStep = voiCounter;
+
+        if ((checkpointInterval != 0) && (voiCounter % checkpointInterval == 0)) {
+            mCompletedSteps.store(completedSteps, std::memory_order_relaxed);
+
+            takeCheckpoint();
         }
     }
+
+    mCompletedSteps.store(completedSteps, std::memory_order_relaxed);
 }
 
-double SedInstanceTask::Impl::run()
+double SedInstanceTask::Impl::maximumAbsoluteRate() const
 {
-    // Start our timer.
+    auto res {0.0};
 
-    auto startTime {std::chrono::high_resolution_clock::now()};
+    for (size_t i {0}; i < mStateCount; ++i) {
+        if (isInfOrNan(mRates[i])) { // NOLINT
+            return INF;
+        }
 
-    // Reset our progress counters.
+        res = std::max(res, std::fabs(mRates[i])); // NOLINT
+    }
 
-    const auto *sedUniformTimeCoursePimpl {mDifferentialModel ? mSedUniformTimeCourse->pimpl() : nullptr};
-    const auto totalSteps {mDifferentialModel ? static_cast<size_t>(sedUniformTimeCoursePimpl->mNumberOfSteps) : 1};
+    return res;
+}
 
-    mCompletedSteps.store(0, std::memory_order_relaxed);
-    mTotalSteps.store(totalSteps, std::memory_order_relaxed);
+#ifndef __EMSCRIPTEN__
+bool SedInstanceTask::Impl::solveSteadyState()
+{
+    // Use Newton's method, through KINSOL, to find the states for which all our rates are zero, starting from our
+    // current states.
 
-    // (Re)initialise our model.
-    // Note: reinitialise our model because we initialised it when we created the instance task.
+    const TraceScope traceScope {"SolverNla::solve", "solver"};
+    Doubles states(mStates, mStates + mStateCount); // NOLINT
 
-    initialise();
+    if (!mSteadyStateSolver->pimpl()->solve(computeSteadyStateObjectiveFunction, states.data(), mStateCount, this)) {
+        return false;
+    }
 
-    // Compute our model, unless it's an algebraic/NLA model in which case we are already done.
+    // Make sure that KINSOL found an actual steady state (rather than, say, stalled) before using it.
 
-    if (mDifferentialModel) {
-        // Run our simulation from the initial time to the output start time, without tracking our results, but only if
-        // the output start time is after the initial time.
+    mRuntime->computeRates()(mVoi, states.data(), mRates, mConstants, mComputedConstants, mAlgebraicVariables);
 
-        const auto voiInterval {(sedUniformTimeCoursePimpl->mOutputEndTime - sedUniformTimeCoursePimpl->mOutputStartTime) / sedUniformTimeCoursePimpl->mNumberOfSteps};
+    if (maximumAbsoluteRate() > STEADY_STATE_TOLERANCE) {
+        return false;
+    }
 
-        if (!fuzzyCompare(sedUniformTimeCoursePimpl->mInitialTime, sedUniformTimeCoursePimpl->mOutputStartTime)) {
-            run(sedUniformTimeCoursePimpl->mInitialTime, sedUniformTimeCoursePimpl->mOutputStartTime, voiInterval, false);
+    std::copy(states.cbegin(), states.cend(), mStates);
 
-            if (hasIssues()) {
-                return 0.0;
-            }
-        }
+    return true;
+}
+#endif
 
-        // Initialise our results structure.
+bool SedInstanceTask::Impl::computeSteadyState()
+{
+    // Compute our steady state directly, i.e. by solving rates = 0 using Newton's method. If that fails (e.g., because
+    // our initial states are too far from our steady state), then integrate our model in time, using our ODE solver,
+    // over longer and longer intervals of time (each interval being twice as long as the previous one), trying Newton's
+    // method again after each of them, until our rates vanish.
+    // Note: this is not pseudo-transient continuation, which would take implicit Euler steps of increasing size using
+    //       Newton's method, but a plain time integration, which relies on our model's dynamics (and our ODE solver)
+    //       to bring us close enough to our steady state. It is slower, but it works with any ODE solver and it
+    //       doesn't require a Jacobian.
+    // Note: on the JavaScript side, KINSOL can only be used with JIT-compiled objective functions, so we only
+    //       integrate our model in time.
 
-        const auto resultsSize {totalSteps + 1};
+#ifdef __EMSCRIPTEN__
+    auto steadyStateFound {false};
+#else
+    auto steadyStateFound {solveSteadyState()};
+#endif
+    auto *odeSolverPimpl {mOdeSolver->pimpl()};
+    auto interval {STEADY_STATE_INITIAL_INTEGRATION_INTERVAL};
 
-        mResults.resultsSize = resultsSize;
+    for (size_t i {0}; !steadyStateFound && (i < STEADY_STATE_MAXIMUM_NUMBER_OF_INTEGRATION_INTERVALS); ++i) {
+        // Check whether a pause or stop has been requested, since integrating our model may take a while, especially if
+        // it doesn't converge to a steady state.
 
-        mResults.voi.resize(resultsSize);
-        mResults.states.resize(mStateCount * resultsSize);
-        mResults.rates.resize(mStateCount * resultsSize);
-        mResults.constants.resize(mConstantCount * resultsSize);
-        mResults.computedConstants.resize(mComputedConstantCount * resultsSize);
-        mResults.algebraicVariables.resize(mAlgebraicVariableCount * resultsSize);
+        if (stopRequested()) {
+            return false;
+        }
 
-        // Run our simulation from the output start time to the output end time, tracking our results.
+        auto solved {false};
 
-        run(sedUniformTimeCoursePimpl->mOutputStartTime, sedUniformTimeCoursePimpl->mOutputEndTime, voiInterval, true);
+        {
+            const TraceScope traceScope {"SolverOde::solve", "solver"};
 
-        if (hasIssues()) {
-            return 0.0;
+            solved = odeSolverPimpl->solve(mVoi, mVoi + interval);
         }
-    } else {
-        // Track our results.
-
-        mResults.resultsSize = 1;
 
-        mResults.constants.resize(mConstantCount);
-        mResults.computedConstants.resize(mComputedConstantCount);
-        mResults.algebraicVariables.resize(mAlgebraicVariableCount);
+        if (!solved) {
+            addIssues(mOdeSolver, mOdeSolver->name());
 
-        for (size_t i {0}; i < mConstantCount; ++i) {
-            mResults.constants[i] = mConstants[i]; // NOLINT
+            return false;
         }
 
-        for (size_t i {0}; i < mComputedConstantCount; ++i) {
-            mResults.computedConstants[i] = mComputedConstants[i]; // NOLINT
-        }
+#ifdef __EMSCRIPTEN__
+        steadyStateFound = maximumAbsoluteRate() <= STEADY_STATE_TOLERANCE;
+#else
+        steadyStateFound = (maximumAbsoluteRate() <= STEADY_STATE_TOLERANCE) || solveSteadyState();
+#endif
 
-        for (size_t i {0}; i < mAlgebraicVariableCount; ++i) {
-            mResults.algebraicVariables[i] = mAlgebraicVariables[i]; // NOLINT
+        interval *= 2.0;
+    }
+
+    if (!steadyStateFound) {
+        addError("The steady state could not be found.");
+
+        return false;
+    }
+
+    // Compute our rates and variables at our steady state and track them as our results.
+
+#ifdef __EMSCRIPTEN__
+    mRuntime->computeRates(mVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
+    mRuntime->computeVariablesForDifferentialModel(mVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
+#else
+    mRuntime->computeRates()(mVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
+    mRuntime->computeVariablesForDifferentialModel()(mVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraicVariables);
+#endif
+
+    if ((mNlaSolver != nullptr) && mNlaSolver->hasIssues()) {
+        addIssues(mNlaSolver, mNlaSolver->name());
+
+        return false;
+    }
+
+    resizeResults(1);
+    trackResults(0);
+
+    return true;
+}
+
+bool SedInstanceTask::Impl::computeObjectiveGradient(double pVoiStart)
+{
+    // Compute our objective, i.e. the sum of the squared errors between our states and our objective data, as well as
+    // the jumps in our adjoints at each output point, i.e. the derivatives of our objective with respect to our states.
+
+    const auto resultsSize {mResults.resultsSize};
+    Doubles adjointJumps(resultsSize * mStateCount, 0.0);
+
+    mObjective = 0.0;
+
+    for (const auto &[stateIndex, values] : mObjectiveData) {
+        for (size_t k {0}; k < resultsSize; ++k) {
+            if (!std::isnan(values[k])) {
+                const auto error {mResults.states[stateIndex * resultsSize + k] - values[k]};
+
+                mObjective += error * error;
+
+                adjointJumps[k * mStateCount + stateIndex] = 2.0 * error;
+            }
         }
+    }
 
-        mCompletedSteps.store(1, std::memory_order_relaxed);
+    // Compute the gradient of our objective with respect to our constants by integrating our adjoint problem backward.
+
+    if (!mCvodeSolver->pimpl()->solveAdjoint(pVoiStart, mResults.voi, adjointJumps, mObjectiveGradient)) {
+        addIssues(mOdeSolver, mOdeSolver->name());
+
+        mObjective = NAN;
+
+        return false;
     }
 
-    // Stop our timer and return the elapsed time in milliseconds.
+    return true;
+}
 
-    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+double SedInstanceTask::Impl::outputVoiInterval() const
+{
+    // Return the interval between two output points of our uniform time course.
+
+    const auto *sedUniformTimeCoursePimpl {mSedUniformTimeCourse->pimpl()};
+
+    return (sedUniformTimeCoursePimpl->mOutputEndTime - sedUniformTimeCoursePimpl->mOutputStartTime) / sedUniformTimeCoursePimpl->mNumberOfSteps;
 }
 
-double SedInstanceTask::Impl::progress() const noexcept
+double SedInstanceTask::Impl::resumeRun()
 {
-    const auto totalSteps {mTotalSteps.load(std::memory_order_relaxed)};
+    // Start our timer.
+
+    const TraceScope traceScope {"SedInstanceTask::resumeRun", "sed"};
+    auto startTime {std::chrono::high_resolution_clock::now()};
+
+    // Our objective and its gradient don't apply to a resumed simulation.
+
+    mRestored = false;
+    mObjective = NAN;
+
+    mObjectiveGradient.clear();
+
+    // Resume our simulation from where it was checkpointed, i.e. either from before the output start time, in which
+    // case we then need to run our simulation from the output start time to the output end time, or from after it.
+    // Note: our progress counters were restored from our checkpoint.
+
+    if (mPhase == SedInstanceTaskPhase::PRE_OUTPUT) {
+        const auto *sedUniformTimeCoursePimpl {mSedUniformTimeCourse->pimpl()};
+
+        run(mPhaseVoiStart, mPhaseVoiEnd, mPhaseVoiInterval, false, mPhaseStep);
+
+        if (hasIssues()) {
+            return 0.0;
+        }
+
+        resizeResults(static_cast<size_t>(sedUniformTimeCoursePimpl->mNumberOfSteps) + 1);
+
+        run(sedUniformTimeCoursePimpl->mOutputStartTime, sedUniformTimeCoursePimpl->mOutputEndTime, outputVoiInterval(), true, 0);
+    } else {
+        run(mPhaseVoiStart, mPhaseVoiEnd, mPhaseVoiInterval, true, mPhaseStep);
+    }
+
+    if (hasIssues()) {
+        return 0.0;
+    }
+
+    // Stop our timer and return the elapsed time in milliseconds.
+
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+double SedInstanceTask::Impl::run()
+{
+    // Resume our simulation if we were restored from a checkpoint.
+
+    if (mRestored) {
+        return resumeRun();
+    }
+
+    // Start our timer.
+
+    const TraceScope traceScope {"SedInstanceTask::run", "sed"};
+    auto startTime {std::chrono::high_resolution_clock::now()};
+
+    // Reset our progress counters.
+
+    const auto *sedUniformTimeCoursePimpl {(mSedUniformTimeCourse != nullptr) ? mSedUniformTimeCourse->pimpl() : nullptr};
+    const auto totalSteps {(sedUniformTimeCoursePimpl != nullptr) ? static_cast<size_t>(sedUniformTimeCoursePimpl->mNumberOfSteps) : 1};
+
+    mCompletedSteps.store(0, std::memory_order_relaxed);
+    mTotalSteps.store(totalSteps, std::memory_order_relaxed);
+
+    // (Re)initialise our model.
+    // Note: reinitialise our model because we initialised it when we created the instance task. This is cheap since
+    //       the values of our model arrays and our ODE solver are only reinitialised.
+
+    auto initialisationStartTime {std::chrono::high_resolution_clock::now()};
+
+    initialise();
+
+    if (mInstrumented) {
+        trackPhaseTime(Phase::INITIALISATION, initialisationStartTime);
+
+        // Our ODE solver was (re)initialised, which reset its statistics.
+
+        mInitialOdeStatistics = {};
+    }
+
+    // Reset our objective and its gradient and, if we have some objective data, make sure that we can compute its
+    // gradient, i.e. that we use CVODE and that our model has some constants, and get CVODE to keep track of the
+    // checkpoints needed to compute it.
+
+    const auto computeObjective {!mObjectiveData.empty()};
+
+    mObjective = NAN;
+
+    mObjectiveGradient.clear();
+
+    if (computeObjective) {
+        if (mCvodeSolver == nullptr) {
+            addError("The gradient of an objective can only be computed using CVODE.");
+
+            return 0.0;
+        }
+
+        if (mConstantCount == 0) {
+            addError("The gradient of an objective cannot be computed for a model that has no constants.");
+
+            return 0.0;
+        }
+
+        mCvodeSolver->pimpl()->initialiseAdjoint(mVoi, mConstantCount, mAlgebraicVariableCount);
+
+        // CVODE now has some adjoint memory, so it will need to be fully initialised the next time we are run and our
+        // simulation cannot be continued since computing the gradient of our objective integrates backward in time.
+
+        mOdeSolverReinitialisable = false;
+        mContinuable = false;
+    }
+
+    // Compute our model, i.e. its steady state or its time course, unless it's an algebraic/NLA model in which case we
+    // are already done.
+
+    if (mSedSteadyState != nullptr) {
+        if (!computeSteadyState()) {
+            return 0.0;
+        }
+
+        mCompletedSteps.store(1, std::memory_order_relaxed);
+    } else if (sedUniformTimeCoursePimpl != nullptr) {
+        // Run our simulation from the initial time to the output start time, without tracking our results, but only if
+        // the output start time is after the initial time.
+
+        const auto voiInterval {outputVoiInterval()};
+
+        if (!fuzzyCompare(sedUniformTimeCoursePimpl->mInitialTime, sedUniformTimeCoursePimpl->mOutputStartTime)) {
+            run(sedUniformTimeCoursePimpl->mInitialTime, sedUniformTimeCoursePimpl->mOutputStartTime, voiInterval, false, 0);
+
+            if (hasIssues()) {
+                return 0.0;
+            }
+        }
+
+        // Initialise our results structure.
+
+        resizeResults(totalSteps + 1);
+
+        // Run our simulation from the output start time to the output end time, tracking our results.
+
+        run(sedUniformTimeCoursePimpl->mOutputStartTime, sedUniformTimeCoursePimpl->mOutputEndTime, voiInterval, true, 0);
+
+        if (hasIssues()) {
+            return 0.0;
+        }
+
+        // Compute the gradient of our objective, if needed and if our simulation hasn't been stopped.
+
+        if (computeObjective
+            && ((mRunControl->load(std::memory_order_relaxed) & INSTANCE_RUN_CONTROL_STOP) == 0)
+            && !computeObjectiveGradient(sedUniformTimeCoursePimpl->mInitialTime)) {
+            return 0.0;
+        }
+    } else {
+        // Track our results.
+
+        resizeResults(1);
+
+        for (size_t i {0}; i < mConstantCount; ++i) {
+            mResults.constants[i] = mConstants[i]; // NOLINT
+        }
+
+        for (size_t i {0}; i < mComputedConstantCount; ++i) {
+            mResults.computedConstants[i] = mComputedConstants[i]; // NOLINT
+        }
+
+        for (size_t i {0}; i < mAlgebraicVariableCount; ++i) {
+            mResults.algebraicVariables[i] = mAlgebraicVariables[i]; // NOLINT
+        }
+
+        mCompletedSteps.store(1, std::memory_order_relaxed);
+    }
+
+    // Stop our timer and return the elapsed time in milliseconds.
+
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+double SedInstanceTask::Impl::continueRun(double pEndTime, int pNumberOfSteps)
+{
+    // Start our timer.
+
+    const TraceScope traceScope {"SedInstanceTask::continueRun", "sed"};
+    auto startTime {std::chrono::high_resolution_clock::now()};
+
+    // Make sure that our simulation can be continued.
+
+    if (mSedUniformTimeCourse == nullptr) {
+        addError("Only a differential model simulated using a uniform time course can be continued.");
+
+        return 0.0;
+    }
+
+    if (!mContinuable) {
+        addError("The simulation cannot be continued since it either failed or computed the gradient of an objective.");
+
+        return 0.0;
+    }
+
+    if (pEndTime <= mVoi) {
+        const auto endTime {toString(pEndTime)};
+        const auto voi {toString(mVoi)};
+        std::string error;
+
+        error.reserve(endTime.size() + voi.size() + 51); // NOLINT
+
+        error += "The end time (";
+        error += endTime;
+        error += ") must be greater than the current time (";
+        error += voi;
+        error += ").";
+
+        addError(std::move(error));
+
+        return 0.0;
+    }
+
+    if (pNumberOfSteps <= 0) {
+        const auto numberOfSteps {toString(pNumberOfSteps)};
+        std::string error;
+
+        error.reserve(numberOfSteps.size() + 46); // NOLINT
+
+        error += "The number of steps (";
+        error += numberOfSteps;
+        error += ") must be greater than 0.";
+
+        addError(std::move(error));
+
+        return 0.0;
+    }
+
+    // Reset our progress counters, as well as our objective and its gradient, since they don't apply to our continued
+    // simulation, and make sure that we won't resume from a checkpoint the next time we are run.
+
+    const auto totalSteps {static_cast<size_t>(pNumberOfSteps)};
+
+    mCompletedSteps.store(0, std::memory_order_relaxed);
+    mTotalSteps.store(totalSteps, std::memory_order_relaxed);
+
+    mObjective = NAN;
+
+    mObjectiveGradient.clear();
+
+    mRestored = false;
+
+    // Continue our simulation from our current state, tracking our results.
+
+    const auto voiStart {mVoi};
+
+    resizeResults(totalSteps + 1);
+
+    run(voiStart, pEndTime, (pEndTime - voiStart) / static_cast<double>(pNumberOfSteps), true, 0);
+
+    if (hasIssues()) {
+        return 0.0;
+    }
+
+    // Stop our timer and return the elapsed time in milliseconds.
+
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+double SedInstanceTask::Impl::progress() const noexcept
+{
+    const auto totalSteps {mTotalSteps.load(std::memory_order_relaxed)};
+
+    if (totalSteps == 0) {
+        return 0.0;
+    }
+
+    return static_cast<double>(mCompletedSteps.load(std::memory_order_relaxed)) / static_cast<double>(totalSteps);
+}
+
+std::span<const double> SedInstanceTask::Impl::voi() const noexcept
+{
+    if (mDifferentialModel) {
+        return mResults.voi;
+    }
+
+    return {};
+}
+
+const std::string &SedInstanceTask::Impl::voiName() const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (mDifferentialModel) {
+        return mCellmlFile->metadata().voiName;
+    }
+
+    return NO_STRING;
+}
+
+const std::string &SedInstanceTask::Impl::voiUnit() const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (mDifferentialModel) {
+        return mCellmlFile->metadata().voiUnit;
+    }
+
+    return NO_STRING;
+}
+
+size_t SedInstanceTask::Impl::stateCount() const noexcept
+{
+    return mStateCount;
+}
+
+std::span<const double> SedInstanceTask::Impl::state(size_t pIndex) const noexcept
+{
+    if (!mDifferentialModel || (pIndex >= mStateCount)) {
+        return {};
+    }
+
+    return std::span(mResults.states).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
+}
+
+const std::string &SedInstanceTask::Impl::stateName(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (!mDifferentialModel || (pIndex >= mStateCount)) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().stateNames[pIndex];
+}
+
+const std::string &SedInstanceTask::Impl::stateUnit(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (!mDifferentialModel || (pIndex >= mStateCount)) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().stateUnits[pIndex];
+}
+
+size_t SedInstanceTask::Impl::rateCount() const noexcept
+{
+    return stateCount();
+}
+
+std::span<const double> SedInstanceTask::Impl::rate(size_t pIndex) const noexcept
+{
+    if (!mDifferentialModel || (pIndex >= mStateCount)) {
+        return {};
+    }
+
+    return std::span(mResults.rates).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
+}
+
+const std::string &SedInstanceTask::Impl::rateName(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (!mDifferentialModel || (pIndex >= mStateCount)) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().rateNames[pIndex];
+}
+
+const std::string &SedInstanceTask::Impl::rateUnit(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (!mDifferentialModel || (pIndex >= mStateCount)) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().rateUnits[pIndex];
+}
+
+size_t SedInstanceTask::Impl::constantCount() const noexcept
+{
+    return mConstantCount;
+}
+
+std::span<const double> SedInstanceTask::Impl::constant(size_t pIndex) const noexcept
+{
+    if (pIndex >= mConstantCount) {
+        return {};
+    }
+
+    return std::span(mResults.constants).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
+}
+
+const std::string &SedInstanceTask::Impl::constantName(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (pIndex >= mConstantCount) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().constantNames[pIndex];
+}
+
+const std::string &SedInstanceTask::Impl::constantUnit(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (pIndex >= mConstantCount) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().constantUnits[pIndex];
+}
+
+size_t SedInstanceTask::Impl::computedConstantCount() const noexcept
+{
+    return mComputedConstantCount;
+}
+
+std::span<const double> SedInstanceTask::Impl::computedConstant(size_t pIndex) const noexcept
+{
+    if (pIndex >= mComputedConstantCount) {
+        return {};
+    }
+
+    return std::span(mResults.computedConstants).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
+}
+
+const std::string &SedInstanceTask::Impl::computedConstantName(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (pIndex >= mComputedConstantCount) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().computedConstantNames[pIndex];
+}
+
+const std::string &SedInstanceTask::Impl::computedConstantUnit(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (pIndex >= mComputedConstantCount) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().computedConstantUnits[pIndex];
+}
+
+size_t SedInstanceTask::Impl::algebraicVariableCount() const noexcept
+{
+    return mAlgebraicVariableCount;
+}
+
+std::span<const double> SedInstanceTask::Impl::algebraicVariable(size_t pIndex) const noexcept
+{
+    if (pIndex >= mAlgebraicVariableCount) {
+        return {};
+    }
+
+    return std::span(mResults.algebraicVariables).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
+}
+
+const std::string &SedInstanceTask::Impl::algebraicVariableName(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (pIndex >= mAlgebraicVariableCount) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().algebraicVariableNames[pIndex];
+}
+
+const std::string &SedInstanceTask::Impl::algebraicVariableUnit(size_t pIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (pIndex >= mAlgebraicVariableCount) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().algebraicVariableUnits[pIndex];
+}
+
+size_t SedInstanceTask::Impl::sensitivityParameterCount() const noexcept
+{
+    return mSensitivityParameterCount;
+}
+
+const std::string &SedInstanceTask::Impl::sensitivityParameterName(size_t pParameterIndex) const noexcept
+{
+    static const std::string NO_STRING;
+
+    if (pParameterIndex >= mSensitivityParameterCount) {
+        return NO_STRING;
+    }
+
+    const auto constantIndex {mCvodeSolver->sensitivityParameter(pParameterIndex)};
+
+    if (constantIndex >= mConstantCount) {
+        return NO_STRING;
+    }
+
+    return mCellmlFile->metadata().constantNames[constantIndex];
+}
+
+std::span<const double> SedInstanceTask::Impl::sensitivity(size_t pStateIndex, size_t pParameterIndex) const noexcept
+{
+    if ((pStateIndex >= mStateCount) || (pParameterIndex >= mSensitivityParameterCount)
+        || mResults.sensitivities.empty()) {
+        return {};
+    }
+
+    return std::span(mResults.sensitivities).subspan((pParameterIndex * mStateCount + pStateIndex) * mResults.resultsSize, mResults.resultsSize);
+}
+
+bool SedInstanceTask::Impl::setInitialState(size_t pIndex, double pValue)
+{
+    if (!mDifferentialModel || (pIndex >= mStateCount)) {
+        return false;
+    }
+
+    mInitialStateValues[pIndex] = pValue;
+
+    return true;
+}
+
+bool SedInstanceTask::Impl::setConstant(size_t pIndex, double pValue)
+{
+    if (pIndex >= mConstantCount) {
+        return false;
+    }
+
+    mConstantValues[pIndex] = pValue;
+
+    return true;
+}
+
+bool SedInstanceTask::Impl::resetInitialStatesAndConstants()
+{
+    if (mInitialStateValues.empty() && mConstantValues.empty()) {
+        return false;
+    }
+
+    mInitialStateValues.clear();
+    mConstantValues.clear();
+
+    return true;
+}
+
+bool SedInstanceTask::Impl::addObjectiveData(size_t pStateIndex, const Doubles &pValues)
+{
+    if ((mSedUniformTimeCourse == nullptr) || (pStateIndex >= mStateCount)
+        || (pValues.size() != static_cast<size_t>(mSedUniformTimeCourse->pimpl()->mNumberOfSteps) + 1)) {
+        return false;
+    }
+
+    mObjectiveData[pStateIndex] = pValues;
+
+    return true;
+}
+
+bool SedInstanceTask::Impl::removeAllObjectiveData()
+{
+    if (mObjectiveData.empty()) {
+        return false;
+    }
+
+    mObjectiveData.clear();
+
+    return true;
+}
+
+double SedInstanceTask::Impl::objective() const noexcept
+{
+    return mObjective;
+}
+
+std::span<const double> SedInstanceTask::Impl::objectiveGradient() const noexcept
+{
+    return mObjectiveGradient;
+}
+
+UnsignedChars SedInstanceTask::Impl::serialiseState() const
+{
+    // Serialise our state, i.e. where we are in our simulation, the values of our model arrays, the size of our
+    // results, and the internal state of our ODE solver.
+    // Note: values are serialised using the native byte order, so a checkpoint can only be restored on a platform with
+    //       the same byte order.
+
+    const auto odeSolverState {mOdeSolver->pimpl()->checkpointState()};
+    size_t valueCount {odeSolverState.size()};
+
+    for (const auto &[array, count] : modelArrays()) {
+        valueCount += count;
+    }
+
+    UnsignedChars res;
+
+    res.reserve(CHECKPOINT_SIGNATURE.size() + 128 + valueCount * sizeof(double)); // NOLINT
+
+    appendBytes(res, CHECKPOINT_SIGNATURE.data(), CHECKPOINT_SIGNATURE.size());
+    appendValue(res, CHECKPOINT_VERSION);
+    appendValue(res, static_cast<uint32_t>(mPhase));
+    appendValue(res, mVoi);
+    appendValue(res, mPhaseVoiStart);
+    appendValue(res, mPhaseVoiEnd);
+    appendValue(res, mPhaseVoiInterval);
+    appendValue<uint64_t>(res, mPhaseStep);
+    appendValue<uint64_t>(res, mCompletedSteps.load(std::memory_order_relaxed));
+    appendValue<uint64_t>(res, mTotalSteps.load(std::memory_order_relaxed));
+
+    for (const auto &[array, count] : modelArrays()) {
+        appendValues(res, array, count);
+    }
+
+    appendValue<uint64_t>(res, mResults.resultsSize);
+    appendValues(res, odeSolverState.data(), odeSolverState.size());
+
+    return res;
+}
+
+std::array<std::pair<std::span<const double>, size_t>, 6> SedInstanceTask::Impl::checkpointResults() const
+{
+    return {{
+        {mResults.voi, 1},
+        {mResults.states, mStateCount},
+        {mResults.rates, mStateCount},
+        {mResults.constants, mConstantCount},
+        {mResults.computedConstants, mComputedConstantCount},
+        {mResults.algebraicVariables, mAlgebraicVariableCount},
+    }};
+}
+
+size_t SedInstanceTask::Impl::checkpointResultsCount() const
+{
+    // Return the number of steps for which we have some results, i.e. none before the output start time, the steps up
+    // to (and including) our current step after the output start time, and all of them otherwise (e.g., if we have
+    // never been run).
+
+    if (mPhase == SedInstanceTaskPhase::PRE_OUTPUT) {
+        return 0;
+    }
+
+    if (mPhase == SedInstanceTaskPhase::OUTPUT) {
+        return std::min(mPhaseStep + 1, mResults.resultsSize);
+    }
+
+    return mResults.resultsSize;
+}
+
+void SedInstanceTask::Impl::serialiseResults(UnsignedChars &pCheckpoint, size_t pFrom, size_t pTo) const
+{
+    // Serialise our results from the given step to the given one (excluded), one step at a time, so that the results
+    // of new steps can simply be appended to those of previous steps.
+
+    const auto results {checkpointResults()};
+    size_t valueCount {0};
+
+    for (const auto &[values, count] : results) {
+        valueCount += count;
+    }
+
+    pCheckpoint.reserve(pCheckpoint.size() + (pTo - pFrom) * valueCount * sizeof(double));
+
+    for (size_t i {pFrom}; i < pTo; ++i) {
+        for (const auto &[values, count] : results) {
+            for (size_t j {0}; j < count; ++j) {
+                appendValue(pCheckpoint, values[j * mResults.resultsSize + i]);
+            }
+        }
+    }
+}
+
+UnsignedChars SedInstanceTask::Impl::serialise() const
+{
+    // Serialise our full state, i.e. our state followed by our results so far.
+
+    auto res {serialiseState()};
+    const auto resultsCount {checkpointResultsCount()};
+
+    appendValue<uint64_t>(res, resultsCount);
+
+    serialiseResults(res, 0, resultsCount);
+
+    return res;
+}
+
+void SedInstanceTask::Impl::takeCheckpoint()
+{
+    // Serialise our state and the results of the steps since our previous checkpoint outside of our lock, so that
+    // retrieving our latest checkpoint never has to wait for it.
+    // Note: the results of the steps before our previous checkpoint cannot change during a run, so they don't need to
+    //       be serialised again, which means that the cost of a checkpoint is proportional to the number of steps since
+    //       our previous checkpoint rather than to the number of steps so far. Still, we serialise our results from
+    //       scratch should we have fewer of them than at our previous checkpoint.
+
+    auto checkpoint {serialiseState()};
+    const auto resultsCount {checkpointResultsCount()};
+    const auto fromScratch {resultsCount < mCheckpointResultsCount};
+    UnsignedChars results;
+
+    serialiseResults(results, fromScratch ? 0 : mCheckpointResultsCount, resultsCount);
+
+    const std::scoped_lock<std::mutex> checkpointLock(mCheckpointMutex);
+
+    mCheckpoint = std::move(checkpoint);
+
+    if (fromScratch) {
+        mCheckpointResults = std::move(results);
+    } else {
+        mCheckpointResults.insert(mCheckpointResults.end(), results.cbegin(), results.cend());
+    }
+
+    mCheckpointResultsCount = resultsCount;
+}
+
+void SedInstanceTask::Impl::clearCheckpoint()
+{
+    const std::scoped_lock<std::mutex> checkpointLock(mCheckpointMutex);
+
+    mCheckpoint.clear();
+    mCheckpointResults.clear();
+
+    mCheckpointResultsCount = 0;
+}
+
+size_t SedInstanceTask::Impl::checkpointInterval() const noexcept
+{
+    return mCheckpointInterval;
+}
+
+void SedInstanceTask::Impl::setCheckpointInterval(size_t pCheckpointInterval)
+{
+    mCheckpointInterval = pCheckpointInterval;
+}
+
+UnsignedChars SedInstanceTask::Impl::checkpoint() const
+{
+    // Only a differential model simulated using a uniform time course can be checkpointed.
+
+    if ((mSedUniformTimeCourse == nullptr) || hasIssues()) {
+        return {};
+    }
+
+    // Return our latest checkpoint if we are running, or a checkpoint of our current state otherwise.
+
+    if (mRunning.load(std::memory_order_acquire)) {
+        const std::scoped_lock<std::mutex> checkpointLock(mCheckpointMutex);
+
+        if (mCheckpoint.empty()) {
+            return {};
+        }
+
+        auto res {mCheckpoint};
+
+        res.reserve(res.size() + sizeof(uint64_t) + mCheckpointResults.size());
+
+        appendValue<uint64_t>(res, mCheckpointResultsCount);
+        appendBytes(res, mCheckpointResults.data(), mCheckpointResults.size());
+
+        return res;
+    }
+
+    return serialise();
+}
+
+std::optional<SedInstanceTaskCheckpoint> SedInstanceTask::Impl::parseCheckpoint(const UnsignedChars &pCheckpoint) const
+{
+    // Make sure that we can be restored.
+
+    if ((mSedUniformTimeCourse == nullptr) || hasIssues() || (mSensitivityParameterCount != 0)
+        || mRunning.load(std::memory_order_acquire)) {
+        return {};
+    }
+
+    // Deserialise the checkpoint, making sure that it is valid and that it was taken from a task like ours.
+
+    SedInstanceTaskCheckpoint res;
+    size_t offset {0};
+    std::array<unsigned char, 4> signature {};
+    uint32_t version {};
+    uint32_t phase {};
+    uint64_t phaseStep {};
+    uint64_t completedSteps {};
+    uint64_t totalSteps {};
+
+    if (!extractBytes(pCheckpoint, offset, signature.data(), signature.size()) || (signature != CHECKPOINT_SIGNATURE)
+        || !extractValue(pCheckpoint, offset, version) || (version != CHECKPOINT_VERSION)
+        || !extractValue(pCheckpoint, offset, phase) || (phase > static_cast<uint32_t>(SedInstanceTaskPhase::OUTPUT))
+        || !extractValue(pCheckpoint, offset, res.voi)
+        || !extractValue(pCheckpoint, offset, res.phaseVoiStart)
+        || !extractValue(pCheckpoint, offset, res.phaseVoiEnd)
+        || !extractValue(pCheckpoint, offset, res.phaseVoiInterval)
+        || !extractValue(pCheckpoint, offset, phaseStep)
+        || !extractValue(pCheckpoint, offset, completedSteps)
+        || !extractValue(pCheckpoint, offset, totalSteps)) {
+        return {};
+    }
+
+    res.phase = static_cast<SedInstanceTaskPhase>(phase);
+    res.phaseStep = phaseStep;
+    res.completedSteps = completedSteps;
+    res.totalSteps = totalSteps;
+
+    const auto arrays {modelArrays()};
+
+    for (size_t i {0}; i < arrays.size(); ++i) {
+        if (!extractValues(pCheckpoint, offset, res.arrayValues[i]) || (res.arrayValues[i].size() != arrays[i].second)) {
+            return {};
+        }
+    }
+
+    uint64_t resultsSize {};
+    uint64_t resultsCount {};
+
+    // Note: before the output start time, we have no results (and the size of our results is irrelevant since our
+    //       results get resized once we reach the output start time), while after it, the size of our results is
+    //       determined by our total number of steps.
+
+    if (!extractValue(pCheckpoint, offset, resultsSize)
+        || !extractValues(pCheckpoint, offset, res.odeSolverState)
+        || !extractValue(pCheckpoint, offset, resultsCount)) {
+        return {};
+    }
+
+    if (res.phase == SedInstanceTaskPhase::PRE_OUTPUT) {
+        resultsSize = 0;
+    } else if (resultsSize > totalSteps + 1) {
+        return {};
+    }
+
+    if ((resultsCount > resultsSize)
+        || ((res.phase == SedInstanceTaskPhase::OUTPUT) && (phaseStep >= resultsCount))) {
+        return {};
+    }
+
+    // Make sure that the phase of the checkpoint is consistent, so that resuming it can neither loop forever nor track
+    // more results than we can hold. Before the output start time, the phase must also match our simulation since, once
+    // it is done, we run our simulation from its output start time to its output end time.
+    // Note: after the output start time, the phase may not match our simulation since the checkpoint may have been
+    //       taken while continuing a simulation, but it must then be such that the steps left fit in our results.
+
+    if (res.phase != SedInstanceTaskPhase::NONE) {
+        if (!std::isfinite(res.phaseVoiStart) || !std::isfinite(res.phaseVoiEnd) || !std::isfinite(res.phaseVoiInterval)
+            || (res.phaseVoiInterval <= 0.0) || (res.phaseVoiEnd < res.phaseVoiStart)) {
+            return {};
+        }
+
+        if (res.phase == SedInstanceTaskPhase::PRE_OUTPUT) {
+            const auto *sedUniformTimeCoursePimpl {mSedUniformTimeCourse->pimpl()};
 
-    if (totalSteps == 0) {
-        return 0.0;
+            if (!fuzzyCompare(res.phaseVoiStart, sedUniformTimeCoursePimpl->mInitialTime)
+                || !fuzzyCompare(res.phaseVoiEnd, sedUniformTimeCoursePimpl->mOutputStartTime)
+                || !fuzzyCompare(res.phaseVoiInterval, outputVoiInterval())
+                || (totalSteps != static_cast<uint64_t>(sedUniformTimeCoursePimpl->mNumberOfSteps))) {
+                return {};
+            }
+        } else {
+            const auto stepCount {std::round((res.phaseVoiEnd - res.phaseVoiStart) / res.phaseVoiInterval)};
+
+            if ((stepCount < 1.0) || (stepCount + 1.0 != static_cast<double>(resultsSize))
+                || !fuzzyCompare(res.phaseVoiStart + stepCount * res.phaseVoiInterval, res.phaseVoiEnd)) {
+                return {};
+            }
+        }
     }
 
-    return static_cast<double>(mCompletedSteps.load(std::memory_order_relaxed)) / static_cast<double>(totalSteps);
-}
+    size_t resultsValueCount {0};
 
-std::span<const double> SedInstanceTask::Impl::voi() const noexcept
-{
-    if (mDifferentialModel) {
-        return mResults.voi;
+    for (const auto &[values, count] : checkpointResults()) {
+        resultsValueCount += count;
     }
 
-    return {};
-}
-
-const std::string &SedInstanceTask::Impl::voiName() const noexcept
-{
-    static const std::string NO_STRING;
+    const auto resultsBytes {pCheckpoint.size() - offset};
 
-    if (mDifferentialModel) {
-        return mVoiName;
+    if ((resultsCount > resultsBytes / (resultsValueCount * sizeof(double)))
+        || (resultsBytes != resultsCount * resultsValueCount * sizeof(double))) {
+        return {};
     }
 
-    return NO_STRING;
-}
+    res.resultsSize = resultsSize;
+    res.resultsCount = resultsCount;
 
-const std::string &SedInstanceTask::Impl::voiUnit() const noexcept
-{
-    static const std::string NO_STRING;
+    res.resultsValues.resize(resultsCount * resultsValueCount);
 
-    if (mDifferentialModel) {
-        return mVoiUnit;
-    }
+    extractBytes(pCheckpoint, offset, res.resultsValues.data(), res.resultsValues.size() * sizeof(double));
 
-    return NO_STRING;
+    return res;
 }
 
-size_t SedInstanceTask::Impl::stateCount() const noexcept
+bool SedInstanceTask::Impl::restore(const SedInstanceTaskCheckpoint &pCheckpoint)
 {
-    return mStateCount;
-}
+    // Fully (re)initialise ourselves if our ODE solver cannot simply be reinitialised (e.g., it was used to compute the
+    // gradient of an objective).
+    // Note: this is the only way for the restoration of a (parsed) checkpoint to fail.
 
-std::span<const double> SedInstanceTask::Impl::state(size_t pIndex) const noexcept
-{
-    if (!mDifferentialModel || (pIndex >= mStateCount)) {
-        return {};
+    if (!mOdeSolverReinitialisable) {
+        initialise();
+
+        if (hasIssues()) {
+            return false;
+        }
     }
 
-    return std::span(mResults.states).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
-}
+    // Restore our state.
 
-const std::string &SedInstanceTask::Impl::stateName(size_t pIndex) const noexcept
-{
-    static const std::string NO_STRING;
+    const auto arrays {modelArrays()};
 
-    if (!mDifferentialModel || (pIndex >= mStateCount)) {
-        return NO_STRING;
+    for (size_t i {0}; i < arrays.size(); ++i) {
+        std::copy(pCheckpoint.arrayValues[i].cbegin(), pCheckpoint.arrayValues[i].cend(), arrays[i].first);
     }
 
-    return mStateNames[pIndex];
-}
+    mVoi = pCheckpoint.voi;
 
-const std::string &SedInstanceTask::Impl::stateUnit(size_t pIndex) const noexcept
-{
-    static const std::string NO_STRING;
+    resizeResults(pCheckpoint.resultsSize);
 
-    if (!mDifferentialModel || (pIndex >= mStateCount)) {
-        return NO_STRING;
-    }
+    const std::array<std::span<double>, 6> results {mResults.voi, mResults.states, mResults.rates,
+                                                    mResults.constants, mResults.computedConstants,
+                                                    mResults.algebraicVariables};
 
-    return mStateUnits[pIndex];
-}
+    for (const auto &values : results) {
+        std::fill(values.begin(), values.end(), NAN);
+    }
 
-size_t SedInstanceTask::Impl::rateCount() const noexcept
-{
-    return stateCount();
-}
+    const auto resultsCounts {checkpointResults()};
+    auto resultsValue {pCheckpoint.resultsValues.cbegin()};
 
-std::span<const double> SedInstanceTask::Impl::rate(size_t pIndex) const noexcept
-{
-    if (!mDifferentialModel || (pIndex >= mStateCount)) {
-        return {};
+    for (size_t i {0}; i < pCheckpoint.resultsCount; ++i) {
+        for (size_t j {0}; j < results.size(); ++j) {
+            for (size_t k {0}; k < resultsCounts[j].second; ++k) {
+                results[j][k * pCheckpoint.resultsSize + i] = *resultsValue++;
+            }
+        }
     }
 
-    return std::span(mResults.rates).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
-}
+    mResults.sensitivities = {};
 
-const std::string &SedInstanceTask::Impl::rateName(size_t pIndex) const noexcept
-{
-    static const std::string NO_STRING;
+    mPhase = pCheckpoint.phase;
+    mPhaseVoiStart = pCheckpoint.phaseVoiStart;
+    mPhaseVoiEnd = pCheckpoint.phaseVoiEnd;
+    mPhaseVoiInterval = pCheckpoint.phaseVoiInterval;
+    mPhaseStep = pCheckpoint.phaseStep;
 
-    if (!mDifferentialModel || (pIndex >= mStateCount)) {
-        return NO_STRING;
-    }
+    mCompletedSteps.store(pCheckpoint.completedSteps, std::memory_order_relaxed);
+    mTotalSteps.store(pCheckpoint.totalSteps, std::memory_order_relaxed);
 
-    return mRateNames[pIndex];
-}
+    mObjective = NAN;
 
-const std::string &SedInstanceTask::Impl::rateUnit(size_t pIndex) const noexcept
-{
-    static const std::string NO_STRING;
+    mObjectiveGradient.clear();
 
-    if (!mDifferentialModel || (pIndex >= mStateCount)) {
-        return NO_STRING;
-    }
+    // Restore the internal state of our ODE solver, so that our simulation can be resumed from our checkpoint the next
+    // time we are run, or continued.
 
-    return mRateUnits[pIndex];
-}
+    mOdeSolver->pimpl()->restoreCheckpointState(mVoi, pCheckpoint.odeSolverState);
 
-size_t SedInstanceTask::Impl::constantCount() const noexcept
-{
-    return mConstantCount;
+    mContinuable = true;
+    mRestored = mPhase != SedInstanceTaskPhase::NONE;
+
+    return true;
 }
 
-std::span<const double> SedInstanceTask::Impl::constant(size_t pIndex) const noexcept
+bool SedInstanceTask::Impl::restore(const UnsignedChars &pCheckpoint)
 {
-    if (pIndex >= mConstantCount) {
-        return {};
-    }
+    const auto checkpoint {parseCheckpoint(pCheckpoint)};
 
-    return std::span(mResults.constants).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
+    return checkpoint.has_value() && restore(*checkpoint);
 }
 
-const std::string &SedInstanceTask::Impl::constantName(size_t pIndex) const noexcept
+void SedInstanceTask::Impl::startInstrumentation()
 {
-    static const std::string NO_STRING;
+    // Reset the times spent in the phases of our run and our statistics, and let our NLA solver know whether it should
+    // track its own statistics.
 
-    if (pIndex >= mConstantCount) {
-        return NO_STRING;
-    }
+    mPhaseTimes.fill(0.0);
+    mStatistics.fill(0);
 
-    return mConstantNames[pIndex];
-}
+    mNlaSystemSolveCounts.clear();
 
-const std::string &SedInstanceTask::Impl::constantUnit(size_t pIndex) const noexcept
-{
-    static const std::string NO_STRING;
+    if (mNlaSolver != nullptr) {
+        auto *nlaSolverPimpl {mNlaSolver->pimpl()};
 
-    if (pIndex >= mConstantCount) {
-        return NO_STRING;
+        nlaSolverPimpl->mInstrumented = mInstrumented;
+
+        nlaSolverPimpl->resetStatistics();
     }
 
-    return mConstantUnits[pIndex];
-}
+    // Keep track of the statistics of our ODE solver, since they are cumulative (e.g., when continuing our simulation).
 
-size_t SedInstanceTask::Impl::computedConstantCount() const noexcept
-{
-    return mComputedConstantCount;
+    if (mInstrumented && (mOdeSolver != nullptr)) {
+        mInitialOdeStatistics = mOdeSolver->pimpl()->statistics();
+    }
 }
 
-std::span<const double> SedInstanceTask::Impl::computedConstant(size_t pIndex) const noexcept
+void SedInstanceTask::Impl::stopInstrumentation()
 {
-    if (pIndex >= mComputedConstantCount) {
-        return {};
+    if (!mInstrumented) {
+        return;
     }
 
-    return std::span(mResults.computedConstants).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
-}
+    auto statistic = [this](Statistic pStatistic) -> size_t & {
+        return mStatistics[static_cast<size_t>(pStatistic)];
+    };
 
-const std::string &SedInstanceTask::Impl::computedConstantName(size_t pIndex) const noexcept
-{
-    static const std::string NO_STRING;
+    // Retrieve the statistics of our ODE solver for our run.
 
-    if (pIndex >= mComputedConstantCount) {
-        return NO_STRING;
+    if (mOdeSolver != nullptr) {
+        const auto odeStatistics {mOdeSolver->pimpl()->statistics()};
+
+        statistic(Statistic::ODE_STEP_COUNT) = odeStatistics.stepCount - mInitialOdeStatistics.stepCount;
+        statistic(Statistic::RHS_EVALUATION_COUNT) = odeStatistics.rhsEvaluationCount - mInitialOdeStatistics.rhsEvaluationCount;
+        statistic(Statistic::LINEAR_SOLVER_SETUP_COUNT) = odeStatistics.linearSolverSetupCount - mInitialOdeStatistics.linearSolverSetupCount;
+        statistic(Statistic::JACOBIAN_EVALUATION_COUNT) = odeStatistics.jacobianEvaluationCount - mInitialOdeStatistics.jacobianEvaluationCount;
+        statistic(Statistic::ERROR_TEST_FAILURE_COUNT) = odeStatistics.errorTestFailureCount - mInitialOdeStatistics.errorTestFailureCount;
     }
 
-    return mComputedConstantNames[pIndex];
-}
+    // Retrieve the statistics of our NLA solver for our run.
 
-const std::string &SedInstanceTask::Impl::computedConstantUnit(size_t pIndex) const noexcept
-{
-    static const std::string NO_STRING;
+    if (mNlaSolver != nullptr) {
+        const auto *nlaSolverPimpl {mNlaSolver->pimpl()};
 
-    if (pIndex >= mComputedConstantCount) {
-        return NO_STRING;
+        mPhaseTimes[static_cast<size_t>(Phase::NLA_SOLVING)] = nlaSolverPimpl->mSolveTime;
+
+        statistic(Statistic::NLA_ITERATION_COUNT) = nlaSolverPimpl->mIterationCount;
+
+        mNlaSystemSolveCounts.reserve(nlaSolverPimpl->mSystemSolveCounts.size());
+
+        for (const auto &[system, solveCount] : nlaSolverPimpl->mSystemSolveCounts) {
+            mNlaSystemSolveCounts.push_back(solveCount);
+
+            statistic(Statistic::NLA_SOLVE_COUNT) += solveCount;
+        }
     }
 
-    return mComputedConstantUnits[pIndex];
+    // Determine the number of bytes used by our results.
+
+    statistic(Statistic::RESULT_BYTE_COUNT) = (mResults.voi.size() + mResults.states.size() + mResults.rates.size()
+                                               + mResults.constants.size() + mResults.computedConstants.size()
+                                               + mResults.algebraicVariables.size() + mResults.sensitivities.size())
+                                              * sizeof(double);
 }
 
-size_t SedInstanceTask::Impl::algebraicVariableCount() const noexcept
+bool SedInstanceTask::Impl::instrumented() const noexcept
 {
-    return mAlgebraicVariableCount;
+    return mInstrumented;
 }
 
-std::span<const double> SedInstanceTask::Impl::algebraicVariable(size_t pIndex) const noexcept
+void SedInstanceTask::Impl::setInstrumented(bool pInstrumented)
 {
-    if (pIndex >= mAlgebraicVariableCount) {
-        return {};
-    }
-
-    return std::span(mResults.algebraicVariables).subspan(pIndex * mResults.resultsSize, mResults.resultsSize);
+    mInstrumented = pInstrumented;
 }
 
-const std::string &SedInstanceTask::Impl::algebraicVariableName(size_t pIndex) const noexcept
+double SedInstanceTask::Impl::phaseTime(Phase pPhase) const noexcept
 {
-    static const std::string NO_STRING;
+    // The phases of our model are tracked by our CellML file and its runtime while the phases of our run are tracked
+    // by us.
 
-    if (pIndex >= mAlgebraicVariableCount) {
-        return NO_STRING;
+    switch (pPhase) {
+    case Phase::PARSING:
+        return mCellmlFile->parsingTime();
+    case Phase::ANALYSIS:
+        return mCellmlFile->analysisTime();
+    case Phase::CODE_GENERATION:
+        return mRuntime->codeGenerationTime();
+    case Phase::COMPILATION:
+        return mRuntime->compilationTime();
+    case Phase::JIT_LINKING:
+        return mRuntime->jitLinkingTime();
+    default: {
+        const auto index {static_cast<size_t>(pPhase)};
+
+        return (index < PHASE_COUNT) ? mPhaseTimes[index] : 0.0;
+    }
     }
+}
+
+size_t SedInstanceTask::Impl::statistic(Statistic pStatistic) const noexcept
+{
+    const auto index {static_cast<size_t>(pStatistic)};
 
-    return mAlgebraicVariableNames[pIndex];
+    return (index < STATISTIC_COUNT) ? mStatistics[index] : 0;
 }
 
-const std::string &SedInstanceTask::Impl::algebraicVariableUnit(size_t pIndex) const noexcept
+size_t SedInstanceTask::Impl::nlaSystemCount() const noexcept
 {
-    static const std::string NO_STRING;
+    return mNlaSystemSolveCounts.size();
+}
 
-    if (pIndex >= mAlgebraicVariableCount) {
-        return NO_STRING;
+size_t SedInstanceTask::Impl::nlaSystemSolveCount(size_t pIndex) const noexcept
+{
+    if (pIndex >= mNlaSystemSolveCounts.size()) {
+        return 0;
     }
 
-    return mAlgebraicVariableUnits[pIndex];
+    return mNlaSystemSolveCounts[pIndex];
 }
 
 SedInstanceTask::SedInstanceTask(const SedAbstractTaskPtr &pTask)
@@ -1013,4 +2207,153 @@ const std::string &SedInstanceTask::algebraicVariableUnit(size_t pIndex) const n
     return pimpl()->algebraicVariableUnit(pIndex);
 }
 
+size_t SedInstanceTask::sensitivityParameterCount() const noexcept
+{
+    return pimpl()->sensitivityParameterCount();
+}
+
+const std::string &SedInstanceTask::sensitivityParameterName(size_t pParameterIndex) const noexcept
+{
+    return pimpl()->sensitivityParameterName(pParameterIndex);
+}
+
+#ifdef __EMSCRIPTEN__
+const emscripten::val &SedInstanceTask::sensitivity(size_t pStateIndex, size_t pParameterIndex) const noexcept
+{
+    static thread_local emscripten::val res;
+    static thread_local auto cachedStateIndex {SIZE_MAX};
+    static thread_local auto cachedParameterIndex {SIZE_MAX};
+    static thread_local const double *cachedDataPtr {nullptr};
+    static thread_local auto cachedSize {SIZE_MAX};
+
+    const auto &data = pimpl()->sensitivity(pStateIndex, pParameterIndex);
+    const auto *dataPtr = data.data();
+    const auto dataSize = data.size();
+
+    if ((cachedStateIndex != pStateIndex) || (cachedParameterIndex != pParameterIndex)
+        || (cachedDataPtr != dataPtr) || (cachedSize != dataSize)) {
+        res = toFloat64Array(data);
+
+        cachedStateIndex = pStateIndex;
+        cachedParameterIndex = pParameterIndex;
+        cachedDataPtr = dataPtr;
+        cachedSize = dataSize;
+    }
+
+    return res;
+}
+#else
+std::span<const double> SedInstanceTask::sensitivity(size_t pStateIndex, size_t pParameterIndex) const noexcept
+{
+    return pimpl()->sensitivity(pStateIndex, pParameterIndex);
+}
+#endif
+
+bool SedInstanceTask::setInitialState(size_t pIndex, double pValue)
+{
+    return pimpl()->setInitialState(pIndex, pValue);
+}
+
+bool SedInstanceTask::setConstant(size_t pIndex, double pValue)
+{
+    return pimpl()->setConstant(pIndex, pValue);
+}
+
+bool SedInstanceTask::resetInitialStatesAndConstants()
+{
+    return pimpl()->resetInitialStatesAndConstants();
+}
+
+bool SedInstanceTask::addObjectiveData(size_t pStateIndex, const Doubles &pValues)
+{
+    return pimpl()->addObjectiveData(pStateIndex, pValues);
+}
+
+bool SedInstanceTask::removeAllObjectiveData()
+{
+    return pimpl()->removeAllObjectiveData();
+}
+
+double SedInstanceTask::objective() const noexcept
+{
+    return pimpl()->objective();
+}
+
+#ifdef __EMSCRIPTEN__
+const emscripten::val &SedInstanceTask::objectiveGradient() const noexcept
+{
+    static thread_local emscripten::val res;
+    static thread_local const double *cachedDataPtr {nullptr};
+    static thread_local auto cachedSize {SIZE_MAX};
+
+    const auto &data = pimpl()->objectiveGradient();
+    const auto *dataPtr = data.data();
+    const auto dataSize = data.size();
+
+    if ((cachedDataPtr != dataPtr) || (cachedSize != dataSize)) {
+        res = toFloat64Array(data);
+
+        cachedDataPtr = dataPtr;
+        cachedSize = dataSize;
+    }
+
+    return res;
+}
+#else
+std::span<const double> SedInstanceTask::objectiveGradient() const noexcept
+{
+    return pimpl()->objectiveGradient();
+}
+#endif
+
+size_t SedInstanceTask::checkpointInterval() const noexcept
+{
+    return pimpl()->checkpointInterval();
+}
+
+void SedInstanceTask::setCheckpointInterval(size_t pCheckpointInterval)
+{
+    pimpl()->setCheckpointInterval(pCheckpointInterval);
+}
+
+UnsignedChars SedInstanceTask::checkpoint() const
+{
+    return pimpl()->checkpoint();
+}
+
+bool SedInstanceTask::restore(const UnsignedChars &pCheckpoint)
+{
+    return pimpl()->restore(pCheckpoint);
+}
+
+bool SedInstanceTask::instrumented() const noexcept
+{
+    return pimpl()->instrumented();
+}
+
+void SedInstanceTask::setInstrumented(bool pInstrumented)
+{
+    pimpl()->setInstrumented(pInstrumented);
+}
+
+double SedInstanceTask::phaseTime(Phase pPhase) const noexcept
+{
+    return pimpl()->phaseTime(pPhase);
+}
+
+size_t SedInstanceTask::statistic(Statistic pStatistic) const noexcept
+{
+    return pimpl()->statistic(pStatistic);
+}
+
+size_t SedInstanceTask::nlaSystemCount() const noexcept
+{
+    return pimpl()->nlaSystemCount();
+}
+
+size_t SedInstanceTask::nlaSystemSolveCount(size_t pIndex) const noexcept
+{
+    return pimpl()->nlaSystemSolveCount(pIndex);
+}
+
 } // namespace libOpenCOR
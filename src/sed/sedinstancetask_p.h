@@ -18,14 +18,20 @@ limitations under the License.
 
 #include "logger_p.h"
 
+#include "arena.h"
+#include "cellmlfile.h"
 #include "cellmlfileruntime.h"
+#include "solverode_p.h"
 #include "utils.h"
 
 #include "libopencor/sedinstancetask.h"
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <map>
 #include <mutex>
+#include <optional>
 #include <span>
 
 namespace libOpenCOR {
@@ -40,16 +46,50 @@ enum InstanceRunControl : unsigned
     INSTANCE_RUN_CONTROL_STOP = 1 << 1,
 };
 
+// Phase of a running instance task.
+
+enum class SedInstanceTaskPhase : uint32_t
+{
+    NONE,
+    PRE_OUTPUT,
+    OUTPUT
+};
+
 struct SedInstanceTaskResults
 {
     size_t resultsSize {0};
 
-    Doubles voi;
-    Doubles states;
-    Doubles rates;
-    Doubles constants;
-    Doubles computedConstants;
-    Doubles algebraicVariables;
+    Arena arena;
+
+    std::span<double> voi;
+    std::span<double> states;
+    std::span<double> rates;
+    std::span<double> constants;
+    std::span<double> computedConstants;
+    std::span<double> algebraicVariables;
+    std::span<double> sensitivities;
+};
+
+// Deserialised checkpoint of an instance task.
+
+struct SedInstanceTaskCheckpoint
+{
+    SedInstanceTaskPhase phase {SedInstanceTaskPhase::NONE};
+    double voi {0.0};
+    double phaseVoiStart {0.0};
+    double phaseVoiEnd {0.0};
+    double phaseVoiInterval {0.0};
+    size_t phaseStep {0};
+    size_t completedSteps {0};
+    size_t totalSteps {0};
+
+    std::array<Doubles, 5> arrayValues;
+
+    size_t resultsSize {0};
+    size_t resultsCount {0};
+    Doubles resultsValues;
+
+    Doubles odeSolverState;
 };
 
 using SedInstanceTaskWeakPtr = std::weak_ptr<SedInstanceTask>;
@@ -57,20 +97,33 @@ using SedInstanceTaskWeakPtr = std::weak_ptr<SedInstanceTask>;
 class SedInstanceTask::Impl: public Logger::Impl
 {
 public:
+    static constexpr auto STEADY_STATE_TOLERANCE {1.0e-6};
+    static constexpr auto STEADY_STATE_INITIAL_INTEGRATION_INTERVAL {1.0};
+    static constexpr size_t STEADY_STATE_MAXIMUM_NUMBER_OF_INTEGRATION_INTERVALS {40};
+    static constexpr size_t PHASE_COUNT {static_cast<size_t>(Phase::RESULT_RECORDING) + 1};
+    static constexpr size_t STATISTIC_COUNT {static_cast<size_t>(Statistic::RESULT_BYTE_COUNT) + 1};
+
     SedInstanceTaskWeakPtr mOwner;
+    CellmlFilePtr mCellmlFile;
     CellmlFileRuntimePtr mRuntime;
     SedSimulationPtr mSimulation;
     SedUniformTimeCoursePtr mSedUniformTimeCourse;
+    SedSteadyStatePtr mSedSteadyState;
     SedModelPtr mModel;
     bool mDifferentialModel;
     libcellml::AnalyserModelPtr mAnalyserModel;
     SolverOdePtr mOdeSolver;
     SolverNlaPtr mNlaSolver;
+    SolverCvodePtr mCvodeSolver;
+#ifndef __EMSCRIPTEN__
+    SolverKinsolPtr mSteadyStateSolver;
+#endif
 
     size_t mStateCount {0};
     size_t mConstantCount {0};
     size_t mComputedConstantCount {0};
     size_t mAlgebraicVariableCount {0};
+    size_t mSensitivityParameterCount {0};
 
     double mVoi {0.0};
     double *mStates {nullptr};
@@ -79,45 +132,79 @@ public:
     double *mComputedConstants {nullptr};
     double *mAlgebraicVariables {nullptr};
 
-    Doubles mStateDoubles;
-    Doubles mRateDoubles;
-    Doubles mConstantDoubles;
-    Doubles mComputedConstantDoubles;
-    Doubles mAlgebraicVariableDoubles;
+    Arena mArena;
 
     SedInstanceTaskResults mResults;
 
-    std::atomic<size_t> mCompletedSteps {0};
-    std::atomic<size_t> mTotalSteps {0};
+    std::span<double> mInitialValues;
+    bool mInitialValuesAvailable {false};
+    bool mOdeSolverReinitialisable {false};
+    bool mContinuable {false};
+
+    std::map<size_t, double> mInitialStateValues;
+    std::map<size_t, double> mConstantValues;
+
+    std::map<size_t, Doubles> mObjectiveData;
+    double mObjective {NAN};
+    Doubles mObjectiveGradient;
+
+    // Note: our number of completed steps is updated by the thread that runs us and polled by the thread that
+    //       reports our progress, so we make sure that it has a cache line to itself to avoid false sharing.
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> mCompletedSteps {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> mTotalSteps {0};
+
+    SedInstanceTaskPhase mPhase {SedInstanceTaskPhase::NONE};
+    double mPhaseVoiStart {0.0};
+    double mPhaseVoiEnd {0.0};
+    double mPhaseVoiInterval {0.0};
+    size_t mPhaseStep {0};
+    bool mRestored {false};
+
+    std::atomic<bool> mRunning {false};
+    size_t mCheckpointInterval {0};
+    mutable std::mutex mCheckpointMutex;
+    UnsignedChars mCheckpoint;
+    UnsignedChars mCheckpointResults;
+    size_t mCheckpointResultsCount {0};
+
+    bool mInstrumented {false};
+    std::array<double, PHASE_COUNT> mPhaseTimes {};
+    std::array<size_t, STATISTIC_COUNT> mStatistics {};
+    std::vector<size_t> mNlaSystemSolveCounts;
+    SolverOdeStatistics mInitialOdeStatistics;
 
     const std::atomic<unsigned> *mRunControl {nullptr};
 
     std::condition_variable *mPauseConditionVariable {nullptr};
     std::mutex *mPauseMutex {nullptr};
 
-    std::string mVoiName;
-    std::string mVoiUnit;
-    Strings mStateNames;
-    Strings mStateUnits;
-    Strings mRateNames;
-    Strings mRateUnits;
-    Strings mConstantNames;
-    Strings mConstantUnits;
-    Strings mComputedConstantNames;
-    Strings mComputedConstantUnits;
-    Strings mAlgebraicVariableNames;
-    Strings mAlgebraicVariableUnits;
-
     static SedInstanceTaskPtr create(const SedAbstractTaskPtr &pTask);
 
     explicit Impl(const SedAbstractTaskPtr &pTask);
 
     void trackResults(size_t pIndex);
+    void trackPhaseTime(Phase pPhase, TimePoint &pStartTime);
+
+    std::array<std::pair<double *, size_t>, 5> modelArrays() const;
+    void saveInitialValues();
+    void restoreInitialValues();
 
     void applyChanges();
     void initialise();
-    void run(double pVoiStart, double pVoiEnd, double pVoiInterval, bool pTrackResults);
+    void resizeResults(size_t pResultsSize);
+    bool stopRequested() const;
+    void run(double pVoiStart, double pVoiEnd, double pVoiInterval, bool pTrackResults, size_t pFirstStep);
+    double maximumAbsoluteRate() const;
+#ifndef __EMSCRIPTEN__
+    bool solveSteadyState();
+#endif
+    bool computeSteadyState();
+    bool computeObjectiveGradient(double pVoiStart);
+    double outputVoiInterval() const;
+    double resumeRun();
     double run();
+    double continueRun(double pEndTime, int pNumberOfSteps);
 
     double progress() const noexcept;
 
@@ -149,6 +236,46 @@ public:
     std::span<const double> algebraicVariable(size_t pIndex) const noexcept;
     const std::string &algebraicVariableName(size_t pIndex) const noexcept;
     const std::string &algebraicVariableUnit(size_t pIndex) const noexcept;
+
+    size_t sensitivityParameterCount() const noexcept;
+    const std::string &sensitivityParameterName(size_t pParameterIndex) const noexcept;
+    std::span<const double> sensitivity(size_t pStateIndex, size_t pParameterIndex) const noexcept;
+
+    bool setInitialState(size_t pIndex, double pValue);
+    bool setConstant(size_t pIndex, double pValue);
+    bool resetInitialStatesAndConstants();
+
+    bool addObjectiveData(size_t pStateIndex, const Doubles &pValues);
+    bool removeAllObjectiveData();
+    double objective() const noexcept;
+    std::span<const double> objectiveGradient() const noexcept;
+
+    UnsignedChars serialiseState() const;
+    std::array<std::pair<std::span<const double>, size_t>, 6> checkpointResults() const;
+    size_t checkpointResultsCount() const;
+    void serialiseResults(UnsignedChars &pCheckpoint, size_t pFrom, size_t pTo) const;
+    UnsignedChars serialise() const;
+    void takeCheckpoint();
+    void clearCheckpoint();
+
+    size_t checkpointInterval() const noexcept;
+    void setCheckpointInterval(size_t pCheckpointInterval);
+
+    UnsignedChars checkpoint() const;
+    std::optional<SedInstanceTaskCheckpoint> parseCheckpoint(const UnsignedChars &pCheckpoint) const;
+    bool restore(const SedInstanceTaskCheckpoint &pCheckpoint);
+    bool restore(const UnsignedChars &pCheckpoint);
+
+    void startInstrumentation();
+    void stopInstrumentation();
+
+    bool instrumented() const noexcept;
+    void setInstrumented(bool pInstrumented);
+
+    double phaseTime(Phase pPhase) const noexcept;
+    size_t statistic(Statistic pStatistic) const noexcept;
+    size_t nlaSystemCount() const noexcept;
+    size_t nlaSystemSolveCount(size_t pIndex) const noexcept;
 };
 
 } // namespace libOpenCOR
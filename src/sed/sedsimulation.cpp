@@ -48,7 +48,7 @@ bool SedSimulation::Impl::isValid(const SedModelPtr &pModel)
         error += pSolverType;
         error += " solver but none is provided.";
 
-        addError(error);
+        addError(std::move(error));
     };
 
     if ((modelType == libcellml::AnalyserModel::Type::ODE) && (mOdeSolver == nullptr)) {
@@ -45,7 +45,7 @@ bool SedTask::Impl::isValid()
         error += "' ";
         error += pMessage;
 
-        addError(error);
+        addError(std::move(error));
     };
 
     // Make sure that we have both a model and a simulation.
@@ -15,6 +15,7 @@ limitations under the License.
 */
 
 #include "solvercvode_p.h"
+#include "solvervector.h"
 
 #include "cvodes/cvodes.h"
 #include "cvodes/cvodes_bandpre.h"
@@ -28,6 +29,10 @@ limitations under the License.
 #include "sunlinsol/sunlinsol_sptfqmr.h"
 #include "sunnonlinsol/sunnonlinsol_fixedpoint.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
 #include <utility>
 
 namespace libOpenCOR {
@@ -72,9 +77,43 @@ std::string toString(SolverCvode::Preconditioner pPreconditioner)
                "Banded";
 }
 
+int toCvodeSensitivityMethod(SolverCvode::SensitivityMethod pSensitivityMethod)
+{
+    return (pSensitivityMethod == SolverCvode::SensitivityMethod::SIMULTANEOUS) ?
+               CV_SIMULTANEOUS :
+               CV_STAGGERED;
+}
+
+void computeComputedConstants(double pVoi, const double *pStates, SolverCvodeUserData *pUserData)
+{
+    // Compute our computed constants using a copy of our states (and scratch rates and algebraic variables) since the
+    // generated code may also (re)initialise some states, something that we don't want to happen while integrating.
+
+    std::copy(pStates, pStates + pUserData->scratchStates.size(), pUserData->scratchStates.begin()); // NOLINT
+
+#ifdef __EMSCRIPTEN__
+    pUserData->runtime->computeComputedConstantsForDifferentialModel(pVoi, pUserData->scratchStates.data(), pUserData->scratchRates.data(),
+                                                                     pUserData->constants, pUserData->computedConstants, pUserData->scratchAlgebraicVariables.data());
+#else
+    pUserData->runtime->computeComputedConstantsForDifferentialModel()(pVoi, pUserData->scratchStates.data(), pUserData->scratchRates.data(),
+                                                                       pUserData->constants, pUserData->computedConstants, pUserData->scratchAlgebraicVariables.data());
+#endif
+}
+
+void computeRates(double pVoi, double *pStates, double *pRates, SolverCvodeUserData *pUserData)
+{
+#ifdef __EMSCRIPTEN__
+    pUserData->runtime->computeRates(pVoi, pStates, pRates,
+                                     pUserData->constants, pUserData->computedConstants, pUserData->algebraicVariables);
+#else
+    pUserData->runtime->computeRates()(pVoi, pStates, pRates,
+                                       pUserData->constants, pUserData->computedConstants, pUserData->algebraicVariables);
+#endif
+}
+
 } // namespace
 
-// Right-hand side function.
+// Right-hand side functions.
 
 namespace {
 
@@ -101,13 +140,160 @@ int rhsFunction(double pVoi, N_Vector pStates, N_Vector pRates, void *pUserData)
 {
     auto *userData {static_cast<SolverCvodeUserData *>(pUserData)};
 
-#ifdef __EMSCRIPTEN__
-    userData->runtime->computeRates(pVoi, N_VGetArrayPointer_Serial(pStates), N_VGetArrayPointer_Serial(pRates),
-                                    userData->constants, userData->computedConstants, userData->algebraicVariables);
-#else
-        userData->runtime->computeRates()(pVoi, N_VGetArrayPointer_Serial(pStates), N_VGetArrayPointer_Serial(pRates),
-                                          userData->constants, userData->computedConstants, userData->algebraicVariables);
-#endif
+    // If we are computing sensitivities then CVODES may have perturbed some of our constants, meaning that we need to
+    // update our computed constants.
+
+    if (userData->sensitivities) {
+        computeComputedConstants(pVoi, N_VGetArrayPointer(pStates), userData);
+    }
+
+    computeRates(pVoi, N_VGetArrayPointer(pStates), N_VGetArrayPointer(pRates), userData);
+
+    return 0;
+}
+
+int adjointRhsFunction(double pVoi, N_Vector pStates, N_Vector pAdjoints, N_Vector pAdjointRates, void *pUserData)
+{
+    // Compute -J^T.lambda, where J is the Jacobian of our rates with respect to our states, which we estimate one column
+    // at a time using forward differences.
+    // Note: our generated code cannot compute J^T.lambda directly, so this requires N+1 evaluations of our rates, where
+    //       N is the number of states.
+
+    auto *userData {static_cast<SolverCvodeUserData *>(pUserData)};
+    auto *states {N_VGetArrayPointer(pStates)};
+    const auto *adjoints {N_VGetArrayPointer(pAdjoints)};
+    auto *adjointRates {N_VGetArrayPointer(pAdjointRates)};
+    const auto size {userData->perturbedStates.size()};
+
+    computeRates(pVoi, states, userData->baseRates.data(), userData);
+
+    std::copy(states, states + size, userData->perturbedStates.begin()); // NOLINT
+
+    for (size_t j {0}; j < size; ++j) {
+        const auto state {states[j]}; // NOLINT
+        const auto delta {std::sqrt(DBL_EPSILON) * std::max(std::abs(state), 1.0)};
+        auto adjointRate {0.0};
+
+        userData->perturbedStates[j] = state + delta;
+
+        computeRates(pVoi, userData->perturbedStates.data(), userData->perturbedRates.data(), userData);
+
+        for (size_t i {0}; i < size; ++i) {
+            adjointRate += (userData->perturbedRates[i] - userData->baseRates[i]) * adjoints[i]; // NOLINT
+        }
+
+        adjointRates[j] = -adjointRate / delta; // NOLINT
+
+        userData->perturbedStates[j] = state;
+    }
+
+    return 0;
+}
+
+int adjointJacobianFunction(double pVoi, N_Vector pStates, N_Vector pAdjoints, N_Vector pAdjointRates,
+                            SUNMatrix pJacobian, void *pUserData, N_Vector pTemp1, N_Vector pTemp2, N_Vector pTemp3)
+{
+    // Compute the Jacobian of our adjoint RHS, i.e. -J^T, where J is the Jacobian of our rates with respect to our
+    // states, which we estimate one column at a time using forward differences.
+    // Note: this requires N+1 evaluations of our rates, where N is the number of states, while CVODES would otherwise
+    //       estimate it using N evaluations of our adjoint RHS, i.e. N(N+1) evaluations of our rates.
+
+    (void)pAdjoints;
+    (void)pAdjointRates;
+    (void)pTemp1;
+    (void)pTemp2;
+    (void)pTemp3;
+
+    auto *userData {static_cast<SolverCvodeUserData *>(pUserData)};
+    auto *states {N_VGetArrayPointer(pStates)};
+    const auto size {userData->perturbedStates.size()};
+    const auto dense {SUNMatGetID(pJacobian) == SUNMATRIX_DENSE};
+
+    SUNMatZero(pJacobian);
+
+    computeRates(pVoi, states, userData->baseRates.data(), userData);
+
+    std::copy(states, states + size, userData->perturbedStates.begin()); // NOLINT
+
+    for (size_t j {0}; j < size; ++j) {
+        const auto state {states[j]}; // NOLINT
+        const auto delta {std::sqrt(DBL_EPSILON) * std::max(std::abs(state), 1.0)};
+
+        userData->perturbedStates[j] = state + delta;
+
+        computeRates(pVoi, userData->perturbedStates.data(), userData->perturbedRates.data(), userData);
+
+        for (size_t i {0}; i < size; ++i) {
+            // Set the (j, i) element of -J^T, i.e. -J(i, j), but only if it is within our band, if we are banded.
+
+            const auto value {-(userData->perturbedRates[i] - userData->baseRates[i]) / delta};
+            const auto row {static_cast<sunindextype>(j)};
+            const auto column {static_cast<sunindextype>(i)};
+
+            if (dense) {
+                SM_ELEMENT_D(pJacobian, row, column) = value; // NOLINT
+            } else if ((column - row <= SM_UBAND_B(pJacobian)) && (row - column <= SM_LBAND_B(pJacobian))) { // NOLINT
+                SM_ELEMENT_B(pJacobian, row, column) = value; // NOLINT
+            }
+        }
+
+        userData->perturbedStates[j] = state;
+    }
+
+    return 0;
+}
+
+int adjointJacobianTimesVectorFunction(N_Vector pVector, N_Vector pJacobianTimesVector, double pVoi, N_Vector pStates,
+                                       N_Vector pAdjoints, N_Vector pAdjointRates, void *pUserData, N_Vector pTemp)
+{
+    // Compute the product of the Jacobian of our adjoint RHS with the given vector, i.e. -J^T.v. Our adjoint RHS is
+    // linear in our adjoints, so this is our adjoint RHS evaluated at v, which is exact (unlike the difference quotient
+    // that CVODES would otherwise use) and also requires N+1 evaluations of our rates.
+
+    (void)pAdjoints;
+    (void)pAdjointRates;
+    (void)pTemp;
+
+    return adjointRhsFunction(pVoi, pStates, pVector, pJacobianTimesVector, pUserData);
+}
+
+int adjointQuadratureRhsFunction(double pVoi, N_Vector pStates, N_Vector pAdjoints, N_Vector pAdjointQuadratureRates,
+                                 void *pUserData)
+{
+    // Compute -lambda^T.df/dp, where df/dp is the Jacobian of our rates with respect to our constants, which we estimate
+    // one column at a time using forward differences.
+    // Note: this requires P+1 evaluations of our rates and P evaluations of our computed constants, where P is the
+    //       number of constants.
+
+    auto *userData {static_cast<SolverCvodeUserData *>(pUserData)};
+    auto *states {N_VGetArrayPointer(pStates)};
+    const auto *adjoints {N_VGetArrayPointer(pAdjoints)};
+    auto *adjointQuadratureRates {N_VGetArrayPointer(pAdjointQuadratureRates)};
+    const auto size {userData->perturbedStates.size()};
+
+    computeRates(pVoi, states, userData->baseRates.data(), userData);
+
+    for (size_t k {0}; k < userData->constantCount; ++k) {
+        auto &constant {userData->constants[k]}; // NOLINT
+        const auto constantValue {constant};
+        const auto delta {std::sqrt(DBL_EPSILON) * std::max(std::abs(constantValue), 1.0)};
+        auto adjointQuadratureRate {0.0};
+
+        constant = constantValue + delta;
+
+        computeComputedConstants(pVoi, states, userData);
+        computeRates(pVoi, states, userData->perturbedRates.data(), userData);
+
+        for (size_t i {0}; i < size; ++i) {
+            adjointQuadratureRate += (userData->perturbedRates[i] - userData->baseRates[i]) * adjoints[i]; // NOLINT
+        }
+
+        adjointQuadratureRates[k] = -adjointQuadratureRate / delta; // NOLINT
+
+        constant = constantValue;
+    }
+
+    computeComputedConstants(pVoi, states, userData);
 
     return 0;
 }
@@ -137,7 +323,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
         warning += pKisaoId;
         warning += "' is not recognised. It will be ignored.";
 
-        addWarning(warning);
+        addWarning(std::move(warning));
     };
 
     for (unsigned int i {0}; i < pAlgorithm->getNumAlgorithmParameters(); ++i) {
@@ -162,7 +348,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultMaximumStep;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mMaximumStep = DEFAULT_MAXIMUM_STEP;
             }
@@ -183,7 +369,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultMaximumNumberOfSteps;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mMaximumNumberOfSteps = DEFAULT_MAXIMUM_NUMBER_OF_STEPS;
             }
@@ -202,7 +388,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultIntegrationMethod;
                 warning += " integration method will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 value = toString(DEFAULT_INTEGRATION_METHOD);
             }
@@ -225,7 +411,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultIterationType;
                 warning += " iteration type will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 value = toString(DEFAULT_ITERATION_TYPE);
             }
@@ -248,7 +434,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultLinearSolver;
                 warning += " linear solver will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 value = toString(DEFAULT_LINEAR_SOLVER);
             }
@@ -279,7 +465,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultPreconditioner;
                 warning += " preconditioner will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 value = toString(DEFAULT_PRECONDITIONER);
             }
@@ -304,7 +490,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultUpperHalfBandwidth;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mUpperHalfBandwidth = DEFAULT_UPPER_HALF_BANDWIDTH;
             }
@@ -325,7 +511,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultLowerHalfBandwidth;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mLowerHalfBandwidth = DEFAULT_LOWER_HALF_BANDWIDTH;
             }
@@ -346,7 +532,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultRelativeTolerance;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mRelativeTolerance = DEFAULT_RELATIVE_TOLERANCE;
             }
@@ -367,7 +553,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultAbsoluteTolerance;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mAbsoluteTolerance = DEFAULT_ABSOLUTE_TOLERANCE;
             }
@@ -386,7 +572,7 @@ void SolverCvode::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultInterpolateSolution;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 value = toString(DEFAULT_INTERPOLATE_SOLUTION);
             }
@@ -414,6 +600,9 @@ SolverPtr SolverCvode::Impl::duplicate()
     solverPimpl->mRelativeTolerance = mRelativeTolerance;
     solverPimpl->mAbsoluteTolerance = mAbsoluteTolerance;
     solverPimpl->mInterpolateSolution = mInterpolateSolution;
+    solverPimpl->mThreadCount = mThreadCount;
+    solverPimpl->mSensitivityMethod = mSensitivityMethod;
+    solverPimpl->mSensitivityParameters = mSensitivityParameters;
 
     return solver;
 }
@@ -421,17 +610,49 @@ SolverPtr SolverCvode::Impl::duplicate()
 void SolverCvode::Impl::resetInternals()
 {
     if (mSunContext != nullptr) {
-        N_VDestroy_Serial(mStatesVector);
+        if (mSensitivityVectors != nullptr) {
+            N_VDestroyVectorArray(mSensitivityVectors, static_cast<int>(mSensitivityParameters.size()));
+
+            mSensitivityVectors = nullptr;
+        }
+
+        if (mAdjointIndex != -1) {
+            N_VDestroy(mAdjointVector);
+            N_VDestroy(mAdjointQuadratureVector);
+            SUNLinSolFree(mAdjointSunLinearSolver);
+            SUNNonlinSolFree(mAdjointSunNonLinearSolver);
+            SUNMatDestroy(mAdjointSunMatrix);
+
+            mAdjointSunMatrix = nullptr;
+            mAdjointSunLinearSolver = nullptr;
+            mAdjointSunNonLinearSolver = nullptr;
+
+            mAdjointIndex = -1;
+        }
+
+        N_VDestroy(mStatesVector);
         SUNLinSolFree(mSunLinearSolver);
         SUNNonlinSolFree(mSunNonLinearSolver);
         SUNMatDestroy(mSunMatrix);
 
+        // Note: our linear solver, if any, tells statistics() whether we have some Jacobian evaluations, and we may
+        //       not get a new one (e.g., if we now use a diagonal linear solver), so forget about it.
+
+        mSunMatrix = nullptr;
+        mSunLinearSolver = nullptr;
+        mSunNonLinearSolver = nullptr;
+
         CVodeFree(&mSolver);
 
         SUNContext_PopErrHandler(mSunContext);
 
         SUNContext_Free(&mSunContext);
     }
+
+    mUserData.sensitivities = false;
+
+    mAdjoint = false;
+    mAdjointInitialised = false;
 }
 
 StringStringMap SolverCvode::Impl::properties() const
@@ -459,6 +680,8 @@ bool SolverCvode::Impl::initialise(double pVoi, size_t pSize, double *pStates, d
 {
     // If already initialised, then update the state pointers and reinitialise ourselves.
 
+    mAdjoint = false;
+
     if (mSunContext != nullptr) {
         SolverOde::Impl::initialise(pVoi, pSize, pStates, pRates,
                                     pConstants, pComputedConstants, pAlgebraicVariables,
@@ -497,7 +720,7 @@ bool SolverCvode::Impl::initialise(double pVoi, size_t pSize, double *pStates, d
         error += maximumStep;
         error += ". It must be greater or equal to 0.";
 
-        addError(error);
+        addError(std::move(error));
     }
 
     if (mMaximumNumberOfSteps <= 0) {
@@ -510,7 +733,7 @@ bool SolverCvode::Impl::initialise(double pVoi, size_t pSize, double *pStates, d
         error += maximumNumberOfSteps;
         error += ". It must be greater than 0.";
 
-        addError(error);
+        addError(std::move(error));
     }
 
     if (mIterationType == IterationType::NEWTON) {
@@ -548,7 +771,7 @@ bool SolverCvode::Impl::initialise(double pVoi, size_t pSize, double *pStates, d
                 error += maximumUpperHalfBandwidth;
                 error += ".";
 
-                addError(error);
+                addError(std::move(error));
             }
 
             if ((mLowerHalfBandwidth < 0) || std::cmp_greater_equal(mLowerHalfBandwidth, pSize)) {
@@ -564,7 +787,7 @@ bool SolverCvode::Impl::initialise(double pVoi, size_t pSize, double *pStates, d
                 error += maximumLowerHalfBandwidth;
                 error += ".";
 
-                addError(error);
+                addError(std::move(error));
             }
         }
     }
@@ -579,7 +802,7 @@ bool SolverCvode::Impl::initialise(double pVoi, size_t pSize, double *pStates, d
         error += relativeTolerance;
         error += ". It must be greater or equal to 0.";
 
-        addError(error);
+        addError(std::move(error));
     }
 
     if (mAbsoluteTolerance < 0.0) {
@@ -592,7 +815,20 @@ bool SolverCvode::Impl::initialise(double pVoi, size_t pSize, double *pStates, d
         error += absoluteTolerance;
         error += ". It must be greater or equal to 0.";
 
-        addError(error);
+        addError(std::move(error));
+    }
+
+    if (mThreadCount <= 0) {
+        const auto threadCount {toString(mThreadCount)};
+        std::string error;
+
+        error.reserve(threadCount.size() + 69); // NOLINT
+
+        error += "The number of threads cannot be equal to ";
+        error += threadCount;
+        error += ". It must be greater than 0.";
+
+        addError(std::move(error));
     }
 
     // Check whether we got some errors.
@@ -618,7 +854,7 @@ bool SolverCvode::Impl::initialise(double pVoi, size_t pSize, double *pStates, d
 
     // Initialise our CVODE solver.
 
-    mStatesVector = N_VMake_Serial(static_cast<int64_t>(pSize), pStates, mSunContext);
+    mStatesVector = makeVector(pSize, pStates, mThreadCount, mSunContext);
 
     ASSERT_NE(mStatesVector, nullptr);
     ASSERT_EQ(CVodeInit(mSolver, rhsFunction, pVoi, mStatesVector), CV_SUCCESS);
@@ -721,9 +957,418 @@ bool SolverCvode::Impl::reinitialise(double pVoi)
 
     SolverOde::Impl::reinitialise(pVoi);
 
-    // Reinitialise our CVODE solver.
+    // Reinitialise our CVODE solver and let it estimate its initial step.
 
     ASSERT_EQ(CVodeReInit(mSolver, pVoi, mStatesVector), CV_SUCCESS);
+    ASSERT_EQ(CVodeSetInitStep(mSolver, 0.0), CV_SUCCESS);
+
+    return true;
+}
+
+Doubles SolverCvode::Impl::checkpointState() const
+{
+    // Keep track of the step that CVODE is going to attempt next.
+    // Note: CVODE's Nordsieck history array can be read (through CVodeGetCurrentOrder(), CVodeGetLastStep(), and
+    //       CVodeGetDky()), but CVODE has no public API to load it back, only to reinitialise itself from a single
+    //       solution vector. So, there is no point in checkpointing it: a restored CVODE solver restarts at order 1 with
+    //       the step that it was going to attempt next, meaning that its results match those of an uninterrupted
+    //       simulation only to within its tolerances.
+
+    double step {};
+
+    ASSERT_EQ(CVodeGetCurrentStep(mSolver, &step), CV_SUCCESS);
+
+    return {step};
+}
+
+bool SolverCvode::Impl::restoreCheckpointState(double pVoi, const Doubles &pState)
+{
+    // Reinitialise ourselves and have CVODE start (at order 1) with the step that it was going to attempt next.
+
+    reinitialise(pVoi);
+
+    if ((pState.size() == 1) && (pState[0] > 0.0)) {
+        ASSERT_EQ(CVodeSetInitStep(mSolver, pState[0]), CV_SUCCESS);
+    }
+
+    return true;
+}
+
+SolverOdeStatistics SolverCvode::Impl::statistics() const
+{
+    // Retrieve CVODE's statistics, which are reset whenever CVODE is (re)initialised.
+
+    if (mSolver == nullptr) {
+        return {};
+    }
+
+    long stepCount {0}; // NOLINT
+    long rhsEvaluationCount {0}; // NOLINT
+    long linearSolverSetupCount {0}; // NOLINT
+    long jacobianEvaluationCount {0}; // NOLINT
+    long errorTestFailureCount {0}; // NOLINT
+
+    ASSERT_EQ(CVodeGetNumSteps(mSolver, &stepCount), CV_SUCCESS);
+    ASSERT_EQ(CVodeGetNumRhsEvals(mSolver, &rhsEvaluationCount), CV_SUCCESS);
+    ASSERT_EQ(CVodeGetNumLinSolvSetups(mSolver, &linearSolverSetupCount), CV_SUCCESS);
+    ASSERT_EQ(CVodeGetNumErrTestFails(mSolver, &errorTestFailureCount), CV_SUCCESS);
+
+    // Note: we only have Jacobian evaluations if we use a SUNDIALS linear solver, i.e. not a diagonal linear solver nor
+    //       a fixed-point iteration.
+
+    if (mSunLinearSolver != nullptr) {
+        ASSERT_EQ(CVodeGetNumJacEvals(mSolver, &jacobianEvaluationCount), CVLS_SUCCESS);
+    }
+
+    return {
+        static_cast<size_t>(stepCount),
+        static_cast<size_t>(rhsEvaluationCount),
+        static_cast<size_t>(linearSolverSetupCount),
+        static_cast<size_t>(jacobianEvaluationCount),
+        static_cast<size_t>(errorTestFailureCount),
+    };
+}
+
+void SolverCvode::Impl::initialiseScratchArrays(size_t pConstantCount, size_t pAlgebraicVariableCount)
+{
+    mUserData.scratchStates.resize(mSize);
+    mUserData.scratchRates.resize(mSize);
+    mUserData.scratchAlgebraicVariables.resize(pAlgebraicVariableCount);
+
+    mUserData.perturbedStates.resize(mSize);
+    mUserData.baseRates.resize(mSize);
+    mUserData.perturbedRates.resize(mSize);
+    mUserData.constantCount = pConstantCount;
+}
+
+bool SolverCvode::Impl::initialiseSensitivities(double pVoi, size_t pConstantCount, size_t pAlgebraicVariableCount)
+{
+    // Check the sensitivity parameters.
+
+    for (auto sensitivityParameter : mSensitivityParameters) {
+        if (sensitivityParameter >= pConstantCount) {
+            const auto sensitivityParameterString {toString(sensitivityParameter)};
+            std::string error;
+
+            if (pConstantCount == 0) {
+                error.reserve(sensitivityParameterString.size() + 74); // NOLINT
+
+                error += "The sensitivity parameter cannot be equal to ";
+                error += sensitivityParameterString;
+                error += ". The model has no constants.";
+            } else {
+                const auto maximumSensitivityParameter {toString(pConstantCount - 1)};
+
+                error.reserve(sensitivityParameterString.size() + maximumSensitivityParameter.size() + 73); // NOLINT
+
+                error += "The sensitivity parameter cannot be equal to ";
+                error += sensitivityParameterString;
+                error += ". It must be between 0 and ";
+                error += maximumSensitivityParameter;
+                error += ".";
+            }
+
+            addError(std::move(error));
+        }
+    }
+
+    if (hasErrors()) {
+        return false;
+    }
+
+    // Keep track of the fact that we are computing sensitivities and initialise our scratch arrays.
+
+    mUserData.sensitivities = true;
+
+    initialiseScratchArrays(pConstantCount, pAlgebraicVariableCount);
+
+    // Determine the scaling factor of our sensitivity parameters, i.e. their order of magnitude or 1 if they are equal
+    // to 0, as well as their index as expected by CVODES.
+
+    const auto sensitivityParameterCount {mSensitivityParameters.size()};
+    std::vector<int> sensitivityParameterIndices(sensitivityParameterCount);
+
+    mSensitivityParameterScalings.resize(sensitivityParameterCount);
+
+    for (size_t i {0}; i < sensitivityParameterCount; ++i) {
+        const auto constant {mConstants[mSensitivityParameters[i]]}; // NOLINT
+
+        mSensitivityParameterScalings[i] = (constant != 0.0) ? std::abs(constant) : 1.0;
+        sensitivityParameterIndices[i] = static_cast<int>(mSensitivityParameters[i]);
+    }
+
+    // Create/reinitialise our sensitivity vectors and initialise CVODES' sensitivity analysis.
+    // Note: we let CVODES estimate the sensitivity right-hand sides using difference quotients, which it does by
+    //       perturbing our constants directly, hence we pass our constants array to CVodeSetSensParams().
+
+    if (mSensitivityVectors == nullptr) {
+        mSensitivityVectors = N_VCloneVectorArray(static_cast<int>(sensitivityParameterCount), mStatesVector);
+
+        ASSERT_NE(mSensitivityVectors, nullptr);
+
+        initialiseSensitivityVectors(pVoi);
+
+        ASSERT_EQ(CVodeSensInit(mSolver, static_cast<int>(sensitivityParameterCount), toCvodeSensitivityMethod(mSensitivityMethod),
+                                nullptr, mSensitivityVectors),
+                  CV_SUCCESS);
+        ASSERT_EQ(CVodeSensEEtolerances(mSolver), CV_SUCCESS);
+        ASSERT_EQ(CVodeSetSensErrCon(mSolver, SUNTRUE), CV_SUCCESS);
+    } else {
+        initialiseSensitivityVectors(pVoi);
+
+        ASSERT_EQ(CVodeSensReInit(mSolver, toCvodeSensitivityMethod(mSensitivityMethod), mSensitivityVectors), CV_SUCCESS);
+    }
+
+    ASSERT_EQ(CVodeSetSensParams(mSolver, mConstants, mSensitivityParameterScalings.data(), sensitivityParameterIndices.data()),
+              CV_SUCCESS);
+
+    return true;
+}
+
+void SolverCvode::Impl::initialiseSensitivityVectors(double pVoi)
+{
+    // The initial value of a state may depend on some constants, so estimate the initial sensitivities using forward
+    // differences, unless the state is directly initialised using a constant, in which case its initial sensitivity
+    // with respect to that constant is 1.
+
+    for (size_t i {0}, iMax {mSensitivityParameters.size()}; i < iMax; ++i) {
+        auto *sensitivities {N_VGetArrayPointer(mSensitivityVectors[i])}; // NOLINT
+        auto &constant {mConstants[mSensitivityParameters[i]]}; // NOLINT
+        const auto constantValue {constant};
+        const auto delta {std::sqrt(DBL_EPSILON) * mSensitivityParameterScalings[i]};
+
+        constant += delta;
+
+        computeComputedConstants(pVoi, mStates, &mUserData);
+
+        for (size_t j {0}; j < mSize; ++j) {
+            sensitivities[j] = mUserData.runtime->isStateInitialisedByConstant(j, mSensitivityParameters[i]) ?
+                                   1.0 :
+                                   (mUserData.scratchStates[j] - mStates[j]) / delta; // NOLINT
+        }
+
+        constant = constantValue;
+    }
+
+    // Restore our computed constants.
+
+    computeComputedConstants(pVoi, mStates, &mUserData);
+}
+
+void SolverCvode::Impl::initialiseAdjoint(double pVoi, size_t pConstantCount, size_t pAlgebraicVariableCount)
+{
+    // Keep track of our initial conditions since the gradient of an objective also depends on how our initial states
+    // depend on our constants.
+
+    initialiseScratchArrays(pConstantCount, pAlgebraicVariableCount);
+
+    mAdjointInitialVoi = pVoi;
+    mAdjointInitialStates.assign(mStates, mStates + mSize); // NOLINT
+
+    // Initialise/reinitialise CVODES' adjoint sensitivity analysis so that our forward integration stores the
+    // checkpoints needed by our backward integration.
+
+    if (mAdjointInitialised) {
+        ASSERT_EQ(CVodeAdjReInit(mSolver), CV_SUCCESS);
+    } else {
+        ASSERT_EQ(CVodeAdjInit(mSolver, ADJOINT_CHECKPOINT_STEPS, CV_HERMITE), CV_SUCCESS);
+
+        mAdjointInitialised = true;
+    }
+
+    mAdjoint = true;
+}
+
+bool SolverCvode::Impl::solveAdjointStep(double pVoiEnd)
+{
+    // Integrate our backward problem and retrieve our adjoints and quadratures.
+
+    if (CVodeB(mSolver, pVoiEnd, CV_NORMAL) < CV_SUCCESS) {
+#ifndef CODE_COVERAGE_ENABLED
+        if (mErrorMessage.back() != '.') {
+            mErrorMessage += '.';
+        }
+#endif
+
+        addError(mErrorMessage);
+
+        return false;
+    }
+
+    double voi {};
+
+    ASSERT_EQ(CVodeGetB(mSolver, mAdjointIndex, &voi, mAdjointVector), CV_SUCCESS);
+    ASSERT_EQ(CVodeGetQuadB(mSolver, mAdjointIndex, &voi, mAdjointQuadratureVector), CV_SUCCESS);
+
+    return true;
+}
+
+void SolverCvode::Impl::initialiseAdjointSolver()
+{
+    // Use the same kind of (non)linear solver for our backward problem as for our forward problem.
+    // Note: the Jacobian of our backward problem is -J^T, where J is the Jacobian of our forward problem, so its upper
+    //       and lower half-bandwidths are the lower and upper half-bandwidths of J, respectively.
+
+    if (mIterationType == IterationType::NEWTON) {
+        if (mLinearSolver == LinearSolver::DENSE) {
+            mAdjointSunMatrix = SUNDenseMatrix(static_cast<int64_t>(mSize), static_cast<int64_t>(mSize), mSunContext);
+
+            ASSERT_NE(mAdjointSunMatrix, nullptr);
+
+            mAdjointSunLinearSolver = SUNLinSol_Dense(mAdjointVector, mAdjointSunMatrix, mSunContext);
+
+            ASSERT_NE(mAdjointSunLinearSolver, nullptr);
+
+            ASSERT_EQ(CVodeSetLinearSolverB(mSolver, mAdjointIndex, mAdjointSunLinearSolver, mAdjointSunMatrix), CVLS_SUCCESS);
+            ASSERT_EQ(CVodeSetJacFnB(mSolver, mAdjointIndex, adjointJacobianFunction), CVLS_SUCCESS);
+        } else if (mLinearSolver == LinearSolver::BANDED) {
+            mAdjointSunMatrix = SUNBandMatrix(static_cast<int64_t>(mSize),
+                                              static_cast<int64_t>(mLowerHalfBandwidth), static_cast<int64_t>(mUpperHalfBandwidth),
+                                              mSunContext);
+
+            ASSERT_NE(mAdjointSunMatrix, nullptr);
+
+            mAdjointSunLinearSolver = SUNLinSol_Band(mAdjointVector, mAdjointSunMatrix, mSunContext);
+
+            ASSERT_NE(mAdjointSunLinearSolver, nullptr);
+
+            ASSERT_EQ(CVodeSetLinearSolverB(mSolver, mAdjointIndex, mAdjointSunLinearSolver, mAdjointSunMatrix), CVLS_SUCCESS);
+            ASSERT_EQ(CVodeSetJacFnB(mSolver, mAdjointIndex, adjointJacobianFunction), CVLS_SUCCESS);
+        } else if (mLinearSolver == LinearSolver::DIAGONAL) {
+            ASSERT_EQ(CVDiagB(mSolver, mAdjointIndex), CVDIAG_SUCCESS);
+        } else {
+            // We are dealing with a GMRES/Bi-CGStab/TFQMR linear solver, which is matrix free, so we provide the
+            // product of our Jacobian with a vector and we may need a preconditioner.
+
+            const auto preconditioner {(mPreconditioner == Preconditioner::BANDED) ? SUN_PREC_LEFT : SUN_PREC_NONE};
+
+            if (mLinearSolver == LinearSolver::GMRES) {
+                mAdjointSunLinearSolver = SUNLinSol_SPGMR(mAdjointVector, preconditioner, 0, mSunContext);
+            } else if (mLinearSolver == LinearSolver::BICGSTAB) {
+                mAdjointSunLinearSolver = SUNLinSol_SPBCGS(mAdjointVector, preconditioner, 0, mSunContext);
+            } else {
+                mAdjointSunLinearSolver = SUNLinSol_SPTFQMR(mAdjointVector, preconditioner, 0, mSunContext);
+            }
+
+            ASSERT_NE(mAdjointSunLinearSolver, nullptr);
+
+            ASSERT_EQ(CVodeSetLinearSolverB(mSolver, mAdjointIndex, mAdjointSunLinearSolver, nullptr), CVLS_SUCCESS);
+            ASSERT_EQ(CVodeSetJacTimesB(mSolver, mAdjointIndex, nullptr, adjointJacobianTimesVectorFunction), CVLS_SUCCESS);
+
+            if (mPreconditioner == Preconditioner::BANDED) {
+                ASSERT_EQ(CVBandPrecInitB(mSolver, mAdjointIndex, static_cast<int64_t>(mSize),
+                                          static_cast<int64_t>(mLowerHalfBandwidth),
+                                          static_cast<int64_t>(mUpperHalfBandwidth)),
+                          CVLS_SUCCESS);
+            }
+        }
+    } else {
+        mAdjointSunNonLinearSolver = SUNNonlinSol_FixedPoint(mAdjointVector, 0, mSunContext);
+
+        ASSERT_NE(mAdjointSunNonLinearSolver, nullptr);
+
+        ASSERT_EQ(CVodeSetNonlinearSolverB(mSolver, mAdjointIndex, mAdjointSunNonLinearSolver), CV_SUCCESS);
+    }
+}
+
+bool SolverCvode::Impl::solveAdjoint(double pVoiStart, std::span<const double> pVois, const Doubles &pAdjointJumps,
+                                     Doubles &pGradient)
+{
+    // Our objective is of the form G = sum_k g_k(y(t_k)), so the adjoint lambda satisfies lambda' = -J^T.lambda between
+    // two output points and jumps by dg_k/dy at t_k, while the gradient of G is given by
+    // dG/dp = int_t0^tN lambda^T.df/dp dt + lambda(t0)^T.dy0/dp.
+
+    const auto lastIndex {pVois.size() - 1};
+    const auto constantCount {mUserData.constantCount};
+    auto addAdjointJump = [this, &pAdjointJumps](size_t pIndex) {
+        auto *adjoints {N_VGetArrayPointer(mAdjointVector)};
+
+        for (size_t i {0}; i < mSize; ++i) {
+            adjoints[i] += pAdjointJumps[pIndex * mSize + i]; // NOLINT
+        }
+    };
+
+    // Create/reinitialise our backward problem at the last output point.
+
+    if (mAdjointIndex == -1) {
+        mAdjointVector = newVector(mSize, mThreadCount, mSunContext);
+        mAdjointQuadratureVector = N_VNew_Serial(static_cast<int64_t>(constantCount), mSunContext);
+
+        ASSERT_NE(mAdjointVector, nullptr);
+        ASSERT_NE(mAdjointQuadratureVector, nullptr);
+
+        N_VConst(0.0, mAdjointVector);
+        N_VConst(0.0, mAdjointQuadratureVector);
+
+        addAdjointJump(lastIndex);
+
+        ASSERT_EQ(CVodeCreateB(mSolver, (mIntegrationMethod == IntegrationMethod::BDF) ? CV_BDF : CV_ADAMS, &mAdjointIndex),
+                  CV_SUCCESS);
+        ASSERT_EQ(CVodeInitB(mSolver, mAdjointIndex, adjointRhsFunction, pVois[lastIndex], mAdjointVector), CV_SUCCESS);
+        ASSERT_EQ(CVodeSetUserDataB(mSolver, mAdjointIndex, &mUserData), CV_SUCCESS);
+        ASSERT_EQ(CVodeSetMaxNumStepsB(mSolver, mAdjointIndex, mMaximumNumberOfSteps), CV_SUCCESS);
+        ASSERT_EQ(CVodeSStolerancesB(mSolver, mAdjointIndex, mRelativeTolerance, mAbsoluteTolerance), CV_SUCCESS);
+
+        initialiseAdjointSolver();
+
+        ASSERT_EQ(CVodeQuadInitB(mSolver, mAdjointIndex, adjointQuadratureRhsFunction, mAdjointQuadratureVector), CV_SUCCESS);
+        ASSERT_EQ(CVodeQuadSStolerancesB(mSolver, mAdjointIndex, mRelativeTolerance, mAbsoluteTolerance), CV_SUCCESS);
+        ASSERT_EQ(CVodeSetQuadErrConB(mSolver, mAdjointIndex, SUNTRUE), CV_SUCCESS);
+    } else {
+        N_VConst(0.0, mAdjointVector);
+        N_VConst(0.0, mAdjointQuadratureVector);
+
+        addAdjointJump(lastIndex);
+
+        ASSERT_EQ(CVodeReInitB(mSolver, mAdjointIndex, pVois[lastIndex], mAdjointVector), CV_SUCCESS);
+        ASSERT_EQ(CVodeQuadReInitB(mSolver, mAdjointIndex, mAdjointQuadratureVector), CV_SUCCESS);
+    }
+
+    // Integrate our backward problem from one output point to the previous one, accounting for the jump in our adjoints
+    // at each of them, and then all the way back to our initial point.
+
+    for (auto k {lastIndex}; k > 0; --k) {
+        if (!solveAdjointStep(pVois[k - 1])) {
+            return false;
+        }
+
+        addAdjointJump(k - 1);
+
+        ASSERT_EQ(CVodeReInitB(mSolver, mAdjointIndex, pVois[k - 1], mAdjointVector), CV_SUCCESS);
+        ASSERT_EQ(CVodeQuadReInitB(mSolver, mAdjointIndex, mAdjointQuadratureVector), CV_SUCCESS);
+    }
+
+    if (!fuzzyCompare(pVoiStart, pVois[0]) && !solveAdjointStep(pVoiStart)) {
+        return false;
+    }
+
+    // Retrieve our gradient, i.e. our quadratures to which we add the contribution of our initial states, which we
+    // estimate using forward differences (unless a state is directly initialised using a constant).
+
+    const auto *adjoints {N_VGetArrayPointer(mAdjointVector)};
+    const auto *adjointQuadratures {N_VGetArrayPointer(mAdjointQuadratureVector)};
+
+    pGradient.assign(adjointQuadratures, adjointQuadratures + constantCount); // NOLINT
+
+    for (size_t k {0}; k < constantCount; ++k) {
+        auto &constant {mConstants[k]}; // NOLINT
+        const auto constantValue {constant};
+        const auto delta {std::sqrt(DBL_EPSILON) * std::max(std::abs(constantValue), 1.0)};
+
+        constant = constantValue + delta;
+
+        computeComputedConstants(mAdjointInitialVoi, mAdjointInitialStates.data(), &mUserData);
+
+        for (size_t i {0}; i < mSize; ++i) {
+            pGradient[k] += adjoints[i] * (mUserData.runtime->isStateInitialisedByConstant(i, k) ? // NOLINT
+                                               1.0 :
+                                               (mUserData.scratchStates[i] - mAdjointInitialStates[i]) / delta); // NOLINT
+        }
+
+        constant = constantValue;
+    }
+
+    computeComputedConstants(mAdjointInitialVoi, mAdjointInitialStates.data(), &mUserData);
 
     return true;
 }
@@ -838,6 +1483,72 @@ void SolverCvode::Impl::setInterpolateSolution(bool pInterpolateSolution)
     mInterpolateSolution = pInterpolateSolution;
 }
 
+int SolverCvode::Impl::threadCount() const noexcept
+{
+    return mThreadCount;
+}
+
+void SolverCvode::Impl::setThreadCount(int pThreadCount)
+{
+    mThreadCount = pThreadCount;
+}
+
+SolverCvode::SensitivityMethod SolverCvode::Impl::sensitivityMethod() const noexcept
+{
+    return mSensitivityMethod;
+}
+
+void SolverCvode::Impl::setSensitivityMethod(SolverCvode::SensitivityMethod pSensitivityMethod)
+{
+    mSensitivityMethod = pSensitivityMethod;
+}
+
+bool SolverCvode::Impl::hasSensitivityParameters() const noexcept
+{
+    return !mSensitivityParameters.empty();
+}
+
+size_t SolverCvode::Impl::sensitivityParameterCount() const noexcept
+{
+    return mSensitivityParameters.size();
+}
+
+size_t SolverCvode::Impl::sensitivityParameter(size_t pIndex) const noexcept
+{
+    if (pIndex >= mSensitivityParameters.size()) {
+        return SIZE_MAX;
+    }
+
+    return mSensitivityParameters[pIndex];
+}
+
+bool SolverCvode::Impl::addSensitivityParameter(size_t pConstantIndex)
+{
+    if (std::ranges::find(mSensitivityParameters, pConstantIndex) != mSensitivityParameters.end()) {
+        return false;
+    }
+
+    mSensitivityParameters.push_back(pConstantIndex);
+
+    return true;
+}
+
+bool SolverCvode::Impl::removeAllSensitivityParameters()
+{
+    if (mSensitivityParameters.empty()) {
+        return false;
+    }
+
+    mSensitivityParameters.clear();
+
+    return true;
+}
+
+const double *SolverCvode::Impl::sensitivity(size_t pIndex) const
+{
+    return N_VGetArrayPointer(mSensitivityVectors[pIndex]); // NOLINT
+}
+
 bool SolverCvode::Impl::solve(double &pVoi, double pVoiEnd)
 {
     // Solve the model using interpolation, if needed.
@@ -846,7 +1557,15 @@ bool SolverCvode::Impl::solve(double &pVoi, double pVoiEnd)
         ASSERT_EQ(CVodeSetStopTime(mSolver, pVoiEnd), CV_SUCCESS);
     }
 
-    auto res {CVode(mSolver, pVoiEnd, mStatesVector, &pVoi, CV_NORMAL)};
+    int res {};
+
+    if (mAdjoint) {
+        int checkpointCount {};
+
+        res = CVodeF(mSolver, pVoiEnd, mStatesVector, &pVoi, CV_NORMAL, &checkpointCount);
+    } else {
+        res = CVode(mSolver, pVoiEnd, mStatesVector, &pVoi, CV_NORMAL);
+    }
 
     // Make sure that everything went fine.
 
@@ -862,6 +1581,17 @@ bool SolverCvode::Impl::solve(double &pVoi, double pVoiEnd)
         return false;
     }
 
+    // Retrieve our sensitivities, if needed, and make sure that our computed constants are not those of a perturbed
+    // constant.
+
+    if (mSensitivityVectors != nullptr) {
+        double voi {};
+
+        ASSERT_EQ(CVodeGetSens(mSolver, &voi, mSensitivityVectors), CV_SUCCESS);
+
+        computeComputedConstants(pVoi, mStates, &mUserData);
+    }
+
     // Make sure the rates are up to date.
 
     computeRates(pVoi, mStates, mRates, mConstants, mComputedConstants, mAlgebraic);
@@ -1001,4 +1731,49 @@ void SolverCvode::setInterpolateSolution(bool pInterpolateSolution)
     pimpl()->setInterpolateSolution(pInterpolateSolution);
 }
 
+int SolverCvode::threadCount() const noexcept
+{
+    return pimpl()->threadCount();
+}
+
+void SolverCvode::setThreadCount(int pThreadCount)
+{
+    pimpl()->setThreadCount(pThreadCount);
+}
+
+SolverCvode::SensitivityMethod SolverCvode::sensitivityMethod() const noexcept
+{
+    return pimpl()->sensitivityMethod();
+}
+
+void SolverCvode::setSensitivityMethod(SolverCvode::SensitivityMethod pSensitivityMethod)
+{
+    pimpl()->setSensitivityMethod(pSensitivityMethod);
+}
+
+bool SolverCvode::hasSensitivityParameters() const noexcept
+{
+    return pimpl()->hasSensitivityParameters();
+}
+
+size_t SolverCvode::sensitivityParameterCount() const noexcept
+{
+    return pimpl()->sensitivityParameterCount();
+}
+
+size_t SolverCvode::sensitivityParameter(size_t pIndex) const noexcept
+{
+    return pimpl()->sensitivityParameter(pIndex);
+}
+
+bool SolverCvode::addSensitivityParameter(size_t pConstantIndex)
+{
+    return pimpl()->addSensitivityParameter(pConstantIndex);
+}
+
+bool SolverCvode::removeAllSensitivityParameters()
+{
+    return pimpl()->removeAllSensitivityParameters();
+}
+
 } // namespace libOpenCOR
@@ -23,6 +23,8 @@ limitations under the License.
 #include "sundials/sundials_linearsolver.h"
 #include "sundials/sundials_nonlinearsolver.h"
 
+#include <span>
+
 namespace libOpenCOR {
 
 struct SolverCvodeUserData
@@ -32,6 +34,17 @@ struct SolverCvodeUserData
     double *algebraicVariables {nullptr};
 
     CellmlFileRuntimePtr runtime;
+
+    bool sensitivities {false};
+
+    Doubles scratchStates;
+    Doubles scratchRates;
+    Doubles scratchAlgebraicVariables;
+
+    Doubles perturbedStates;
+    Doubles baseRates;
+    Doubles perturbedRates;
+    size_t constantCount {0};
 };
 
 class SolverCvode::Impl final: public SolverOde::Impl
@@ -50,6 +63,10 @@ public:
     static constexpr auto DEFAULT_RELATIVE_TOLERANCE {1e-07};
     static constexpr auto DEFAULT_ABSOLUTE_TOLERANCE {1e-07};
     static constexpr auto DEFAULT_INTERPOLATE_SOLUTION {true};
+    static constexpr auto DEFAULT_THREAD_COUNT {1};
+    static constexpr auto DEFAULT_SENSITIVITY_METHOD {SensitivityMethod::STAGGERED};
+
+    static constexpr auto ADJOINT_CHECKPOINT_STEPS {100};
 
     double mMaximumStep {DEFAULT_MAXIMUM_STEP};
     int mMaximumNumberOfSteps {DEFAULT_MAXIMUM_NUMBER_OF_STEPS};
@@ -62,12 +79,31 @@ public:
     double mRelativeTolerance {DEFAULT_RELATIVE_TOLERANCE};
     double mAbsoluteTolerance {DEFAULT_ABSOLUTE_TOLERANCE};
     bool mInterpolateSolution {DEFAULT_INTERPOLATE_SOLUTION};
+    int mThreadCount {DEFAULT_THREAD_COUNT};
+    SensitivityMethod mSensitivityMethod {DEFAULT_SENSITIVITY_METHOD};
+    std::vector<size_t> mSensitivityParameters;
 
     SUNContext mSunContext {nullptr};
 
     void *mSolver {nullptr};
 
     N_Vector mStatesVector {nullptr};
+    N_Vector *mSensitivityVectors {nullptr};
+
+    Doubles mSensitivityParameterScalings;
+
+    bool mAdjoint {false};
+    bool mAdjointInitialised {false};
+    int mAdjointIndex {-1};
+    double mAdjointInitialVoi {0.0};
+    Doubles mAdjointInitialStates;
+
+    N_Vector mAdjointVector {nullptr};
+    N_Vector mAdjointQuadratureVector {nullptr};
+
+    SUNMatrix mAdjointSunMatrix {nullptr};
+    SUNLinearSolver mAdjointSunLinearSolver {nullptr};
+    SUNNonlinearSolver mAdjointSunNonLinearSolver {nullptr};
 
     SUNMatrix mSunMatrix {nullptr};
     SUNLinearSolver mSunLinearSolver {nullptr};
@@ -91,6 +127,21 @@ public:
                     const CellmlFileRuntimePtr &pRuntime) override;
     bool reinitialise(double pVoi) override;
 
+    Doubles checkpointState() const override;
+    bool restoreCheckpointState(double pVoi, const Doubles &pState) override;
+
+    SolverOdeStatistics statistics() const override;
+
+    void initialiseScratchArrays(size_t pConstantCount, size_t pAlgebraicVariableCount);
+
+    bool initialiseSensitivities(double pVoi, size_t pConstantCount, size_t pAlgebraicVariableCount);
+    void initialiseSensitivityVectors(double pVoi);
+
+    void initialiseAdjoint(double pVoi, size_t pConstantCount, size_t pAlgebraicVariableCount);
+    void initialiseAdjointSolver();
+    bool solveAdjointStep(double pVoiEnd);
+    bool solveAdjoint(double pVoiStart, std::span<const double> pVois, const Doubles &pAdjointJumps, Doubles &pGradient);
+
     double maximumStep() const noexcept;
     void setMaximumStep(double pMaximumStep);
 
@@ -124,6 +175,20 @@ public:
     bool interpolateSolution() const noexcept;
     void setInterpolateSolution(bool pInterpolateSolution);
 
+    int threadCount() const noexcept;
+    void setThreadCount(int pThreadCount);
+
+    SensitivityMethod sensitivityMethod() const noexcept;
+    void setSensitivityMethod(SensitivityMethod pSensitivityMethod);
+
+    bool hasSensitivityParameters() const noexcept;
+    size_t sensitivityParameterCount() const noexcept;
+    size_t sensitivityParameter(size_t pIndex) const noexcept;
+    bool addSensitivityParameter(size_t pConstantIndex);
+    bool removeAllSensitivityParameters();
+
+    const double *sensitivity(size_t pIndex) const;
+
     bool solve(double &pVoi, double pVoiEnd) override;
 };
 
@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "solverfourthorderrungekutta_p.h"
 
+#include <algorithm>
+
 namespace libOpenCOR {
 
 // Solver.
@@ -44,17 +46,18 @@ bool SolverFourthOrderRungeKutta::Impl::initialise(double pVoi, size_t pSize, do
         return false;
     }
 
-    // Create our various arrays.
+    // Create our various arrays, carving them from our arena.
+
+    const auto arrays {mArena.carve<4>({pSize, pSize, pSize, pSize})};
 
-    mK1Doubles.resize(pSize, NAN);
-    mK2Doubles.resize(pSize, NAN);
-    mK3Doubles.resize(pSize, NAN);
-    mYkDoubles.resize(pSize, NAN);
+    for (const auto &array : arrays) {
+        std::fill(array.begin(), array.end(), NAN);
+    }
 
-    mK1 = mK1Doubles.data();
-    mK2 = mK2Doubles.data();
-    mK3 = mK3Doubles.data();
-    mYk = mYkDoubles.data();
+    mK1 = arrays[0].data();
+    mK2 = arrays[1].data();
+    mK3 = arrays[2].data();
+    mYk = arrays[3].data();
 
     return true;
 }
@@ -18,6 +18,8 @@ limitations under the License.
 
 #include "solverodefixedstep_p.h"
 
+#include "arena.h"
+
 #include "libopencor/solverfourthorderrungekutta.h"
 
 namespace libOpenCOR {
@@ -30,10 +32,7 @@ public:
     double *mK3 {nullptr};
     double *mYk {nullptr};
 
-    Doubles mK1Doubles;
-    Doubles mK2Doubles;
-    Doubles mK3Doubles;
-    Doubles mYkDoubles;
+    Arena mArena;
 
     explicit Impl();
 
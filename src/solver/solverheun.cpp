@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "solverheun_p.h"
 
+#include <algorithm>
+
 namespace libOpenCOR {
 
 // Solver.
@@ -44,13 +46,16 @@ bool SolverHeun::Impl::initialise(double pVoi, size_t pSize, double *pStates, do
         return false;
     }
 
-    // Create our various arrays.
+    // Create our various arrays, carving them from our arena.
+
+    const auto arrays {mArena.carve<2>({pSize, pSize})};
 
-    mKDoubles.resize(pSize, NAN);
-    mYkDoubles.resize(pSize, NAN);
+    for (const auto &array : arrays) {
+        std::fill(array.begin(), array.end(), NAN);
+    }
 
-    mK = mKDoubles.data();
-    mYk = mYkDoubles.data();
+    mK = arrays[0].data();
+    mYk = arrays[1].data();
 
     return true;
 }
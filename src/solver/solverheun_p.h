@@ -18,6 +18,8 @@ limitations under the License.
 
 #include "solverodefixedstep_p.h"
 
+#include "arena.h"
+
 #include "libopencor/solverheun.h"
 
 namespace libOpenCOR {
@@ -28,8 +30,7 @@ public:
     double *mK {nullptr};
     double *mYk {nullptr};
 
-    Doubles mKDoubles;
-    Doubles mYkDoubles;
+    Arena mArena;
 
     explicit Impl();
 
@@ -15,9 +15,9 @@ limitations under the License.
 */
 
 #include "solverkinsol_p.h"
+#include "solvervector.h"
 
 #include "kinsol/kinsol.h"
-#include "nvector/nvector_serial.h"
 #include "sedml/SedAlgorithm.h"
 #include "sunlinsol/sunlinsol_band.h"
 #include "sunlinsol/sunlinsol_dense.h"
@@ -83,11 +83,12 @@ int computeObjectiveFunction(N_Vector pU, N_Vector pF, void *pUserData)
 {
     // Make sure that our input vector doesn't contain any Inf or NaN values.
 
-    auto iMax {NV_LENGTH_S(pU)};
+    auto iMax {N_VGetLength(pU)};
+    const auto *u {N_VGetArrayPointer(pU)};
     auto *userData {static_cast<SolverKinsolUserData *>(pUserData)};
 
     for (sunindextype i = 0; i < iMax; ++i) {
-        if (isInfOrNan(NV_Ith_S(pU, i))) {
+        if (isInfOrNan(u[i])) { // NOLINT
             userData->infOrNanFound = true;
 
             return -1;
@@ -98,9 +99,9 @@ int computeObjectiveFunction(N_Vector pU, N_Vector pF, void *pUserData)
     // clang-format off
     EM_ASM({
         globalThis.runtime.computeObjectiveFunctions[$0]($1, $2, $3);
-    }, userData->computeObjectiveFunctionIndex, N_VGetArrayPointer_Serial(pU), N_VGetArrayPointer_Serial(pF), userData->userData); // clang-format on
+    }, userData->computeObjectiveFunctionIndex, N_VGetArrayPointer(pU), N_VGetArrayPointer(pF), userData->userData); // clang-format on
 #else
-    userData->computeObjectiveFunction(N_VGetArrayPointer_Serial(pU), N_VGetArrayPointer_Serial(pF), userData->userData);
+    userData->computeObjectiveFunction(N_VGetArrayPointer(pU), N_VGetArrayPointer(pF), userData->userData);
 #endif
 
     return 0;
@@ -133,7 +134,7 @@ void SolverKinsol::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
         warning += pKisaoId;
         warning += "' is not recognised. It will be ignored.";
 
-        addWarning(warning);
+        addWarning(std::move(warning));
     };
 
     for (unsigned int i {0}; i < pAlgorithm->getNumAlgorithmParameters(); ++i) {
@@ -158,7 +159,7 @@ void SolverKinsol::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultIterations;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mMaximumNumberOfIterations = DEFAULT_MAXIMUM_NUMBER_OF_ITERATIONS;
             }
@@ -177,7 +178,7 @@ void SolverKinsol::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultLinearSolver;
                 warning += " linear solver will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 value = toString(DEFAULT_LINEAR_SOLVER);
             }
@@ -208,7 +209,7 @@ void SolverKinsol::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultUpperHalfBandwidth;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mUpperHalfBandwidth = DEFAULT_UPPER_HALF_BANDWIDTH;
             }
@@ -229,7 +230,7 @@ void SolverKinsol::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultLowerHalfBandwidth;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mLowerHalfBandwidth = DEFAULT_LOWER_HALF_BANDWIDTH;
             }
@@ -248,6 +249,7 @@ SolverPtr SolverKinsol::Impl::duplicate()
     solverPimpl->mLinearSolver = mLinearSolver;
     solverPimpl->mUpperHalfBandwidth = mUpperHalfBandwidth;
     solverPimpl->mLowerHalfBandwidth = mLowerHalfBandwidth;
+    solverPimpl->mThreadCount = mThreadCount;
 
     return solver;
 }
@@ -304,6 +306,16 @@ void SolverKinsol::Impl::setLowerHalfBandwidth(int pLowerHalfBandwidth)
     mLowerHalfBandwidth = pLowerHalfBandwidth;
 }
 
+int SolverKinsol::Impl::threadCount() const noexcept
+{
+    return mThreadCount;
+}
+
+void SolverKinsol::Impl::setThreadCount(int pThreadCount)
+{
+    mThreadCount = pThreadCount;
+}
+
 #ifdef __EMSCRIPTEN__
 bool SolverKinsol::Impl::solve(intptr_t pComputeObjectiveFunctionIndex, double *pU, size_t pN, void *pUserData)
 #else
@@ -325,7 +337,20 @@ bool SolverKinsol::Impl::solve(ComputeObjectiveFunction pComputeObjectiveFunctio
         error += maximumNumberOfIterations;
         error += ". It must be greater than 0.";
 
-        addError(error);
+        addError(std::move(error));
+    }
+
+    if (mThreadCount <= 0) {
+        const auto threadCount {toString(mThreadCount)};
+        std::string error;
+
+        error.reserve(threadCount.size() + 69); // NOLINT
+
+        error += "The number of threads cannot be equal to ";
+        error += threadCount;
+        error += ". It must be greater than 0.";
+
+        addError(std::move(error));
     }
 
     bool needUpperAndLowerHalfBandwidths = false;
@@ -350,7 +375,7 @@ bool SolverKinsol::Impl::solve(ComputeObjectiveFunction pComputeObjectiveFunctio
             error += maximumUpperHalfBandwidth;
             error += ".";
 
-            addError(error);
+            addError(std::move(error));
         }
 
         if ((mLowerHalfBandwidth < 0) || std::cmp_greater_equal(mLowerHalfBandwidth, pN)) {
@@ -366,7 +391,7 @@ bool SolverKinsol::Impl::solve(ComputeObjectiveFunction pComputeObjectiveFunctio
             error += maximumLowerHalfBandwidth;
             error += ".";
 
-            addError(error);
+            addError(std::move(error));
         }
     }
 
@@ -397,8 +422,8 @@ bool SolverKinsol::Impl::solve(ComputeObjectiveFunction pComputeObjectiveFunctio
 
     // Initialise our KINSOL solver.
 
-    auto *u {N_VMake_Serial(static_cast<int64_t>(pN), pU, mSunContext)};
-    auto *ones {N_VNew_Serial(static_cast<int64_t>(pN), mSunContext)};
+    auto *u {makeVector(pN, pU, mThreadCount, mSunContext)};
+    auto *ones {newVector(pN, mThreadCount, mSunContext)};
 
     ASSERT_NE(u, nullptr);
     ASSERT_NE(ones, nullptr);
@@ -463,10 +488,20 @@ bool SolverKinsol::Impl::solve(ComputeObjectiveFunction pComputeObjectiveFunctio
 
     auto res = KINSol(solver, u, KIN_LINESEARCH, ones, ones);
 
+    // Keep track of the number of nonlinear iterations that were needed, if requested.
+
+    if (mInstrumented) {
+        long iterationCount {0}; // NOLINT
+
+        KINGetNumNonlinSolvIters(solver, &iterationCount);
+
+        mIterationCount += static_cast<size_t>(iterationCount);
+    }
+
     // Release some memory, but keep the SUNContext cached for reuse.
 
-    N_VDestroy_Serial(u);
-    N_VDestroy_Serial(ones);
+    N_VDestroy(u);
+    N_VDestroy(ones);
     SUNMatDestroy(sunMatrix);
     SUNLinSolFree(sunLinearSolver);
 
@@ -555,4 +590,14 @@ void SolverKinsol::setLowerHalfBandwidth(int pLowerHalfBandwidth)
     pimpl()->setLowerHalfBandwidth(pLowerHalfBandwidth);
 }
 
+int SolverKinsol::threadCount() const noexcept
+{
+    return pimpl()->threadCount();
+}
+
+void SolverKinsol::setThreadCount(int pThreadCount)
+{
+    pimpl()->setThreadCount(pThreadCount);
+}
+
 } // namespace libOpenCOR
@@ -33,11 +33,13 @@ public:
     static constexpr auto DEFAULT_LINEAR_SOLVER {LinearSolver::DENSE};
     static constexpr auto DEFAULT_UPPER_HALF_BANDWIDTH {0};
     static constexpr auto DEFAULT_LOWER_HALF_BANDWIDTH {0};
+    static constexpr auto DEFAULT_THREAD_COUNT {1};
 
     int mMaximumNumberOfIterations {DEFAULT_MAXIMUM_NUMBER_OF_ITERATIONS};
     LinearSolver mLinearSolver {DEFAULT_LINEAR_SOLVER};
     int mUpperHalfBandwidth {DEFAULT_UPPER_HALF_BANDWIDTH};
     int mLowerHalfBandwidth {DEFAULT_LOWER_HALF_BANDWIDTH};
+    int mThreadCount {DEFAULT_THREAD_COUNT};
 
     SUNContext mSunContext {nullptr};
 
@@ -62,6 +64,9 @@ public:
     int lowerHalfBandwidth() const noexcept;
     void setLowerHalfBandwidth(int pLowerHalfBandwidth);
 
+    int threadCount() const noexcept;
+    void setThreadCount(int pThreadCount);
+
 #ifdef __EMSCRIPTEN__
     bool solve(intptr_t pComputeObjectiveFunctionIndex, double *pU, size_t pN, void *pUserData) override;
 #else
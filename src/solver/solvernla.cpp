@@ -15,7 +15,9 @@ limitations under the License.
 */
 
 #include "solvernla_p.h"
+#include "tracer.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace libOpenCOR {
@@ -52,6 +54,33 @@ SolverNla::Impl::Impl(const std::string &pId, const std::string &pName)
 {
 }
 
+void SolverNla::Impl::resetStatistics()
+{
+    mSolveTime = 0.0;
+    mIterationCount = 0;
+
+    mSystemSolveCounts.clear();
+}
+
+void SolverNla::Impl::trackSolve(uintptr_t pSystem, double pSolveTime)
+{
+    // Keep track of the time spent solving our NLA systems and of the number of times each of them was solved.
+    // Note: an NLA system is identified by its objective function and a model rarely has more than a few NLA systems,
+    //       so a linear search is all we need.
+
+    mSolveTime += pSolveTime;
+
+    auto systemSolveCount {std::find_if(mSystemSolveCounts.begin(), mSystemSolveCounts.end(), [pSystem](const auto &pSystemSolveCount) {
+        return pSystemSolveCount.first == pSystem;
+    })};
+
+    if (systemSolveCount != mSystemSolveCounts.end()) {
+        ++systemSolveCount->second;
+    } else {
+        mSystemSolveCounts.emplace_back(pSystem, 1);
+    }
+}
+
 SolverNla::SolverNla(std::unique_ptr<Impl> pPimpl)
     : Solver(std::move(pPimpl))
 {
@@ -75,12 +104,36 @@ Solver::Type SolverNla::type() const noexcept
 #ifdef __EMSCRIPTEN__
 bool SolverNla::solve(intptr_t pComputeObjectiveFunctionIndex, double *pU, size_t pN, void *pUserData)
 {
-    return pimpl()->solve(pComputeObjectiveFunctionIndex, pU, pN, pUserData);
+    const TraceScope traceScope {"SolverNla::solve", "solver"};
+    auto *solverPimpl {pimpl()};
+
+    if (!solverPimpl->mInstrumented) {
+        return solverPimpl->solve(pComputeObjectiveFunctionIndex, pU, pN, pUserData);
+    }
+
+    auto startTime {std::chrono::high_resolution_clock::now()};
+    auto res {solverPimpl->solve(pComputeObjectiveFunctionIndex, pU, pN, pUserData)};
+
+    solverPimpl->trackSolve(static_cast<uintptr_t>(pComputeObjectiveFunctionIndex), elapsedTime(startTime));
+
+    return res;
 }
 #else
 bool SolverNla::solve(ComputeObjectiveFunction pComputeObjectiveFunction, double *pU, size_t pN, void *pUserData)
 {
-    return pimpl()->solve(pComputeObjectiveFunction, pU, pN, pUserData);
+    const TraceScope traceScope {"SolverNla::solve", "solver"};
+    auto *solverPimpl {pimpl()};
+
+    if (!solverPimpl->mInstrumented) {
+        return solverPimpl->solve(pComputeObjectiveFunction, pU, pN, pUserData);
+    }
+
+    auto startTime {std::chrono::high_resolution_clock::now()};
+    auto res {solverPimpl->solve(pComputeObjectiveFunction, pU, pN, pUserData)};
+
+    solverPimpl->trackSolve(reinterpret_cast<uintptr_t>(pComputeObjectiveFunction), elapsedTime(startTime)); // NOLINT
+
+    return res;
 }
 #endif
 
@@ -36,8 +36,16 @@ void setNlaSolverAddress(uintptr_t pAddress);
 class SolverNla::Impl: public Solver::Impl
 {
 public:
+    bool mInstrumented {false};
+    double mSolveTime {0.0};
+    size_t mIterationCount {0};
+    std::vector<std::pair<uintptr_t, size_t>> mSystemSolveCounts;
+
     explicit Impl(const std::string &pId, const std::string &pName);
 
+    void resetStatistics();
+    void trackSolve(uintptr_t pSystem, double pSolveTime);
+
 #ifdef __EMSCRIPTEN__
     virtual bool solve(intptr_t pComputeObjectiveFunctionIndex, double *pU, size_t pN, void *pUserData) = 0;
 #else
@@ -49,6 +49,27 @@ bool SolverOde::Impl::reinitialise(double pVoi)
     return true;
 }
 
+Doubles SolverOde::Impl::checkpointState() const
+{
+    // By default, an ODE solver has no internal state to checkpoint, i.e. it only depends on our states.
+
+    return {};
+}
+
+bool SolverOde::Impl::restoreCheckpointState(double pVoi, const Doubles &pState)
+{
+    (void)pState;
+
+    return reinitialise(pVoi);
+}
+
+SolverOdeStatistics SolverOde::Impl::statistics() const
+{
+    // By default, an ODE solver doesn't keep track of any statistics.
+
+    return {};
+}
+
 void SolverOde::Impl::computeRates(double pVoi, double *pStates, double *pRates,
                                    double *pConstants, double *pComputedConstants, double *pAlgebraicVariables) const
 {
@@ -24,6 +24,15 @@ limitations under the License.
 
 namespace libOpenCOR {
 
+struct SolverOdeStatistics
+{
+    size_t stepCount {0};
+    size_t rhsEvaluationCount {0};
+    size_t linearSolverSetupCount {0};
+    size_t jacobianEvaluationCount {0};
+    size_t errorTestFailureCount {0};
+};
+
 class SolverOde::Impl: public Solver::Impl
 {
 public:
@@ -44,6 +53,11 @@ public:
                             const CellmlFileRuntimePtr &pRuntime) = 0;
     virtual bool reinitialise(double pVoi);
 
+    virtual Doubles checkpointState() const;
+    virtual bool restoreCheckpointState(double pVoi, const Doubles &pState);
+
+    virtual SolverOdeStatistics statistics() const;
+
     virtual bool solve(double &pVoi, double pVoiEnd) = 0;
 
     void computeRates(double pVoi, double *pStates, double *pRates,
@@ -38,7 +38,7 @@ void SolverOdeFixedStep::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
         warning += pKisaoId;
         warning += "' is not recognised. It will be ignored.";
 
-        addWarning(warning);
+        addWarning(std::move(warning));
     };
 
     for (unsigned int i {0}; i < pAlgorithm->getNumAlgorithmParameters(); ++i) {
@@ -63,7 +63,7 @@ void SolverOdeFixedStep::Impl::populate(libsedml::SedAlgorithm *pAlgorithm)
                 warning += defaultStep;
                 warning += " will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 mStep = DEFAULT_STEP;
             }
@@ -113,7 +113,7 @@ bool SolverOdeFixedStep::Impl::initialise(double pVoi, size_t pSize, double *pSt
         error += stepAsString;
         error += ". It must be greater than 0.";
 
-        addError(error);
+        addError(std::move(error));
 
         return false;
     }
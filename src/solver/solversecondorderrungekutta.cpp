@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "solversecondorderrungekutta_p.h"
 
+#include <algorithm>
+
 namespace libOpenCOR {
 
 // Solver.
@@ -44,11 +46,13 @@ bool SolverSecondOrderRungeKutta::Impl::initialise(double pVoi, size_t pSize, do
         return false;
     }
 
-    // Create our various arrays.
+    // Create our array, carving it from our arena.
+
+    const auto arrays {mArena.carve<1>({pSize})};
 
-    mYkDoubles.resize(pSize, NAN);
+    std::fill(arrays[0].begin(), arrays[0].end(), NAN);
 
-    mYk = mYkDoubles.data();
+    mYk = arrays[0].data();
 
     return true;
 }
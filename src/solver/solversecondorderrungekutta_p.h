@@ -18,6 +18,8 @@ limitations under the License.
 
 #include "solverodefixedstep_p.h"
 
+#include "arena.h"
+
 #include "libopencor/solversecondorderrungekutta.h"
 
 namespace libOpenCOR {
@@ -27,7 +29,7 @@ class SolverSecondOrderRungeKutta::Impl final: public SolverOdeFixedStep::Impl
 public:
     double *mYk {nullptr};
 
-    Doubles mYkDoubles;
+    Arena mArena;
 
     explicit Impl();
 
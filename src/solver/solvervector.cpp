@@ -0,0 +1,55 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "solvervector.h"
+
+#include "nvector/nvector_serial.h"
+
+#ifdef THREADED_VECTORS_ENABLED
+#    include "nvector/nvector_pthreads.h"
+#endif
+
+#include <cstdint>
+
+namespace libOpenCOR {
+
+N_Vector makeVector(size_t pSize, double *pData, int pThreadCount, SUNContext pContext)
+{
+#ifdef THREADED_VECTORS_ENABLED
+    if (pThreadCount > 1) {
+        return N_VMake_Pthreads(static_cast<int64_t>(pSize), pThreadCount, pData, pContext);
+    }
+#else
+    (void)pThreadCount;
+#endif
+
+    return N_VMake_Serial(static_cast<int64_t>(pSize), pData, pContext);
+}
+
+N_Vector newVector(size_t pSize, int pThreadCount, SUNContext pContext)
+{
+#ifdef THREADED_VECTORS_ENABLED
+    if (pThreadCount > 1) {
+        return N_VNew_Pthreads(static_cast<int64_t>(pSize), pThreadCount, pContext);
+    }
+#else
+    (void)pThreadCount;
+#endif
+
+    return N_VNew_Serial(static_cast<int64_t>(pSize), pContext);
+}
+
+} // namespace libOpenCOR
@@ -0,0 +1,29 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "sundials/sundials_nvector.h"
+
+namespace libOpenCOR {
+
+// Create a SUNDIALS vector, which is a threaded vector if we were built with threaded vectors and more than one thread
+// is requested, and a serial vector otherwise.
+
+N_Vector makeVector(size_t pSize, double *pData, int pThreadCount, SUNContext pContext);
+N_Vector newVector(size_t pSize, int pThreadCount, SUNContext pContext);
+
+} // namespace libOpenCOR
@@ -17,6 +17,7 @@ limitations under the License.
 #include "cellmlfile_p.h"
 #include "file_p.h"
 
+#include "tracer.h"
 #include "utils.h"
 
 #include "libopencor/seddocument.h"
@@ -27,17 +28,233 @@ limitations under the License.
 #include "libopencor/solvercvode.h"
 #include "libopencor/solverkinsol.h"
 
+#include <algorithm>
+#include <list>
 #include <mutex>
+#include <optional>
+#include <set>
+#include <stack>
 #include <unordered_map>
 
 namespace libOpenCOR {
 
 namespace {
 
-// Cache of compiled runtimes, keyed by CellmlFile pointer.
+// Lock the given compiled runtimes, tracing how long it takes to acquire the lock since several threads may want to
+// access them at the same time.
 
-std::mutex sRuntimesMutex; // NOLINT
-std::unordered_map<const CellmlFile *, CellmlFileRuntimePtr> sRuntimes; // NOLINT
+std::unique_lock<std::mutex> lockRuntimes(CellmlFileRuntimes &pRuntimes)
+{
+    const TraceScope traceScope {"runtimesMutex", "lock"};
+
+    return std::unique_lock<std::mutex>(pRuntimes.mutex);
+}
+
+// Cache of analysed models, keyed by the contents of a model and of the models that it imports (together with their
+// URL, since the same contents may import different models depending on where it is located), as well as by whether
+// the model was parsed in strict mode. The cache is bounded and the least recently used analysed model gets evicted
+// when a new one needs to be cached.
+// Note: the full key is kept (rather than just a hash of it) so that two different models can never be mistaken for
+//       one another. The compiled runtimes of an analysed model are only weakly referenced, so that they get released
+//       once no CellML file uses them anymore.
+
+struct AnalysedModel
+{
+    libcellml::ModelPtr model;
+    libcellml::AnalyserPtr analyser;
+    libcellml::AnalyserModelPtr analyserModel;
+    CellmlFileRuntimesPtr runtimes;
+};
+
+struct CachedAnalysedModel
+{
+    std::string key;
+    libcellml::ModelPtr model;
+    libcellml::AnalyserPtr analyser;
+    libcellml::AnalyserModelPtr analyserModel;
+    std::weak_ptr<CellmlFileRuntimes> runtimes;
+};
+
+constexpr size_t ANALYSED_MODELS_SIZE_LIMIT {32};
+
+std::mutex sAnalysedModelsMutex; // NOLINT
+std::list<CachedAnalysedModel> sAnalysedModels; // NOLINT
+std::unordered_map<std::string_view, std::list<CachedAnalysedModel>::iterator> sAnalysedModelIterators; // NOLINT
+
+void appendToKey(std::string &pKey, std::string_view pValue)
+{
+    // Append the given value to the given key, preceded by its size, so that the boundaries between values cannot be
+    // ambiguous.
+
+    pKey += std::to_string(pValue.size());
+    pKey += ':';
+    pKey += pValue;
+}
+
+void appendToKey(std::string &pKey, std::span<const unsigned char> pValue)
+{
+    appendToKey(pKey, std::string_view {reinterpret_cast<const char *>(pValue.data()), pValue.size()}); // NOLINT
+}
+
+std::optional<AnalysedModel> cachedAnalysedModel(const std::string &pKey)
+{
+    const std::scoped_lock<std::mutex> lock(sAnalysedModelsMutex);
+    const auto it = sAnalysedModelIterators.find(pKey);
+
+    if (it == sAnalysedModelIterators.end()) {
+        return {};
+    }
+
+    // Mark the analysed model as the most recently used one.
+
+    sAnalysedModels.splice(sAnalysedModels.begin(), sAnalysedModels, it->second);
+
+    // Share the compiled runtimes of the analysed model, creating them if no CellML file uses them anymore.
+
+    auto &cachedAnalysedModel {*it->second};
+    auto runtimes {cachedAnalysedModel.runtimes.lock()};
+
+    if (runtimes == nullptr) {
+        runtimes = std::make_shared<CellmlFileRuntimes>();
+
+        cachedAnalysedModel.runtimes = runtimes;
+    }
+
+    return AnalysedModel {cachedAnalysedModel.model, cachedAnalysedModel.analyser, cachedAnalysedModel.analyserModel, runtimes};
+}
+
+void cacheAnalysedModel(std::string &&pKey, const AnalysedModel &pAnalysedModel)
+{
+    const std::scoped_lock<std::mutex> lock(sAnalysedModelsMutex);
+
+    // Another thread may have cached the same analysed model in the meantime, in which case there is nothing to do.
+
+    if (sAnalysedModelIterators.contains(pKey)) {
+        return;
+    }
+
+    sAnalysedModels.push_front({std::move(pKey), pAnalysedModel.model, pAnalysedModel.analyser, pAnalysedModel.analyserModel, pAnalysedModel.runtimes});
+
+    sAnalysedModelIterators[sAnalysedModels.front().key] = sAnalysedModels.begin();
+
+    // Evict the least recently used analysed model, if needed.
+
+    if (sAnalysedModels.size() > ANALYSED_MODELS_SIZE_LIMIT) {
+        sAnalysedModelIterators.erase(sAnalysedModels.back().key);
+        sAnalysedModels.pop_back();
+    }
+}
+
+#ifndef __EMSCRIPTEN__
+Strings importUrls(const libcellml::ModelPtr &pModel, const std::string &pBaseUrl)
+{
+    // Return the URL of all the files imported by the given model, resolving them against the given base URL the same
+    // way that libCellML does, i.e. by replacing everything after the last slash of the base URL.
+
+    Strings res;
+    std::stack<libcellml::ComponentPtr> components;
+    auto baseUrl {pBaseUrl.substr(0, pBaseUrl.find_last_of('/') + 1)};
+    auto addImportUrl = [&res, &baseUrl](const libcellml::ImportedEntityPtr &importedEntity) {
+        if (importedEntity->isImport()) {
+            auto url {baseUrl + importedEntity->importSource()->url()};
+
+            if (std::ranges::find(res, url) == res.end()) {
+                res.push_back(url);
+            }
+        }
+    };
+
+    for (size_t i {0}; i < pModel->unitsCount(); ++i) {
+        addImportUrl(pModel->units(i));
+    }
+
+    for (size_t i {0}; i < pModel->componentCount(); ++i) {
+        components.push(pModel->component(i));
+    }
+
+    while (!components.empty()) {
+        auto component {components.top()};
+
+        components.pop();
+
+        addImportUrl(component);
+
+        for (size_t i {0}; i < component->componentCount(); ++i) {
+            components.push(component->component(i));
+        }
+    }
+
+    return res;
+}
+
+bool addImports(const libcellml::ImporterPtr &pImporter, const libcellml::ModelPtr &pModel,
+                const std::string &pBaseUrl, bool pRemote, bool pStrict, std::string &pKey)
+{
+    // Retrieve (in parallel, if they are remote) all the files imported by the given model, as well as the files that
+    // they import, and so on, and add them to the given importer's library, so that it doesn't have to (and, if they are
+    // remote, can't, since it only deals with local files) retrieve them itself. The URL and raw contents of those
+    // files are also appended to the given key.
+    // Note: a file that cannot be retrieved or parsed is not added to the importer's library, so the importer will
+    //       report it as an issue when resolving imports. In that case, the given key is incomplete and we return
+    //       false.
+
+    auto res {true};
+    std::set<std::string> knownUrls;
+    auto urls {importUrls(pModel, pBaseUrl + "/")};
+
+    while (!urls.empty()) {
+        std::erase_if(urls, [&knownUrls](const auto &url) {
+            return !knownUrls.insert(url).second;
+        });
+
+        std::vector<std::tuple<bool, UnsignedChars>> contents;
+
+        if (pRemote) {
+            contents = downloadFilesContents(urls);
+        } else {
+            for (const auto &url : urls) {
+                auto urlContents {fileContents(stringToPath(url))};
+
+                contents.emplace_back(!urlContents.empty(), std::move(urlContents));
+            }
+        }
+
+        Strings nextUrls;
+
+        for (size_t i {0}; i < urls.size(); ++i) {
+            auto &[urlRes, urlContents] {contents[i]};
+
+            if (!urlRes) {
+                res = false;
+
+                continue;
+            }
+
+            auto parser {libcellml::Parser::create(pStrict)};
+            auto model {parser->parseModel(toString(urlContents))};
+
+            if (parser->errorCount() != 0) {
+                res = false;
+
+                continue;
+            }
+
+            pImporter->addModel(model, urls[i]);
+
+            appendToKey(pKey, urls[i]);
+            appendToKey(pKey, urlContents);
+
+            for (auto &url : importUrls(model, urls[i])) {
+                nextUrls.push_back(std::move(url));
+            }
+        }
+
+        urls = std::move(nextUrls);
+    }
+
+    return res;
+}
+#endif
 
 } // namespace
 
@@ -45,16 +262,76 @@ CellmlFile::Impl::Impl(const FilePtr &pFile, const libcellml::ModelPtr &pModel,
     : mFile(pFile)
     , mModel(pModel)
 {
-    // Resolve imports and flatten the model, if needed and possible.
+    // Start our timer.
+    // Note: the analysis of our model includes the resolution of its imports and its flattening.
+
+    const TraceScope traceScope {"CellmlFile::analyse", "cellml"};
+    auto startTime {std::chrono::high_resolution_clock::now()};
+
+    // Determine the key of our model and, if it has some imports, retrieve them.
+    // Note: we can only cache a model if we could retrieve all of its imports ourselves, since they are part of its key.
+
+    std::string key {pStrict ? "1" : "0"};
+    auto cacheable {true};
+    libcellml::ImporterPtr importer;
+    std::string basePath;
+    size_t importCount {0};
+
+    appendToKey(key, pFile->pimpl()->contentsView());
 
     if (mModel->hasUnresolvedImports()) {
-        auto importer {libcellml::Importer::create(pStrict)};
+        importer = libcellml::Importer::create(pStrict);
+        basePath = pathToString(stringToPath(pFile->path()).parent_path());
+
+#ifdef __EMSCRIPTEN__
+        cacheable = false;
+#else
+        cacheable = addImports(importer, mModel, basePath, !pFile->url().empty(), pStrict, key);
+        importCount = importer->libraryCount();
+#endif
+    }
 
-        if (importer->resolveImports(mModel, pathToString(stringToPath(pFile->path()).parent_path()))) {
-            mModel = importer->flattenModel(mModel);
-        } else {
+    // Check whether we have already analysed a model with the same key and if so then reuse it (and its compiled
+    // runtimes) rather than resolving the imports of our model, flattening it, and analysing it again.
+
+    if (cacheable) {
+        if (auto analysedModel {cachedAnalysedModel(key)}; analysedModel) {
+            mModel = analysedModel->model;
+            mAnalyser = analysedModel->analyser;
+            mAnalyserModel = analysedModel->analyserModel;
+            mRuntimes = analysedModel->runtimes;
+
+            if (mAnalyser->errorCount() != 0) {
+                addIssues(mAnalyser, "Analyser");
+            }
+
+            mAnalysisTime = elapsedTime(startTime);
+
+            return;
+        }
+    }
+
+    // Resolve imports, if needed and possible.
+    // Note: we only cache a model if its imports could all be resolved, so that we never have to replay the importer's
+    //       issues. We also don't cache it if the importer had to retrieve some imports itself (e.g., because it
+    //       resolved their URL differently), since our key would then be incomplete.
+
+    auto importsResolved {true};
+
+    if (importer != nullptr) {
+        importsResolved = importer->resolveImports(mModel, basePath);
+
+        if (!importsResolved) {
             addIssues(importer, "Importer");
         }
+
+        cacheable = cacheable && importsResolved && (importer->libraryCount() == importCount);
+    }
+
+    // Flatten the model, if needed and possible.
+
+    if ((importer != nullptr) && importsResolved) {
+        mModel = importer->flattenModel(mModel);
     }
 
     // Analyse the model.
@@ -69,6 +346,12 @@ CellmlFile::Impl::Impl(const FilePtr &pFile, const libcellml::ModelPtr &pModel,
     if (mAnalyser->errorCount() != 0) {
         addIssues(mAnalyser, "Analyser");
     }
+
+    if (cacheable) {
+        cacheAnalysedModel(std::move(key), {mModel, mAnalyser, mAnalyserModel, mRuntimes});
+    }
+
+    mAnalysisTime = elapsedTime(startTime);
 }
 
 void CellmlFile::Impl::populateDocument(const SedDocumentPtr &pDocument) const
@@ -126,48 +409,106 @@ libcellml::AnalyserModelPtr CellmlFile::Impl::analyserModel() const
     return mAnalyserModel;
 }
 
-CellmlFileRuntimePtr CellmlFile::Impl::runtime(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver)
+const CellmlFileMetadata &CellmlFile::Impl::metadata() const
 {
-    // Check whether we already have a compiled runtime and if so then return it.
+    // Retrieve the names and units of our variables, but only the first time they are needed since they are the same
+    // for all the instance tasks that use us and retrieving them can be costly for a large model.
 
-    {
-        const std::scoped_lock<std::mutex> lock(sRuntimesMutex);
-        const auto it = sRuntimes.find(pCellmlFile.get());
+    std::call_once(mMetadataFlag, [this]() {
+        auto metadata {std::make_unique<CellmlFileMetadata>()};
+
+        if (mAnalyserModel->voi() != nullptr) {
+            const auto &variable {mAnalyserModel->voi()->variable()};
+
+            metadata->voiName = name(variable);
+            metadata->voiUnit = variable->units()->name();
+
+            const auto &states {mAnalyserModel->states()};
 
-        if (it != sRuntimes.end()) {
-            return it->second;
+            metadata->stateNames.reserve(states.size());
+            metadata->stateUnits.reserve(states.size());
+            metadata->rateNames.reserve(states.size());
+            metadata->rateUnits.reserve(states.size());
+
+            for (const auto &state : states) {
+                metadata->stateNames.push_back(name(state->variable()));
+                metadata->stateUnits.push_back(state->variable()->units()->name());
+
+                metadata->rateNames.push_back(metadata->stateNames.back() + "'");
+                metadata->rateUnits.push_back(metadata->stateUnits.back() + "/" + metadata->voiUnit);
+            }
         }
-    }
 
-    // There is no compiled runtime for this CellML file, so create one, track it, and return it.
+        auto addVariables = [](const std::vector<libcellml::AnalyserVariablePtr> &pVariables, Strings &pNames, Strings &pUnits) {
+            pNames.reserve(pVariables.size());
+            pUnits.reserve(pVariables.size());
 
-    auto runtime = CellmlFileRuntime::create(pCellmlFile, pNlaSolver);
+            for (const auto &variable : pVariables) {
+                pNames.push_back(name(variable->variable()));
+                pUnits.push_back(variable->variable()->units()->name());
+            }
+        };
 
-    {
-        const std::scoped_lock<std::mutex> lock(sRuntimesMutex);
+        addVariables(mAnalyserModel->constants(), metadata->constantNames, metadata->constantUnits);
+        addVariables(mAnalyserModel->computedConstants(), metadata->computedConstantNames, metadata->computedConstantUnits);
+        addVariables(mAnalyserModel->algebraicVariables(), metadata->algebraicVariableNames, metadata->algebraicVariableUnits);
 
-        sRuntimes.try_emplace(pCellmlFile.get(), runtime);
-    }
+        mMetadata = std::move(metadata);
+    });
 
-    return runtime;
+    return *mMetadata;
 }
 
-CellmlFile::CellmlFile(const FilePtr &pFile, const libcellml::ModelPtr &pModel, bool pStrict)
-    : Logger(std::make_unique<Impl>(pFile, pModel, pStrict))
+double CellmlFile::Impl::parsingTime() const
 {
+    return mParsingTime;
 }
 
-CellmlFile::~CellmlFile()
+double CellmlFile::Impl::analysisTime() const
 {
-    // Stop tracking our compiled runtime.
+    return mAnalysisTime;
+}
 
-    {
-        const std::scoped_lock<std::mutex> lock(sRuntimesMutex);
+CellmlFileRuntimePtr CellmlFile::Impl::runtime(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver)
+{
+    // Return our compiled runtime, creating it if needed.
+    // Note: our compiled runtimes may be shared with other CellML files (see cachedAnalysedModel()), so we keep them
+    //       locked while creating one, since libCellML's generator is not thread-safe when it comes to generating code
+    //       from the same analyser model and since it means that a runtime never gets compiled more than once.
 
-        sRuntimes.erase(this);
+    auto &runtimes {*pCellmlFile->pimpl()->mRuntimes};
+    const auto lock {lockRuntimes(runtimes)};
+
+    if (runtimes.runtime == nullptr) {
+        runtimes.runtime = CellmlFileRuntime::create(pCellmlFile, pNlaSolver);
     }
+
+    return runtimes.runtime;
 }
 
+CellmlFileRuntimePtr CellmlFile::Impl::ensembleRuntime(const CellmlFilePtr &pCellmlFile, size_t pEnsembleWidth)
+{
+    // Return our compiled ensemble runtime of the given width, creating it if needed (see runtime()).
+    // Note: an ensemble runtime is only possible for an ODE model, so there is no need for an NLA solver.
+
+    auto &runtimes {*pCellmlFile->pimpl()->mRuntimes};
+    const auto lock {lockRuntimes(runtimes)};
+    auto &runtime {runtimes.ensembleRuntimes[pEnsembleWidth]};
+
+    if (runtime == nullptr) {
+        runtime = CellmlFileRuntime::create(pCellmlFile, {}, pEnsembleWidth);
+    }
+
+    return runtime;
+}
+
+CellmlFile::CellmlFile(const FilePtr &pFile, const libcellml::ModelPtr &pModel, bool pStrict)
+    : Logger(std::make_unique<Impl>(pFile, pModel, pStrict))
+{
+}
+
+CellmlFile::~CellmlFile() = default;
+
 CellmlFile::Impl *CellmlFile::pimpl()
 {
     return static_cast<Impl *>(Logger::mPimpl.get());
@@ -197,11 +538,23 @@ CellmlFilePtr CellmlFile::create(const FilePtr &pFile)
 
     // Try to parse the file contents as a CellML file, be it a CellML 1.x or a CellML 2.0 file.
 
+    auto startTime {std::chrono::high_resolution_clock::now()};
     auto parser {libcellml::Parser::create(false)};
-    auto model {parser->parseModel(toString(pFile->contents()))};
+    libcellml::ModelPtr model;
+
+    {
+        const TraceScope traceScope {"CellmlFile::parse", "cellml"};
+
+        model = parser->parseModel(toString(pFile->pimpl()->contentsView()));
+    }
 
     if (parser->errorCount() == 0) {
-        return CellmlFilePtr {new CellmlFile {pFile, model, false}};
+        const auto parsingTime {elapsedTime(startTime)};
+        auto res {CellmlFilePtr {new CellmlFile {pFile, model, false}}};
+
+        res->pimpl()->mParsingTime = parsingTime;
+
+        return res;
     }
 
     return NO_CELLML_FILE_PTR;
@@ -227,9 +580,29 @@ libcellml::AnalyserModelPtr CellmlFile::analyserModel() const
     return pimpl()->analyserModel();
 }
 
+const CellmlFileMetadata &CellmlFile::metadata() const
+{
+    return pimpl()->metadata();
+}
+
+double CellmlFile::parsingTime() const
+{
+    return pimpl()->parsingTime();
+}
+
+double CellmlFile::analysisTime() const
+{
+    return pimpl()->analysisTime();
+}
+
 CellmlFileRuntimePtr CellmlFile::runtime(const SolverNlaPtr &pNlaSolver)
 {
     return CellmlFile::Impl::runtime(shared_from_this(), pNlaSolver);
 }
 
+CellmlFileRuntimePtr CellmlFile::ensembleRuntime(size_t pEnsembleWidth)
+{
+    return CellmlFile::Impl::ensembleRuntime(shared_from_this(), pEnsembleWidth);
+}
+
 } // namespace libOpenCOR
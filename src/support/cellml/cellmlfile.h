@@ -41,6 +41,25 @@ using CellmlFilePtr = std::shared_ptr<CellmlFile>;
 class CellmlFileRuntime;
 using CellmlFileRuntimePtr = std::shared_ptr<CellmlFileRuntime>;
 
+// The names and units of the variables of a CellML file, as reported by an instance task.
+// Note: the names and units of the rates are derived from those of the states and of the variable of integration.
+
+struct CellmlFileMetadata
+{
+    std::string voiName;
+    std::string voiUnit;
+    Strings stateNames;
+    Strings stateUnits;
+    Strings rateNames;
+    Strings rateUnits;
+    Strings constantNames;
+    Strings constantUnits;
+    Strings computedConstantNames;
+    Strings computedConstantUnits;
+    Strings algebraicVariableNames;
+    Strings algebraicVariableUnits;
+};
+
 class LIBOPENCOR_UNIT_TESTING_EXPORT CellmlFile: public Logger
     , public std::enable_shared_from_this<CellmlFile>
 {
@@ -63,7 +82,13 @@ public:
     libcellml::AnalyserPtr analyser() const;
     libcellml::AnalyserModelPtr analyserModel() const;
 
+    const CellmlFileMetadata &metadata() const;
+
+    double parsingTime() const;
+    double analysisTime() const;
+
     CellmlFileRuntimePtr runtime(const SolverNlaPtr &pNlaSolver = {});
+    CellmlFileRuntimePtr ensembleRuntime(size_t pEnsembleWidth);
 
 private:
     class Impl;
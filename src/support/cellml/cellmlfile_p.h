@@ -20,10 +20,25 @@ limitations under the License.
 
 #include "cellmlfile.h"
 
+#include <map>
+#include <mutex>
+
 namespace libOpenCOR {
 
 using FileWeakPtr = std::weak_ptr<File>;
 
+// Compiled runtimes of a CellML file. They are shared by all the CellML files that share the same analyser model, i.e.
+// that have the same contents and imports.
+
+struct CellmlFileRuntimes
+{
+    std::mutex mutex;
+    CellmlFileRuntimePtr runtime;
+    std::map<size_t, CellmlFileRuntimePtr> ensembleRuntimes;
+};
+
+using CellmlFileRuntimesPtr = std::shared_ptr<CellmlFileRuntimes>;
+
 class CellmlFile::Impl: public Logger::Impl
 {
 public:
@@ -31,6 +46,12 @@ public:
     libcellml::ModelPtr mModel;
     libcellml::AnalyserPtr mAnalyser = libcellml::Analyser::create();
     libcellml::AnalyserModelPtr mAnalyserModel;
+    CellmlFileRuntimesPtr mRuntimes = std::make_shared<CellmlFileRuntimes>();
+    double mParsingTime {0.0};
+    double mAnalysisTime {0.0};
+
+    mutable std::once_flag mMetadataFlag;
+    mutable std::unique_ptr<const CellmlFileMetadata> mMetadata;
 
     explicit Impl(const FilePtr &pFile, const libcellml::ModelPtr &pModel, bool pStrict);
 
@@ -40,7 +61,13 @@ public:
     libcellml::AnalyserPtr analyser() const;
     libcellml::AnalyserModelPtr analyserModel() const;
 
+    const CellmlFileMetadata &metadata() const;
+
+    double parsingTime() const;
+    double analysisTime() const;
+
     static CellmlFileRuntimePtr runtime(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver);
+    static CellmlFileRuntimePtr ensembleRuntime(const CellmlFilePtr &pCellmlFile, size_t pEnsembleWidth);
 };
 
 } // namespace libOpenCOR
@@ -18,18 +18,23 @@ limitations under the License.
 #include "solvernla_p.h"
 
 #include "cellmlfile.h"
+#include "tracer.h"
+#include "utils.h"
 
 #include <format>
+#include <optional>
 #include <unordered_set>
 
 namespace libOpenCOR {
 
-CellmlFileRuntime::Impl::Impl(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver)
+CellmlFileRuntime::Impl::Impl(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver, size_t pEnsembleWidth)
 {
 #ifndef __EMSCRIPTEN__
     (void)pNlaSolver;
 #endif
 
+    populateVariableInfos(pCellmlFile->analyserModel());
+
     auto cellmlFileAnalyser {pCellmlFile->analyser()};
 
     if (cellmlFileAnalyser->errorCount() != 0) {
@@ -42,7 +47,14 @@ CellmlFileRuntime::Impl::Impl(const CellmlFilePtr &pCellmlFile, const SolverNlaP
                                 || (cellmlFileType == libcellml::AnalyserModel::Type::DAE)};
 
         // Generate some code for the given CellML file.
+        // Note: we trace each of our phases using the same (optional) trace scope, so that a phase's event gets
+        //       recorded when the next phase starts or when we return.
+
+        std::optional<TraceScope> traceScope;
+
+        traceScope.emplace("CellmlFileRuntime::generateCode", "runtime");
 
+        auto startTime {std::chrono::high_resolution_clock::now()};
         auto generator {libcellml::Generator::create()};
         auto generatorProfile {libcellml::GeneratorProfile::create()};
 
@@ -70,6 +82,51 @@ CellmlFileRuntime::Impl::Impl(const CellmlFilePtr &pCellmlFile, const SolverNlaP
 
         static constexpr auto WITH_EXTERNAL_VARIABLES {false};
 
+        // Generate some ensemble code, if requested, i.e. some code that computes our model for several sets of
+        // parameters at once. In that case, our arrays are structures of arrays, i.e. the value of the i-th variable in
+        // the j-th lane is at index i*W+j, where W is the ensemble width, and each method loops over all the lanes, a
+        // loop that the compiler can vectorise since there is no dependency between lanes.
+        // Note #1: we don't force the vectorisation of that loop (using "#pragma clang loop vectorize(enable)") since
+        //          the compiler would then warn us (and we treat warnings as errors) if it cannot vectorise it, e.g.
+        //          when it calls a mathematical function for which there is no vectorised version.
+        // Note #2: this is only possible for ODE models since the NLA systems of a model cannot be solved in lock step.
+
+        if (pEnsembleWidth != 0) {
+            if (cellmlFileType != libcellml::AnalyserModel::Type::ODE) {
+                addError("An ensemble runtime can only be created for an ODE model.");
+
+                return;
+            }
+
+            mEnsembleWidth = pEnsembleWidth;
+
+            generatorProfile->setOpenArrayString(std::format("[{}*", pEnsembleWidth));
+            generatorProfile->setCloseArrayString("+lane]");
+
+            auto ensembleMethod = [pEnsembleWidth](const std::string &pMethod) {
+                auto res {pMethod};
+                auto codePos {res.find("[CODE]")};
+
+                if (codePos != std::string::npos) {
+                    res.replace(codePos, 6, std::format("    for (int lane = 0; lane < {}; ++lane) {{\n" // NOLINT
+                                                        "[CODE]"
+                                                        "    }}\n",
+                                                        pEnsembleWidth));
+                }
+
+                return res;
+            };
+
+            generatorProfile->setImplementationInitialiseArraysMethodString(differentialModel,
+                                                                            ensembleMethod(generatorProfile->implementationInitialiseArraysMethodString(differentialModel)));
+            generatorProfile->setImplementationComputeComputedConstantsMethodString(differentialModel,
+                                                                                    ensembleMethod(generatorProfile->implementationComputeComputedConstantsMethodString(differentialModel)));
+            generatorProfile->setImplementationComputeRatesMethodString(WITH_EXTERNAL_VARIABLES,
+                                                                        ensembleMethod(generatorProfile->implementationComputeRatesMethodString(WITH_EXTERNAL_VARIABLES)));
+            generatorProfile->setImplementationComputeVariablesMethodString(differentialModel, WITH_EXTERNAL_VARIABLES,
+                                                                            ensembleMethod(generatorProfile->implementationComputeVariablesMethodString(differentialModel, WITH_EXTERNAL_VARIABLES)));
+        }
+
 #ifdef __EMSCRIPTEN__
         // Allocate the memory needed by our objective functions using thread-local static buffers.
 
@@ -190,11 +247,11 @@ extern void nlaSolve(uintptr_t nlaSolverAddress, void (*objectiveFunction)(doubl
 #endif
         }
 
+        auto implementationCode {generator->implementationCode(pCellmlFile->analyserModel(), generatorProfile)};
+
 #ifdef __EMSCRIPTEN__
         // Export our various objective functions.
 
-        auto implementationCode {generator->implementationCode(pCellmlFile->analyserModel(), generatorProfile)};
-
         if (pNlaSolver != nullptr) {
             std::unordered_set<size_t> handledNlaSystemIndices;
             const auto &analyserEquations = pCellmlFile->analyserModel()->analyserEquations();
@@ -218,8 +275,13 @@ extern void nlaSolve(uintptr_t nlaSolverAddress, void (*objectiveFunction)(doubl
         }
 #endif
 
+        mCodeGenerationTime = elapsedTime(startTime);
+
         // Compile the generated code.
 
+        traceScope.emplace("CellmlFileRuntime::compile", "runtime");
+
+        startTime = std::chrono::high_resolution_clock::now();
         mCompiler = Compiler::create();
 
 #ifdef __EMSCRIPTEN__
@@ -230,11 +292,13 @@ extern void nlaSolve(uintptr_t nlaSolverAddress, void (*objectiveFunction)(doubl
 
             return;
         }
+
+        mCompilationTime = elapsedTime(startTime);
 #else
 #    ifdef CODE_COVERAGE_ENABLED
-        mCompiler->compile(generator->implementationCode(pCellmlFile->analyserModel(), generatorProfile));
+        mCompiler->compile(implementationCode, mEnsembleWidth != 0);
 #    else
-        if (!mCompiler->compile(generator->implementationCode(pCellmlFile->analyserModel(), generatorProfile))) {
+        if (!mCompiler->compile(implementationCode, mEnsembleWidth != 0)) {
             // The compilation failed, so add the issues it generated.
 
             addIssues(mCompiler, "Compiler");
@@ -243,6 +307,15 @@ extern void nlaSolve(uintptr_t nlaSolverAddress, void (*objectiveFunction)(doubl
         }
 #    endif
 
+        mCompilationTime = elapsedTime(startTime);
+
+        // Link our compiled code.
+        // Note: our ORC-based JIT only emits and links our compiled code when we retrieve our functions from it.
+
+        traceScope.emplace("CellmlFileRuntime::jitLink", "runtime");
+
+        startTime = std::chrono::high_resolution_clock::now();
+
         // Make sure that our compiler knows about nlaSolve(), if needed.
 
         if ((cellmlFileType == libcellml::AnalyserModel::Type::NLA)
@@ -305,6 +378,8 @@ extern void nlaSolve(uintptr_t nlaSolverAddress, void (*objectiveFunction)(doubl
             }
 #    endif
         }
+
+        mJitLinkingTime = elapsedTime(startTime);
 #endif
     }
 }
@@ -532,8 +607,81 @@ CellmlFileRuntime::ComputeVariablesForDifferentialModel CellmlFileRuntime::Impl:
 }
 #endif
 
-CellmlFileRuntime::CellmlFileRuntime(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver)
-    : Logger(std::make_unique<Impl>(pCellmlFile, pNlaSolver))
+void CellmlFileRuntime::Impl::populateVariableInfos(const libcellml::AnalyserModelPtr &pAnalyserModel)
+{
+    // Map the name of the variable of integration, states, constants, computed constants, and algebraic variables to
+    // their type and index, so that a variable can be looked up in constant time (e.g., when applying some changes).
+    // Note: we use try_emplace() so that, should two variables have the same name, the one that comes first wins.
+
+    auto addVariableInfos = [this](const std::vector<libcellml::AnalyserVariablePtr> &pVariables, VariableType pType) {
+        for (size_t i {0}; i < pVariables.size(); ++i) {
+            mVariableInfos.try_emplace(name(pVariables[i]->variable()), VariableInfo {pType, i});
+        }
+    };
+
+    const auto &states {pAnalyserModel->states()};
+    const auto &constants {pAnalyserModel->constants()};
+    const auto &computedConstants {pAnalyserModel->computedConstants()};
+    const auto &algebraicVariables {pAnalyserModel->algebraicVariables()};
+
+    mVariableInfos.reserve(1 + states.size() + constants.size() + computedConstants.size() + algebraicVariables.size());
+
+    if (pAnalyserModel->voi() != nullptr) {
+        mVariableInfos.try_emplace(name(pAnalyserModel->voi()->variable()), VariableInfo {VariableType::VARIABLE_OF_INTEGRATION, 0});
+    }
+
+    addVariableInfos(states, VariableType::STATE);
+    addVariableInfos(constants, VariableType::CONSTANT);
+    addVariableInfos(computedConstants, VariableType::COMPUTED_CONSTANT);
+    addVariableInfos(algebraicVariables, VariableType::ALGEBRAIC_VARIABLE);
+
+    // Keep track of the states that are initialised using a constant (e.g., x(0) = k).
+    // Note: the generated code initialises such a state in initialiseArrays(), i.e. where the constant itself gets
+    //       initialised, so perturbing the constant and recomputing our computed constants doesn't tell us how the
+    //       initial value of the state depends on that constant.
+
+    mStateInitialisingConstants.resize(states.size());
+
+    for (size_t i {0}; i < states.size(); ++i) {
+        const auto initialisingVariable {states[i]->initialisingVariable()};
+        const auto &initialValue {initialisingVariable->initialValue()};
+
+        if (initialValue.empty() || isDouble(initialValue)) {
+            continue;
+        }
+
+        const auto component {std::dynamic_pointer_cast<libcellml::Component>(initialisingVariable->parent())};
+        const auto variable {(component != nullptr) ? component->variable(initialValue) : nullptr};
+
+        if (variable == nullptr) {
+            continue;
+        }
+
+        for (size_t j {0}; j < constants.size(); ++j) {
+            if (pAnalyserModel->areEquivalentVariables(constants[j]->variable(), variable)) {
+                mStateInitialisingConstants[i] = j;
+
+                break;
+            }
+        }
+    }
+}
+
+const CellmlFileRuntime::VariableInfo *CellmlFileRuntime::Impl::variableInfo(const std::string &pName) const
+{
+    const auto it {mVariableInfos.find(pName)};
+
+    return (it != mVariableInfos.end()) ? &it->second : nullptr;
+}
+
+bool CellmlFileRuntime::Impl::isStateInitialisedByConstant(size_t pStateIndex, size_t pConstantIndex) const
+{
+    return (pStateIndex < mStateInitialisingConstants.size())
+           && (mStateInitialisingConstants[pStateIndex] == pConstantIndex);
+}
+
+CellmlFileRuntime::CellmlFileRuntime(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver, size_t pEnsembleWidth)
+    : Logger(std::make_unique<Impl>(pCellmlFile, pNlaSolver, pEnsembleWidth))
 {
 #ifdef CODE_COVERAGE_ENABLED
     (void)pimpl();
@@ -552,9 +700,40 @@ const CellmlFileRuntime::Impl *CellmlFileRuntime::pimpl() const
     return static_cast<const Impl *>(Logger::mPimpl.get());
 }
 
-CellmlFileRuntimePtr CellmlFileRuntime::create(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver)
+CellmlFileRuntimePtr CellmlFileRuntime::create(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver,
+                                               size_t pEnsembleWidth)
+{
+    return CellmlFileRuntimePtr {new CellmlFileRuntime {pCellmlFile, pNlaSolver, pEnsembleWidth}};
+}
+
+size_t CellmlFileRuntime::ensembleWidth() const
+{
+    return pimpl()->mEnsembleWidth;
+}
+
+double CellmlFileRuntime::codeGenerationTime() const
+{
+    return pimpl()->mCodeGenerationTime;
+}
+
+double CellmlFileRuntime::compilationTime() const
+{
+    return pimpl()->mCompilationTime;
+}
+
+double CellmlFileRuntime::jitLinkingTime() const
+{
+    return pimpl()->mJitLinkingTime;
+}
+
+const CellmlFileRuntime::VariableInfo *CellmlFileRuntime::variableInfo(const std::string &pName) const
+{
+    return pimpl()->variableInfo(pName);
+}
+
+bool CellmlFileRuntime::isStateInitialisedByConstant(size_t pStateIndex, size_t pConstantIndex) const
 {
-    return CellmlFileRuntimePtr {new CellmlFileRuntime {pCellmlFile, pNlaSolver}};
+    return pimpl()->isStateInitialisedByConstant(pStateIndex, pConstantIndex);
 }
 
 #ifdef __EMSCRIPTEN__
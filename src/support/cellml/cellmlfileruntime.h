@@ -19,6 +19,7 @@ limitations under the License.
 #include "libopencor/logger.h"
 
 #include <functional>
+#include <string>
 
 namespace libOpenCOR {
 
@@ -50,7 +51,32 @@ public:
     CellmlFileRuntime &operator=(const CellmlFileRuntime &pRhs) = delete;
     CellmlFileRuntime &operator=(CellmlFileRuntime &&pRhs) noexcept = delete;
 
-    static CellmlFileRuntimePtr create(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver);
+    static CellmlFileRuntimePtr create(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver,
+                                       size_t pEnsembleWidth = 0);
+
+    enum class VariableType
+    {
+        VARIABLE_OF_INTEGRATION,
+        STATE,
+        CONSTANT,
+        COMPUTED_CONSTANT,
+        ALGEBRAIC_VARIABLE
+    };
+
+    struct VariableInfo
+    {
+        VariableType type;
+        size_t index;
+    };
+
+    size_t ensembleWidth() const;
+
+    double codeGenerationTime() const;
+    double compilationTime() const;
+    double jitLinkingTime() const;
+
+    const VariableInfo *variableInfo(const std::string &pName) const;
+    bool isStateInitialisedByConstant(size_t pStateIndex, size_t pConstantIndex) const;
 
 #ifdef __EMSCRIPTEN__
     void initialiseWorkerWasm() const;
@@ -78,7 +104,7 @@ public:
 private:
     class Impl;
 
-    explicit CellmlFileRuntime(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver);
+    explicit CellmlFileRuntime(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver, size_t pEnsembleWidth);
 
     Impl *pimpl();
     const Impl *pimpl() const;
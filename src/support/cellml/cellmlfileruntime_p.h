@@ -21,12 +21,21 @@ limitations under the License.
 #include "compiler.h"
 #include "cellmlfileruntime.h"
 
+#include <optional>
+#include <unordered_map>
+
 namespace libOpenCOR {
 
 class CellmlFileRuntime::Impl: public Logger::Impl
 {
 public:
     CompilerPtr mCompiler {nullptr};
+    size_t mEnsembleWidth {0};
+    double mCodeGenerationTime {0.0};
+    double mCompilationTime {0.0};
+    double mJitLinkingTime {0.0};
+    std::unordered_map<std::string, CellmlFileRuntime::VariableInfo> mVariableInfos;
+    std::vector<std::optional<size_t>> mStateInitialisingConstants;
 #ifdef __EMSCRIPTEN__
     UnsignedChars mWasmModule;
 #endif
@@ -41,7 +50,11 @@ public:
     ComputeVariablesForDifferentialModel mComputeVariablesForDifferentialModel {nullptr};
 #endif
 
-    explicit Impl(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver);
+    explicit Impl(const CellmlFilePtr &pCellmlFile, const SolverNlaPtr &pNlaSolver, size_t pEnsembleWidth);
+
+    void populateVariableInfos(const libcellml::AnalyserModelPtr &pAnalyserModel);
+    const CellmlFileRuntime::VariableInfo *variableInfo(const std::string &pName) const;
+    bool isStateInitialisedByConstant(size_t pStateIndex, size_t pConstantIndex) const;
 #ifdef __EMSCRIPTEN__
     ~Impl() override;
 
@@ -25,24 +25,49 @@ limitations under the License.
 namespace libOpenCOR {
 
 CombineArchive::Impl::Impl(const FilePtr &pFile, libcombine::CombineArchive *pArchive, UnsignedChars &&pArchiveContents)
-    : mArchiveContents(std::move(pArchiveContents))
-    , mArchive(pArchive)
-    , mArchiveLocation(libOpenCOR::pathToString(libOpenCOR::stringToPath(pFile->fileName() + ".contents/")))
+    : mArchiveLocation(libOpenCOR::pathToString(libOpenCOR::stringToPath(pFile->fileName() + ".contents/")))
     , mArchiveLocationSize(mArchiveLocation.size())
 {
-    // Extract all the files contained in the COMBINE archive.
+    // Keep track of our libCOMBINE archive and of the buffer it retains pointers into.
 
-    auto fileCount {static_cast<size_t>(mArchive->getNumEntries())};
+    mArchiveData->contents = std::move(pArchiveContents);
+    mArchiveData->archive.reset(pArchive);
+
+    // Register all the files contained in the COMBINE archive.
+    // Note: the contents of a file is only extracted (and its type only checked) when it is first needed. This means
+    //       that we don't need to decompress and parse files that are never used (e.g., large data files).
+
+    auto fileCount {static_cast<size_t>(pArchive->getNumEntries())};
 
     mFiles.reserve(fileCount);
     mFileNames.reserve(fileCount);
+    mFileIndexes.reserve(fileCount);
 
-    for (int i {0}; i < mArchive->getNumEntries(); ++i) {
-        const auto *entry {mArchive->getEntry(i)};
+    for (int i {0}; i < pArchive->getNumEntries(); ++i) {
+        const auto *entry {pArchive->getEntry(i)};
         auto location {entry->getLocation()};
+#ifdef __EMSCRIPTEN__
         auto file {File::create(mArchiveLocation + location)};
+#else
+        auto file {File::create(mArchiveLocation + location, false)};
+#endif
+
+        file->pimpl()->setContentsExtractor([archiveData = mArchiveData, location]() {
+            // Note: we extract one file at a time since libCOMBINE is not thread safe. Also, we share our libCOMBINE
+            //       archive with our extractor since our file may outlive us.
 
-        file->setContents(mArchive->extractEntryToBuffer(location));
+            const std::scoped_lock lock(archiveData->mutex);
+
+            return archiveData->archive->extractEntryToBuffer(location);
+        });
+
+        // Index our file using its file name without our archive location, which is what file() expects.
+
+        const auto &fileName {file->fileName()};
+
+        if (fileName.starts_with(mArchiveLocation)) {
+            mFileIndexes.emplace(fileName.substr(mArchiveLocationSize), mFiles.size());
+        }
 
         mFiles.push_back(file);
         mFileNames.push_back(location);
@@ -53,11 +78,6 @@ CombineArchive::Impl::Impl(const FilePtr &pFile, libcombine::CombineArchive *pAr
     }
 }
 
-CombineArchive::Impl::~Impl()
-{
-    delete mArchive;
-}
-
 const FilePtr &CombineArchive::Impl::masterFile() const
 {
     return mMasterFile;
@@ -98,13 +118,13 @@ const FilePtr &CombineArchive::Impl::file(const std::string &pFileName) const
 {
     static const FilePtr NO_FILE_PTR;
 
-    for (const auto &file : mFiles) {
-        if (file->fileName() == mArchiveLocation + pFileName) {
-            return file;
-        }
+    auto fileIndex {mFileIndexes.find(pFileName)};
+
+    if (fileIndex == mFileIndexes.end()) {
+        return NO_FILE_PTR;
     }
 
-    return NO_FILE_PTR;
+    return mFiles[fileIndex->second];
 }
 
 CombineArchive::CombineArchive(const FilePtr &pFile, libcombine::CombineArchive *pArchive, UnsignedChars &&pArchiveContents)
@@ -154,18 +174,20 @@ CombineArchivePtr CombineArchive::create(const FilePtr &pFile)
     static const auto LS24 {24U};
     static const auto ZIP_MAGIC_NUMBER {0x04034b50};
 
-    auto fileContents {pFile->contents()};
+    auto contents {pFile->pimpl()->contentsView()};
 
-    if ((fileContents.size() > 4)
-        && (fileContents[0] + (fileContents[1] << LS8) + (fileContents[2] << LS16) + (fileContents[3] << LS24) == ZIP_MAGIC_NUMBER)) {
+    if ((contents.size() > 4)
+        && (contents[0] + (contents[1] << LS8) + (contents[2] << LS16) + (contents[3] << LS24) == ZIP_MAGIC_NUMBER)) {
+        UnsignedChars fileContents {contents.begin(), contents.end()};
         auto *archive {new libcombine::CombineArchive {}};
 
         archive->initializeFromBuffer(fileContents);
 
         return CombineArchivePtr {new CombineArchive {pFile, archive, std::move(fileContents)}};
         // Note: libCOMBINE retains pointers into the supplied buffer, so we must not destroy it until the archive is
-        //       gone hence we keep the original ZIP buffer alive for the lifetime of the archive by moving it into the
-        //       CombineArchive::Impl object.
+        //       gone hence we keep our own copy of the ZIP buffer (rather than a view of the file contents, which may be
+        //       memory mapped and therefore unmapped, e.g., when the contents of the file are set) alive for the
+        //       lifetime of the archive by moving it, along with the archive, into a CombineArchiveData object.
     }
 
     return NO_COMBINE_ARCHIVE_PTR;
@@ -20,21 +20,37 @@ limitations under the License.
 
 #include "combinearchive.h"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 namespace libOpenCOR {
 
+// The libCOMBINE archive of a COMBINE archive, along with the buffer it retains pointers into and the mutex that
+// serialises its use (libCOMBINE is not thread safe). It is shared with the contents extractors of the files of the
+// COMBINE archive, so that they can still extract their contents after the COMBINE archive itself is gone.
+
+struct CombineArchiveData
+{
+    std::mutex mutex;
+    UnsignedChars contents;
+    std::unique_ptr<libcombine::CombineArchive> archive;
+};
+
+using CombineArchiveDataPtr = std::shared_ptr<CombineArchiveData>;
+
 class CombineArchive::Impl: public Logger::Impl
 {
 public:
-    UnsignedChars mArchiveContents;
-    libcombine::CombineArchive *mArchive;
+    CombineArchiveDataPtr mArchiveData = std::make_shared<CombineArchiveData>();
     std::string mArchiveLocation;
     size_t mArchiveLocationSize;
     std::vector<FilePtr> mFiles;
     std::vector<std::string> mFileNames;
+    std::unordered_map<std::string, size_t> mFileIndexes;
     FilePtr mMasterFile;
 
     explicit Impl(const FilePtr &pFile, libcombine::CombineArchive *pArchive, UnsignedChars &&pArchiveContents);
-    ~Impl() override;
 
     const FilePtr &masterFile() const;
     bool hasFiles() const;
@@ -52,13 +52,13 @@ limitations under the License.
 
 namespace libOpenCOR {
 
-SedmlFile::Impl::Impl(const FilePtr &pFile, libsedml::SedDocument *pDocument)
+SedmlFile::Impl::Impl(const FilePtr &pFile, libsedml::SedDocument *pDocument, std::string &&pContents)
     : mLocation(pathToString(stringToPath(pFile->url().empty() ?
                                               pFile->fileName() :
                                               pFile->url())
                                  .parent_path()))
     , mDocument(pDocument)
-    , mContents(toString(pFile->contents()))
+    , mContents(std::move(pContents))
 {
     if (!mLocation.empty()) {
         mLocation += "/";
@@ -377,7 +377,7 @@ void SedmlFile::Impl::populateDocument(const SedDocumentPtr &pDocument)
             warning += source;
             warning += "' could not be found in the file manager. It has been automatically added to it.";
 
-            addWarning(warning);
+            addWarning(std::move(warning));
 
             model = SedModel::create(pDocument, File::create(modelSource));
         }
@@ -437,7 +437,7 @@ void SedmlFile::Impl::populateDocument(const SedDocumentPtr &pDocument)
                     error += targetString;
                     error += "'.";
 
-                    addError(error);
+                    addError(std::move(error));
                 }
 
                 if (!isDouble(newValue)) {
@@ -451,7 +451,7 @@ void SedmlFile::Impl::populateDocument(const SedDocumentPtr &pDocument)
                     error += newValue;
                     error += "' for the change of type 'changeAttribute' is not a valid double value.";
 
-                    addError(error);
+                    addError(std::move(error));
                 }
 
                 if (canAddChange) {
@@ -468,7 +468,7 @@ void SedmlFile::Impl::populateDocument(const SedDocumentPtr &pDocument)
                 warning += changeElementName;
                 warning += "' has been ignored.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
             }
         }
 
@@ -538,7 +538,7 @@ void SedmlFile::Impl::populateDocument(const SedDocumentPtr &pDocument)
                 warning += kisaoId;
                 warning += "' is not recognised. The CVODE solver will be used instead.";
 
-                addWarning(warning);
+                addWarning(std::move(warning));
 
                 odeSolver = SolverCvode::create();
             }
@@ -596,8 +596,8 @@ void SedmlFile::Impl::populateDocument(const SedDocumentPtr &pDocument)
     }
 }
 
-SedmlFile::SedmlFile(const FilePtr &pFile, libsedml::SedDocument *pDocument)
-    : Logger(std::make_unique<Impl>(pFile, pDocument))
+SedmlFile::SedmlFile(const FilePtr &pFile, libsedml::SedDocument *pDocument, std::string &&pContents)
+    : Logger(std::make_unique<Impl>(pFile, pDocument, std::move(pContents)))
 {
 #ifdef CODE_COVERAGE_ENABLED
     (void)static_cast<const SedmlFile *>(this)->pimpl();
@@ -634,8 +634,10 @@ SedmlFilePtr SedmlFile::create(const FilePtr &pFile)
     }
 
     // Try to retrieve a SED-ML document.
+    // Note: libSEDML needs a null-terminated string, so we need a copy of the file contents, which we then keep.
 
-    auto *document {libsedml::readSedMLFromString(toString(pFile->contents()).c_str())};
+    auto contents {toString(pFile->pimpl()->contentsView())};
+    auto *document {libsedml::readSedMLFromString(contents.c_str())};
 
     // A non-SED-ML file results in our SED-ML document having at least one error. That error may be the result of a
     // malformed XML file (e.g., an HTML file is an XML-like file but not actually an XML file or a COMBINE archive
@@ -646,7 +648,7 @@ SedmlFilePtr SedmlFile::create(const FilePtr &pFile)
     if ((document->getNumErrors() == 0)
         || ((document->getError(0)->getErrorId() > libsbml::XMLErrorCodesUpperBound)
             && (document->getError(0)->getErrorId() != libsedml::SedNotSchemaConformant))) {
-        return SedmlFilePtr {new SedmlFile {pFile, document}};
+        return SedmlFilePtr {new SedmlFile {pFile, document, std::move(contents)}};
     }
 
     delete document;
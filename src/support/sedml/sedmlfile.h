@@ -48,7 +48,7 @@ public:
 private:
     class Impl;
 
-    explicit SedmlFile(const FilePtr &pFile, libsedml::SedDocument *pDocument);
+    explicit SedmlFile(const FilePtr &pFile, libsedml::SedDocument *pDocument, std::string &&pContents);
 
     Impl *pimpl();
     const Impl *pimpl() const;
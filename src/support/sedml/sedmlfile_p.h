@@ -40,7 +40,7 @@ public:
     libsedml::SedDocument *mDocument;
     std::string mContents;
 
-    explicit Impl(const FilePtr &pFile, libsedml::SedDocument *pDocument);
+    explicit Impl(const FilePtr &pFile, libsedml::SedDocument *pDocument, std::string &&pContents);
     ~Impl() override;
 
     NlaSolverInfo nlaSolver(const libsedml::SedSimulation *sedSimulation, bool hasNlaSolver) const;
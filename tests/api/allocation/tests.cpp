@@ -0,0 +1,157 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "tests/utils.h"
+
+#include <libopencor>
+
+#include <cstdlib>
+#include <new>
+
+// Note: we replace the global allocation functions so that we can count the number of allocations made by the current
+//       thread while running an instance. This cannot be done on Windows since libOpenCOR, as a DLL, doesn't use the
+//       allocation functions of our test executable.
+
+#ifndef BUILDING_ON_WINDOWS
+namespace {
+
+thread_local bool tCountAllocations {false}; // NOLINT
+thread_local size_t tAllocationCount {0}; // NOLINT
+
+void *allocate(size_t pSize, size_t pAlignment)
+{
+    if (tCountAllocations) {
+        ++tAllocationCount;
+    }
+
+    // Note: the size given to aligned_alloc() must be a non-zero multiple of the alignment.
+
+    pSize = (pSize == 0) ? pAlignment : pSize;
+
+    auto *res {(pAlignment <= alignof(std::max_align_t)) ?
+                   std::malloc(pSize) : // NOLINT
+                   std::aligned_alloc(pAlignment, (pSize + pAlignment - 1) / pAlignment * pAlignment)}; // NOLINT
+
+    if (res == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return res;
+}
+
+size_t runAllocationCount(const libOpenCOR::SedInstancePtr &pInstance)
+{
+    tAllocationCount = 0;
+    tCountAllocations = true;
+
+    pInstance->run();
+
+    tCountAllocations = false;
+
+    return tAllocationCount;
+}
+
+void expectNoAllocationsWhenRerun(const libOpenCOR::SedDocumentPtr &pDocument)
+{
+    auto instance {pDocument->instantiate()};
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    EXPECT_EQ(runAllocationCount(instance), 0U);
+    EXPECT_FALSE(instance->hasIssues());
+}
+
+} // namespace
+
+void *operator new(size_t pSize)
+{
+    return allocate(pSize, alignof(std::max_align_t));
+}
+
+void *operator new(size_t pSize, std::align_val_t pAlignment)
+{
+    return allocate(pSize, static_cast<size_t>(pAlignment));
+}
+
+void operator delete(void *pPointer) noexcept
+{
+    std::free(pPointer); // NOLINT
+}
+
+void operator delete(void *pPointer, size_t /*pSize*/) noexcept
+{
+    std::free(pPointer); // NOLINT
+}
+
+void operator delete(void *pPointer, std::align_val_t /*pAlignment*/) noexcept
+{
+    std::free(pPointer); // NOLINT
+}
+
+void operator delete(void *pPointer, size_t /*pSize*/, std::align_val_t /*pAlignment*/) noexcept
+{
+    std::free(pPointer); // NOLINT
+}
+
+TEST(AllocationTest, cvode)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"))};
+
+    expectNoAllocationsWhenRerun(libOpenCOR::SedDocument::create(file));
+}
+
+TEST(AllocationTest, fixedStepSolvers)
+{
+    static const auto STEP {0.01};
+
+    for (const libOpenCOR::SolverOdeFixedStepPtr &solver : {libOpenCOR::SolverOdeFixedStepPtr(libOpenCOR::SolverForwardEuler::create()),
+                                                            libOpenCOR::SolverOdeFixedStepPtr(libOpenCOR::SolverHeun::create()),
+                                                            libOpenCOR::SolverOdeFixedStepPtr(libOpenCOR::SolverSecondOrderRungeKutta::create()),
+                                                            libOpenCOR::SolverOdeFixedStepPtr(libOpenCOR::SolverFourthOrderRungeKutta::create())}) {
+        auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+        auto document {libOpenCOR::SedDocument::create(file)};
+        const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+
+        solver->setStep(STEP);
+
+        simulation->setOdeSolver(solver);
+
+        expectNoAllocationsWhenRerun(document);
+    }
+}
+
+TEST(AllocationTest, fewerSteps)
+{
+    static const auto NUMBER_OF_STEPS {100};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    // Make sure that our results storage is reused when we are rerun with fewer steps.
+
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    EXPECT_EQ(runAllocationCount(instance), 0U);
+    EXPECT_FALSE(instance->hasIssues());
+    EXPECT_EQ(instance->tasks()[0]->voi().size(), static_cast<size_t>(NUMBER_OF_STEPS) + 1);
+}
+#endif
@@ -20,6 +20,7 @@ limitations under the License.
 
 #include <filesystem>
 #include <libopencor>
+#include <thread>
 
 namespace {
 
@@ -71,6 +72,21 @@ TEST(BasicSedTest, existingRelativeLocalFile)
     std::filesystem::current_path(origDir);
 }
 
+TEST(BasicFileTest, existingLocalFileContents)
+{
+    auto filePath {libOpenCOR::resourcePath("cellml_2.omex")};
+    auto file {libOpenCOR::File::create(filePath)};
+    auto someUnknownContents {libOpenCOR::charArrayToUnsignedChars("Some unknown contents.")};
+
+    EXPECT_EQ(file->type(), libOpenCOR::File::Type::COMBINE_ARCHIVE);
+    EXPECT_EQ(file->contents(), libOpenCOR::fileContents(filePath));
+
+    file->setContents(someUnknownContents);
+
+    EXPECT_EQ(file->type(), libOpenCOR::File::Type::UNKNOWN_FILE);
+    EXPECT_EQ(file->contents(), someUnknownContents);
+}
+
 TEST(BasicFileTest, nonExistingRelativeLocalFile)
 {
 #ifdef BUILDING_ON_WINDOWS
@@ -234,3 +250,81 @@ TEST(BasicFileTest, fileManager)
     EXPECT_EQ(fileManager.file(libOpenCOR::REMOTE_FILE), nullptr);
     EXPECT_EQ(fileManager.file(libOpenCOR::resourcePath("unknown_file.txt")), nullptr);
 }
+
+TEST(BasicFileTest, fileManagerWithSeveralThreads)
+{
+    static constexpr size_t THREAD_COUNT {4};
+    static constexpr size_t FILE_COUNT {250};
+
+    auto &fileManager {libOpenCOR::FileManager::instance()};
+
+    // Have several threads create the same files, so that they can't manage duplicates.
+
+    std::vector<libOpenCOR::FilePtrs> threadFiles(THREAD_COUNT);
+    std::vector<std::thread> threads;
+
+    for (size_t thread {0}; thread < THREAD_COUNT; ++thread) {
+        threads.emplace_back([thread, &threadFiles]() {
+            for (size_t i {0}; i < FILE_COUNT; ++i) {
+                threadFiles[thread].push_back(libOpenCOR::File::create("/some/path/file" + std::to_string(i) + ".txt", false));
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(fileManager.fileCount(), FILE_COUNT);
+    EXPECT_EQ(fileManager.files().size(), FILE_COUNT);
+
+    for (size_t i {0}; i < FILE_COUNT; ++i) {
+        for (size_t thread {1}; thread < THREAD_COUNT; ++thread) {
+            EXPECT_EQ(threadFiles[thread][i], threadFiles[0][i]);
+        }
+
+        EXPECT_EQ(fileManager.file("/some/path/file" + std::to_string(i) + ".txt"), threadFiles[0][i]);
+    }
+
+    // Release our files, which should unmanage them.
+
+    threadFiles.clear();
+
+    EXPECT_FALSE(fileManager.hasFiles());
+    EXPECT_EQ(fileManager.fileCount(), 0U);
+}
+
+TEST(BasicFileTest, fileManagerDownloadCache)
+{
+    static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "The file could not be downloaded."},
+    }};
+    static constexpr size_t DEFAULT_CACHE_SIZE_LIMIT {100 * 1024 * 1024};
+    static constexpr size_t CACHE_SIZE_LIMIT {1024};
+
+    auto &fileManager {libOpenCOR::FileManager::instance()};
+
+    EXPECT_EQ(fileManager.cacheDirectory(), "");
+    EXPECT_EQ(fileManager.cacheSizeLimit(), DEFAULT_CACHE_SIZE_LIMIT);
+    EXPECT_FALSE(fileManager.offline());
+
+    fileManager.setCacheDirectory(libOpenCOR::resourcePath("cache"));
+    fileManager.setCacheSizeLimit(CACHE_SIZE_LIMIT);
+    fileManager.setOffline(true);
+
+    EXPECT_EQ(fileManager.cacheDirectory(), libOpenCOR::resourcePath("cache"));
+    EXPECT_EQ(fileManager.cacheSizeLimit(), CACHE_SIZE_LIMIT);
+    EXPECT_TRUE(fileManager.offline());
+
+    // Being offline with nothing in our download cache means that a remote file cannot be retrieved.
+
+    auto file {libOpenCOR::File::create(libOpenCOR::REMOTE_FILE)};
+
+    EXPECT_EQ(file->type(), libOpenCOR::File::Type::IRRETRIEVABLE_FILE);
+    EXPECT_EQ_ISSUES(file, EXPECTED_ISSUES);
+
+    fileManager.reset();
+    fileManager.setCacheDirectory("");
+    fileManager.setCacheSizeLimit(DEFAULT_CACHE_SIZE_LIMIT);
+    fileManager.setOffline(false);
+}
@@ -72,3 +72,15 @@ TEST(ChildFileTest, dataset157)
 {
     doTestDataset("157", {"fabbri_et_al_based_composite_SAN_model.cellml", "fabbri_et_al_based_composite_SAN_model.sedml"});
 }
+
+TEST(ChildFileTest, childFileOutlivingItsArchive)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/file/dataset_135.omex"))};
+    auto simulationFile {file->childFile("simulation.json")};
+    auto cellmlFile {file->childFile("HumanSAN_Fabbri_Fantini_Wilders_Severi_2017.cellml")};
+
+    file.reset();
+
+    EXPECT_EQ(libOpenCOR::toString(simulationFile->contents()), libOpenCOR::textFileContents(libOpenCOR::resourcePath("api/file/dataset_135.json")));
+    EXPECT_EQ(cellmlFile->type(), libOpenCOR::File::Type::CELLML_FILE);
+}
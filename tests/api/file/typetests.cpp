@@ -162,3 +162,35 @@ TEST(TypeFileTest, combineVirtualArchive)
 
     EXPECT_EQ(file->type(), libOpenCOR::File::Type::COMBINE_ARCHIVE);
 }
+
+TEST(TypeFileTest, cellmlVirtualFileWithProlog)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"), false)};
+
+    file->setContents(libOpenCOR::charArrayToUnsignedChars("\xEF\xBB\xBF<?xml version='1.0' encoding='UTF-8'?>\n"
+                                                           "<!-- A comment with a <model> element. -->\n"
+                                                           "<model name=\"my_model\" xmlns = 'http://www.cellml.org/cellml/2.0#'/>\n"));
+
+    EXPECT_EQ(file->type(), libOpenCOR::File::Type::CELLML_FILE);
+}
+
+TEST(TypeFileTest, xmlVirtualFileWithUnknownNamespace)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"), false)};
+
+    file->setContents(libOpenCOR::charArrayToUnsignedChars("<?xml version='1.0' encoding='UTF-8'?>\n"
+                                                           "<model name=\"my_model\" xmlns=\"http://www.example.org/model\"/>\n"));
+
+    EXPECT_EQ(file->type(), libOpenCOR::File::Type::UNKNOWN_FILE);
+    EXPECT_EQ_ISSUES(file, expectedUnknownFileIssues());
+}
+
+TEST(TypeFileTest, truncatedZipVirtualFile)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.omex"), false)};
+
+    file->setContents(libOpenCOR::charArrayToUnsignedChars("PK\x03\x04"));
+
+    EXPECT_EQ(file->type(), libOpenCOR::File::Type::UNKNOWN_FILE);
+    EXPECT_EQ_ISSUES(file, expectedUnknownFileIssues());
+}
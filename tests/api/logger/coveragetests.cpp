@@ -105,3 +105,28 @@ TEST(CoverageLoggerTest, warning)
     EXPECT_NE(document->warning(0), nullptr);
     EXPECT_EQ(document->warning(document->warningCount()), nullptr);
 }
+
+TEST(CoverageLoggerTest, issuesAfterRun)
+{
+    auto file = libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"));
+    auto document = libOpenCOR::SedDocument::create(file);
+    auto simulation = std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0]);
+    auto solver = libOpenCOR::SolverForwardEuler::create();
+
+    solver->setStep(0.0);
+
+    simulation->setOdeSolver(solver);
+
+    auto instance = document->instantiate();
+
+    // Make sure that running an instance keeps the issues of its tasks and that they are still counted as errors.
+
+    instance->run();
+
+    EXPECT_EQ(instance->issueCount(), 1U);
+    EXPECT_EQ(instance->errorCount(), 1U);
+    EXPECT_EQ(instance->errors().size(), 1U);
+    EXPECT_EQ(instance->error(0), instance->issue(0));
+    EXPECT_EQ(instance->warningCount(), 0U);
+    EXPECT_EQ(instance->error(0)->description(), "Task instance | Forward Euler: the step cannot be equal to 0. It must be greater than 0.");
+}
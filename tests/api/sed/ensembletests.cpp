@@ -0,0 +1,149 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "tests/utils.h"
+
+#include <libopencor>
+
+namespace {
+
+void checkEnsemble(const libOpenCOR::SedDocumentPtr &pDocument, const libOpenCOR::Doubles &pCmValues)
+{
+    static const auto ABS_TOL {1.0e-9};
+
+    // Run an ensemble where each member has its own value for Cm.
+
+    auto ensemble {pDocument->instantiateEnsemble({"membrane/Cm"}, pCmValues)};
+
+    EXPECT_FALSE(ensemble->hasIssues());
+    EXPECT_EQ(ensemble->memberCount(), pCmValues.size());
+    EXPECT_EQ(ensemble->parameterCount(), 1U);
+    EXPECT_EQ(ensemble->parameterName(0), "membrane/Cm");
+    EXPECT_EQ(ensemble->parameterName(1), "");
+
+    ensemble->setThreadCount(2);
+
+    EXPECT_EQ(ensemble->threadCount(), 2U);
+
+    ensemble->run();
+
+    EXPECT_FALSE(ensemble->hasIssues());
+    EXPECT_TRUE(ensemble->state(pCmValues.size(), 0).empty());
+    EXPECT_TRUE(ensemble->state(0, ensemble->stateCount()).empty());
+    EXPECT_TRUE(ensemble->algebraicVariable(0, ensemble->algebraicVariableCount()).empty());
+
+    // Check that each member gives the same results as an instance for which Cm is set using a change attribute.
+
+    const auto &model {pDocument->models()[0]};
+
+    for (size_t member {0}; member < pCmValues.size(); ++member) {
+        model->removeAllChanges();
+        model->addChange(libOpenCOR::SedChangeAttribute::create("membrane", "Cm", std::to_string(pCmValues[member])));
+
+        auto instance {pDocument->instantiate()};
+
+        instance->run();
+
+        EXPECT_FALSE(instance->hasIssues());
+
+        const auto &instanceTask {instance->tasks()[0]};
+
+        EXPECT_EQ(ensemble->voi().size(), instanceTask->voi().size());
+
+        for (size_t i {0}; i < ensemble->stateCount(); ++i) {
+            const auto ensembleState {ensemble->state(member, i)};
+            const auto instanceState {instanceTask->state(i)};
+
+            ASSERT_EQ(ensembleState.size(), instanceState.size());
+
+            for (size_t j {0}; j < ensembleState.size(); ++j) {
+                EXPECT_NEAR(ensembleState[j], instanceState[j], ABS_TOL);
+            }
+        }
+
+        for (size_t i {0}; i < ensemble->algebraicVariableCount(); ++i) {
+            const auto ensembleAlgebraicVariable {ensemble->algebraicVariable(member, i)};
+            const auto instanceAlgebraicVariable {instanceTask->algebraicVariable(i)};
+
+            ASSERT_EQ(ensembleAlgebraicVariable.size(), instanceAlgebraicVariable.size());
+
+            for (size_t j {0}; j < ensembleAlgebraicVariable.size(); ++j) {
+                EXPECT_NEAR(ensembleAlgebraicVariable[j], instanceAlgebraicVariable[j], ABS_TOL);
+            }
+        }
+    }
+
+    model->removeAllChanges();
+}
+
+} // namespace
+
+TEST(EnsembleSedTest, nonOdeModel)
+{
+    static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "An ensemble can only be created for an ODE model that is simulated using a uniform time course."},
+    }};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/sed/nla.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto ensemble {document->instantiateEnsemble({"x"}, {1.0})};
+
+    EXPECT_EQ_ISSUES(ensemble, EXPECTED_ISSUES);
+    EXPECT_EQ(ensemble->run(), 0.0);
+    EXPECT_EQ_ISSUES(ensemble, EXPECTED_ISSUES);
+}
+
+TEST(EnsembleSedTest, invalidParameters)
+{
+    static const libOpenCOR::ExpectedIssues UNKNOWN_PARAMETER_EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "The parameter 'membrane/unknown' is neither a state nor a constant."},
+    }};
+    static const libOpenCOR::ExpectedIssues INVALID_PARAMETER_VALUES_EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "The number of parameter values (3) must be a non-zero multiple of the number of parameters (2)."},
+    }};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+
+    EXPECT_EQ_ISSUES(document->instantiateEnsemble({"membrane/unknown"}, {1.0}), UNKNOWN_PARAMETER_EXPECTED_ISSUES);
+    EXPECT_EQ_ISSUES(document->instantiateEnsemble({"membrane/V", "membrane/Cm"}, {0.0, 1.0, 0.0}), INVALID_PARAMETER_VALUES_EXPECTED_ISSUES);
+}
+
+TEST(EnsembleSedTest, cvode)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+
+    checkEnsemble(document, {0.75, 1.0, 1.25});
+}
+
+TEST(EnsembleSedTest, forwardEuler)
+{
+    static const auto STEP {0.0123};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto solver {libOpenCOR::SolverForwardEuler::create()};
+
+    solver->setStep(STEP);
+
+    document->simulations()[0]->setOdeSolver(solver);
+
+    // Note: we use more members than there are lanes in a block and a number of members that is not a multiple of that
+    //       number of lanes, so that we have several blocks, including a partially filled one.
+
+    checkEnsemble(document, {0.5, 0.625, 0.75, 0.875, 1.0, 1.125, 1.25, 1.375, 1.5, 1.625, 1.75});
+}
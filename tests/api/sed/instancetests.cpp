@@ -348,6 +348,62 @@ TEST(InstanceSedTest, pauseRunAndResumeRun)
     EXPECT_FALSE(instance->hasIssues());
 }
 
+TEST(InstanceSedTest, pauseRunFreezesProgress)
+{
+    static const auto SIMULATION_PROPERTY {1000000};
+    static const auto WAIT_ITERATIONS = 60000;
+    static const auto PAUSE_SLEEP = 50;
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+
+    simulation->setNumberOfSteps(SIMULATION_PROPERTY);
+    simulation->setOutputEndTime(static_cast<double>(SIMULATION_PROPERTY));
+
+    auto instance {document->instantiate()};
+
+    EXPECT_TRUE(instance->startRun());
+
+    for (size_t i {0}; i < WAIT_ITERATIONS; ++i) {
+        if (instance->progress() > 0.0) {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Make sure that a pause is honoured within a bounded number of steps and that the progress that was published
+    // when pausing doesn't change while paused.
+
+    instance->pauseRun();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(PAUSE_SLEEP));
+
+    const auto pausedProgress {instance->progress()};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(PAUSE_SLEEP));
+
+    EXPECT_EQ(instance->status(), libOpenCOR::SedInstance::Status::PAUSED);
+    EXPECT_GT(pausedProgress, 0.0);
+    EXPECT_LT(pausedProgress, 1.0);
+    EXPECT_DOUBLE_EQ(instance->progress(), pausedProgress);
+
+    instance->stopRun();
+
+    for (size_t i {0}; i < WAIT_ITERATIONS; ++i) {
+        if (instance->status() == libOpenCOR::SedInstance::Status::IDLE) {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(instance->status(), libOpenCOR::SedInstance::Status::IDLE);
+    EXPECT_DOUBLE_EQ(instance->progress(), pausedProgress);
+    EXPECT_FALSE(instance->hasIssues());
+}
+
 TEST(InstanceSedTest, pauseRunAndResumeRunWhenNotRunning)
 {
     auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"))};
@@ -627,6 +683,57 @@ TEST(InstanceSedTest, nlaModelWithNoNlaSolver)
     EXPECT_EQ_ISSUES(instance, EXPECTED_ISSUES);
 }
 
+TEST(InstanceSedTest, odeModelSteadyState)
+{
+    static const auto RATE_ABS_TOL {1.0e-6};
+    static const auto STATE_ABS_TOL {1.0e-3};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto steadyState {libOpenCOR::SedSteadyState::create(document)};
+    auto task {std::dynamic_pointer_cast<libOpenCOR::SedTask>(document->tasks()[0])};
+    auto uniformTimeCourse {task->simulation()};
+
+    steadyState->setOdeSolver(libOpenCOR::SolverCvode::create());
+
+    document->addSimulation(steadyState);
+
+    task->setSimulation(steadyState);
+
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    // Check that we have a single set of results and that all the rates are zero.
+
+    const auto &instanceTask {instance->tasks()[0]};
+
+    EXPECT_EQ(instanceTask->voi().size(), 1U);
+
+    for (size_t i {0}; i < instanceTask->rateCount(); ++i) {
+        ASSERT_EQ(instanceTask->rate(i).size(), 1U);
+        EXPECT_NEAR(instanceTask->rate(i)[0], 0.0, RATE_ABS_TOL);
+    }
+
+    // Check that we get the same states as at the end of a long time course simulation.
+
+    task->setSimulation(uniformTimeCourse);
+
+    auto otherInstance {document->instantiate()};
+
+    otherInstance->run();
+
+    EXPECT_FALSE(otherInstance->hasIssues());
+
+    const auto &otherInstanceTask {otherInstance->tasks()[0]};
+
+    for (size_t i {0}; i < instanceTask->stateCount(); ++i) {
+        EXPECT_NEAR(instanceTask->state(i)[0], otherInstanceTask->state(i).back(), STATE_ABS_TOL);
+    }
+}
+
 TEST(InstanceSedTest, daeModel)
 {
     static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
@@ -857,3 +964,596 @@ TEST(InstanceSedTest, simulationWithInitialTimeFailing)
 
     EXPECT_TRUE(instance->hasIssues());
 }
+
+TEST(InstanceSedTest, changeAttributeWithUpdatedValue)
+{
+    static const auto CM {0.75};
+    static const auto OTHER_CM {1.25};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto changeAttribute {libOpenCOR::SedChangeAttribute::create("membrane", "Cm", std::to_string(CM))};
+
+    document->models()[0]->addChange(changeAttribute);
+
+    // Check that the value of our change attribute is used and that updating it is reflected in a new instance.
+
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+    EXPECT_EQ(instance->tasks()[0]->constantName(0), "membrane/Cm");
+    EXPECT_EQ(instance->tasks()[0]->constant(0)[0], CM);
+
+    changeAttribute->setNewValue(std::to_string(OTHER_CM));
+
+    instance = document->instantiate();
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+    EXPECT_EQ(instance->tasks()[0]->constant(0)[0], OTHER_CM);
+}
+
+TEST(InstanceSedTest, setInitialStatesAndConstants)
+{
+    static const auto ABS_TOL {1.0e-9};
+    static const auto V {-80.0};
+    static const auto CM {1.25};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto instance {document->instantiate()};
+    const auto &instanceTask {instance->tasks()[0]};
+
+    EXPECT_FALSE(instanceTask->setInitialState(instanceTask->stateCount(), V));
+    EXPECT_FALSE(instanceTask->setConstant(instanceTask->constantCount(), CM));
+    EXPECT_FALSE(instanceTask->resetInitialStatesAndConstants());
+
+    // Set the initial value of membrane/V and the value of membrane/Cm, and run our instance several times.
+
+    EXPECT_TRUE(instanceTask->setInitialState(0, V));
+    EXPECT_TRUE(instanceTask->setConstant(0, CM));
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+    EXPECT_EQ(instanceTask->state(0)[0], V);
+    EXPECT_EQ(instanceTask->constant(0)[0], CM);
+
+    const libOpenCOR::Doubles states {instanceTask->state(0).begin(), instanceTask->state(0).end()};
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+    ASSERT_EQ(instanceTask->state(0).size(), states.size());
+
+    for (size_t i {0}; i < states.size(); ++i) {
+        EXPECT_NEAR(instanceTask->state(0)[i], states[i], ABS_TOL);
+    }
+
+    // Check that we get the same results as with some change attributes.
+
+    const auto &model {document->models()[0]};
+
+    model->addChange(libOpenCOR::SedChangeAttribute::create("membrane", "V", std::to_string(V)));
+    model->addChange(libOpenCOR::SedChangeAttribute::create("membrane", "Cm", std::to_string(CM)));
+
+    auto otherInstance {document->instantiate()};
+
+    otherInstance->run();
+
+    const auto &otherInstanceTask {otherInstance->tasks()[0]};
+
+    ASSERT_EQ(otherInstanceTask->state(0).size(), states.size());
+
+    for (size_t i {0}; i < states.size(); ++i) {
+        EXPECT_NEAR(otherInstanceTask->state(0)[i], states[i], ABS_TOL);
+    }
+
+    // Reset our initial values and constants and check that we are back to the default values.
+
+    model->removeAllChanges();
+
+    EXPECT_TRUE(instanceTask->resetInitialStatesAndConstants());
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+    EXPECT_NE(instanceTask->state(0)[0], V);
+    EXPECT_NE(instanceTask->constant(0)[0], CM);
+}
+
+TEST(InstanceSedTest, continueRun)
+{
+    static const auto ABS_TOL {1.0e-6};
+    static const auto STEP {0.01};
+    static const auto END_TIME {10.0};
+    static const auto NUMBER_OF_STEPS {100};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    auto solver {libOpenCOR::SolverForwardEuler::create()};
+
+    solver->setStep(STEP);
+
+    simulation->setOdeSolver(solver);
+    simulation->setOutputEndTime(END_TIME);
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    // Run our simulation and then continue it.
+
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    instance->continueRun(2.0 * END_TIME, NUMBER_OF_STEPS);
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    const auto &instanceTask {instance->tasks()[0]};
+
+    EXPECT_EQ(instanceTask->voi().size(), static_cast<size_t>(NUMBER_OF_STEPS + 1));
+    EXPECT_NEAR(instanceTask->voi().front(), END_TIME, ABS_TOL);
+    EXPECT_NEAR(instanceTask->voi().back(), 2.0 * END_TIME, ABS_TOL);
+
+    // Check that we get the same results as with a simulation that goes straight to the end.
+
+    simulation->setOutputEndTime(2.0 * END_TIME);
+    simulation->setNumberOfSteps(2 * NUMBER_OF_STEPS);
+
+    auto otherInstance {document->instantiate()};
+
+    otherInstance->run();
+
+    EXPECT_FALSE(otherInstance->hasIssues());
+
+    const auto &otherInstanceTask {otherInstance->tasks()[0]};
+
+    for (size_t i {0}; i < instanceTask->stateCount(); ++i) {
+        for (size_t j {0}; j <= static_cast<size_t>(NUMBER_OF_STEPS); ++j) {
+            EXPECT_NEAR(instanceTask->state(i)[j], otherInstanceTask->state(i)[j + NUMBER_OF_STEPS], ABS_TOL);
+        }
+    }
+}
+
+TEST(InstanceSedTest, continueRunWithInvalidArguments)
+{
+    static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "Task | The end time (0) must be greater than the current time (0)."},
+    }};
+    static const libOpenCOR::ExpectedIssues OTHER_EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "Task | The number of steps (0) must be greater than 0."},
+    }};
+    static const libOpenCOR::ExpectedIssues ALGEBRAIC_EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "Task | Only a differential model simulated using a uniform time course can be continued."},
+    }};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto instance {document->instantiate()};
+
+    EXPECT_EQ(instance->continueRun(0.0, 1), 0.0);
+    EXPECT_EQ_ISSUES(instance, EXPECTED_ISSUES);
+    EXPECT_EQ(instance->continueRun(1.0, 0), 0.0);
+    EXPECT_EQ_ISSUES(instance, OTHER_EXPECTED_ISSUES);
+
+    auto algebraicFile {libOpenCOR::File::create(libOpenCOR::resourcePath("api/sed/nla.cellml"))};
+    auto algebraicDocument {libOpenCOR::SedDocument::create(algebraicFile)};
+    auto algebraicInstance {algebraicDocument->instantiate()};
+
+    EXPECT_EQ(algebraicInstance->continueRun(1.0, 1), 0.0);
+    EXPECT_EQ_ISSUES(algebraicInstance, ALGEBRAIC_EXPECTED_ISSUES);
+}
+
+TEST(InstanceSedTest, checkpointAndRestore)
+{
+    static const auto STEP {0.001};
+    static const auto END_TIME {1000.0};
+    static const auto NUMBER_OF_STEPS {100000};
+    static const auto CHECKPOINT_INTERVAL {10};
+    static const auto WAIT_ITERATIONS = 60000;
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    auto solver {libOpenCOR::SolverForwardEuler::create()};
+
+    solver->setStep(STEP);
+
+    simulation->setOdeSolver(solver);
+    simulation->setOutputEndTime(END_TIME);
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    // Run our simulation in the background, taking a checkpoint every few steps, and stop it as soon as we have got a
+    // checkpoint.
+
+    auto instance {document->instantiate()};
+    const auto &instanceTask {instance->tasks()[0]};
+
+    instanceTask->setCheckpointInterval(CHECKPOINT_INTERVAL);
+
+    EXPECT_EQ(instanceTask->checkpointInterval(), static_cast<size_t>(CHECKPOINT_INTERVAL));
+    EXPECT_TRUE(instance->startRun());
+
+    libOpenCOR::UnsignedChars checkpoint;
+
+    for (size_t i {0}; i < WAIT_ITERATIONS; ++i) {
+        checkpoint = instance->checkpoint();
+
+        if (!checkpoint.empty()) {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    instance->stopRun();
+    instance->waitForRun();
+
+    EXPECT_FALSE(checkpoint.empty());
+
+    // Restore a new instance from our checkpoint and check that resuming it gives exactly the same results as a
+    // simulation that goes straight to the end.
+
+    auto restoredInstance {document->instantiate()};
+
+    EXPECT_TRUE(restoredInstance->restore(checkpoint));
+
+    restoredInstance->run();
+
+    EXPECT_FALSE(restoredInstance->hasIssues());
+    EXPECT_EQ(restoredInstance->progress(), 1.0);
+
+    auto otherInstance {document->instantiate()};
+
+    otherInstance->run();
+
+    EXPECT_FALSE(otherInstance->hasIssues());
+
+    const auto &restoredInstanceTask {restoredInstance->tasks()[0]};
+    const auto &otherInstanceTask {otherInstance->tasks()[0]};
+
+    ASSERT_EQ(restoredInstanceTask->voi().size(), otherInstanceTask->voi().size());
+
+    for (size_t i {0}; i < restoredInstanceTask->voi().size(); ++i) {
+        EXPECT_EQ(restoredInstanceTask->voi()[i], otherInstanceTask->voi()[i]);
+    }
+
+    for (size_t i {0}; i < restoredInstanceTask->stateCount(); ++i) {
+        for (size_t j {0}; j < restoredInstanceTask->voi().size(); ++j) {
+            EXPECT_EQ(restoredInstanceTask->state(i)[j], otherInstanceTask->state(i)[j]);
+        }
+    }
+
+    // Check that the checkpoint of a task that has completed its simulation can be restored and its simulation
+    // continued as if it had never been checkpointed.
+
+    auto completedInstance {document->instantiate()};
+
+    EXPECT_TRUE(completedInstance->restore(otherInstance->checkpoint()));
+
+    completedInstance->continueRun(2.0 * END_TIME, NUMBER_OF_STEPS);
+    otherInstance->continueRun(2.0 * END_TIME, NUMBER_OF_STEPS);
+
+    EXPECT_FALSE(completedInstance->hasIssues());
+    EXPECT_FALSE(otherInstance->hasIssues());
+
+    const auto &completedInstanceTask {completedInstance->tasks()[0]};
+
+    for (size_t i {0}; i < completedInstanceTask->stateCount(); ++i) {
+        for (size_t j {0}; j < completedInstanceTask->voi().size(); ++j) {
+            EXPECT_EQ(completedInstanceTask->state(i)[j], otherInstanceTask->state(i)[j]);
+        }
+    }
+}
+
+TEST(InstanceSedTest, checkpointEarlyInSecondRun)
+{
+    static const auto STEP {0.001};
+    static const auto END_TIME {1000.0};
+    static const auto NUMBER_OF_STEPS {100000};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    auto solver {libOpenCOR::SolverForwardEuler::create()};
+
+    solver->setStep(STEP);
+
+    simulation->setOdeSolver(solver);
+    simulation->setOutputEndTime(END_TIME);
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    // Run our simulation once, taking a checkpoint only at its very last step.
+
+    auto instance {document->instantiate()};
+    const auto &instanceTask {instance->tasks()[0]};
+
+    instanceTask->setCheckpointInterval(NUMBER_OF_STEPS);
+
+    instance->run();
+
+    EXPECT_FALSE(instanceTask->checkpoint().empty());
+
+    // Run our simulation again, in the background, and check that, early in that run, there is no checkpoint rather
+    // than the one taken at the end of our previous run.
+
+    EXPECT_TRUE(instance->startRun());
+
+    const auto checkpoint {instanceTask->checkpoint()};
+
+    instance->stopRun();
+    instance->waitForRun();
+
+    EXPECT_TRUE(checkpoint.empty());
+}
+
+TEST(InstanceSedTest, restoreWithOtherNumberOfSteps)
+{
+    static const auto STEP {0.001};
+    static const auto OUTPUT_START_TIME {1000.0};
+    static const auto OUTPUT_END_TIME {1001.0};
+    static const auto NUMBER_OF_STEPS {1000};
+    static const auto OTHER_NUMBER_OF_STEPS {10};
+    static const auto CHECKPOINT_INTERVAL {10};
+    static const auto WAIT_ITERATIONS = 60000;
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    auto solver {libOpenCOR::SolverForwardEuler::create()};
+
+    solver->setStep(STEP);
+
+    simulation->setOdeSolver(solver);
+    simulation->setOutputStartTime(OUTPUT_START_TIME);
+    simulation->setOutputEndTime(OUTPUT_END_TIME);
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    // Run our simulation in the background and get a checkpoint from before the output start time.
+
+    auto instance {document->instantiate()};
+
+    instance->tasks()[0]->setCheckpointInterval(CHECKPOINT_INTERVAL);
+
+    EXPECT_TRUE(instance->startRun());
+
+    libOpenCOR::UnsignedChars checkpoint;
+
+    for (size_t i {0}; i < WAIT_ITERATIONS; ++i) {
+        checkpoint = instance->checkpoint();
+
+        if (!checkpoint.empty()) {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    instance->stopRun();
+    instance->waitForRun();
+
+    EXPECT_FALSE(checkpoint.empty());
+
+    // Our checkpoint cannot be restored once our number of steps has changed, but it can be restored (and its
+    // simulation resumed) once our number of steps is back to what it was.
+
+    simulation->setNumberOfSteps(OTHER_NUMBER_OF_STEPS);
+
+    EXPECT_FALSE(document->instantiate()->restore(checkpoint));
+
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    auto restoredInstance {document->instantiate()};
+
+    EXPECT_TRUE(restoredInstance->restore(checkpoint));
+
+    restoredInstance->run();
+
+    EXPECT_FALSE(restoredInstance->hasIssues());
+    EXPECT_EQ(restoredInstance->tasks()[0]->voi().size(), static_cast<size_t>(NUMBER_OF_STEPS + 1));
+}
+
+TEST(InstanceSedTest, restoreWithInvalidCheckpoint)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto instance {document->instantiate()};
+    const auto &instanceTask {instance->tasks()[0]};
+
+    auto checkpoint {instanceTask->checkpoint()};
+
+    EXPECT_FALSE(checkpoint.empty());
+    EXPECT_TRUE(instanceTask->restore(checkpoint));
+
+    // A truncated or corrupted checkpoint cannot be restored.
+
+    EXPECT_FALSE(instanceTask->restore({}));
+    EXPECT_FALSE(instanceTask->restore(libOpenCOR::UnsignedChars(checkpoint.begin(), checkpoint.end() - 1)));
+
+    checkpoint[0] = 'X';
+
+    EXPECT_FALSE(instanceTask->restore(checkpoint));
+    EXPECT_FALSE(instance->restore(checkpoint));
+
+    // Neither can the checkpoint of a task for another model.
+
+    auto otherFile {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"))};
+    auto otherDocument {libOpenCOR::SedDocument::create(otherFile)};
+    auto otherInstance {otherDocument->instantiate()};
+
+    EXPECT_FALSE(instance->restore(otherInstance->checkpoint()));
+
+    // An algebraic model cannot be checkpointed.
+
+    auto algebraicFile {libOpenCOR::File::create(libOpenCOR::resourcePath("api/sed/nla.cellml"))};
+    auto algebraicDocument {libOpenCOR::SedDocument::create(algebraicFile)};
+    auto algebraicInstance {algebraicDocument->instantiate()};
+
+    EXPECT_TRUE(algebraicInstance->checkpoint().empty());
+    EXPECT_TRUE(algebraicInstance->tasks()[0]->checkpoint().empty());
+    EXPECT_FALSE(algebraicInstance->tasks()[0]->restore(instanceTask->checkpoint()));
+}
+
+TEST(InstanceSedTest, restoreIsAllOrNothing)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+
+    document->addTask(libOpenCOR::SedTask::create(document, document->models()[0], document->simulations()[0]));
+
+    auto instance {document->instantiate()};
+
+    ASSERT_EQ(instance->taskCount(), 2U);
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    // Corrupt the checkpoint of our second task and check that none of the tasks of another instance gets restored.
+
+    auto checkpoint {instance->checkpoint()};
+    auto corruptedCheckpoint {checkpoint};
+    const auto firstTaskCheckpointSize {instance->tasks()[0]->checkpoint().size()};
+
+    corruptedCheckpoint[sizeof(uint64_t) + sizeof(uint64_t) + firstTaskCheckpointSize + sizeof(uint64_t)] = 'X';
+
+    auto otherInstance {document->instantiate()};
+    const auto &otherInstanceTask {otherInstance->tasks()[0]};
+    const auto voiSize {otherInstanceTask->voi().size()};
+
+    EXPECT_NE(voiSize, instance->tasks()[0]->voi().size());
+    EXPECT_FALSE(otherInstance->restore(corruptedCheckpoint));
+    EXPECT_EQ(otherInstanceTask->voi().size(), voiSize);
+
+    // Check that the uncorrupted checkpoint restores all of our tasks.
+
+    EXPECT_TRUE(otherInstance->restore(checkpoint));
+
+    for (size_t i {0}; i < instance->taskCount(); ++i) {
+        EXPECT_EQ(otherInstance->tasks()[i]->voi().size(), instance->tasks()[i]->voi().size());
+    }
+}
+
+TEST(InstanceSedTest, instrumentation)
+{
+    static const auto END_TIME {10.0};
+    static const auto NUMBER_OF_STEPS {100};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+
+    simulation->setOutputEndTime(END_TIME);
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    auto instance {document->instantiate()};
+    const auto &instanceTask {instance->tasks()[0]};
+
+    // By default, a task is not instrumented, so only the phases of its model are timed.
+
+    EXPECT_FALSE(instanceTask->instrumented());
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+    EXPECT_GT(instanceTask->phaseTime(libOpenCOR::SedInstanceTask::Phase::COMPILATION), 0.0);
+    EXPECT_EQ(instanceTask->phaseTime(libOpenCOR::SedInstanceTask::Phase::ODE_SOLVING), 0.0);
+    EXPECT_EQ(instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::ODE_STEP_COUNT), 0);
+
+    // Instrument the task and check that the phases of its run are timed and that the statistics of CVODE are tracked.
+
+    instanceTask->setInstrumented(true);
+
+    EXPECT_TRUE(instanceTask->instrumented());
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+    EXPECT_GT(instanceTask->phaseTime(libOpenCOR::SedInstanceTask::Phase::ODE_SOLVING), 0.0);
+    EXPECT_GT(instanceTask->phaseTime(libOpenCOR::SedInstanceTask::Phase::RESULT_RECORDING), 0.0);
+    EXPECT_EQ(instanceTask->phaseTime(libOpenCOR::SedInstanceTask::Phase::NLA_SOLVING), 0.0);
+
+    const auto odeStepCount {instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::ODE_STEP_COUNT)};
+
+    EXPECT_GT(odeStepCount, 0);
+    EXPECT_GE(instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::RHS_EVALUATION_COUNT), odeStepCount);
+    EXPECT_LE(instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::JACOBIAN_EVALUATION_COUNT),
+              instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::LINEAR_SOLVER_SETUP_COUNT));
+    EXPECT_EQ(instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::NLA_SOLVE_COUNT), 0);
+    EXPECT_EQ(instanceTask->nlaSystemCount(), 0);
+    EXPECT_EQ(instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::RESULT_BYTE_COUNT),
+              (1 + 2 * instanceTask->stateCount() + instanceTask->constantCount() + instanceTask->computedConstantCount() + instanceTask->algebraicVariableCount())
+                  * (NUMBER_OF_STEPS + 1) * sizeof(double));
+
+    // The statistics of a continued run are only those of the continued run.
+
+    instance->continueRun(2.0 * END_TIME, NUMBER_OF_STEPS);
+
+    EXPECT_FALSE(instance->hasIssues());
+    EXPECT_GT(instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::ODE_STEP_COUNT), 0);
+
+    // No longer instrument the task.
+
+    instanceTask->setInstrumented(false);
+
+    instance->run();
+
+    EXPECT_EQ(instanceTask->phaseTime(libOpenCOR::SedInstanceTask::Phase::ODE_SOLVING), 0.0);
+    EXPECT_EQ(instanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::RESULT_BYTE_COUNT), 0);
+
+    // Check the statistics of KINSOL using a DAE model.
+
+    auto daeFile {libOpenCOR::File::create(libOpenCOR::resourcePath("api/sed/dae.cellml"))};
+    auto daeDocument {libOpenCOR::SedDocument::create(daeFile)};
+    auto daeInstance {daeDocument->instantiate()};
+    const auto &daeInstanceTask {daeInstance->tasks()[0]};
+
+    daeInstanceTask->setInstrumented(true);
+
+    daeInstance->run();
+
+    EXPECT_FALSE(daeInstance->hasIssues());
+    EXPECT_GT(daeInstanceTask->phaseTime(libOpenCOR::SedInstanceTask::Phase::NLA_SOLVING), 0.0);
+    EXPECT_GT(daeInstanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::NLA_ITERATION_COUNT), 0);
+    EXPECT_GT(daeInstanceTask->nlaSystemCount(), 0);
+
+    size_t nlaSolveCount {0};
+
+    for (size_t i {0}; i < daeInstanceTask->nlaSystemCount(); ++i) {
+        EXPECT_GT(daeInstanceTask->nlaSystemSolveCount(i), 0);
+
+        nlaSolveCount += daeInstanceTask->nlaSystemSolveCount(i);
+    }
+
+    EXPECT_EQ(daeInstanceTask->statistic(libOpenCOR::SedInstanceTask::Statistic::NLA_SOLVE_COUNT), nlaSolveCount);
+    EXPECT_EQ(daeInstanceTask->nlaSystemSolveCount(daeInstanceTask->nlaSystemCount()), 0);
+}
+
+TEST(InstanceSedTest, sharedNamesAndUnits)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto instance {document->instantiate()};
+    auto otherInstance {document->instantiate()};
+    const auto &instanceTask {instance->tasks()[0]};
+    const auto &otherInstanceTask {otherInstance->tasks()[0]};
+
+    // The names and units of the variables of a model are the same for all the instances of that model, so make sure
+    // that they are shared rather than duplicated.
+
+    EXPECT_EQ(instanceTask->voiName(), "environment/time");
+    EXPECT_EQ(instanceTask->rateName(0), instanceTask->stateName(0) + "'");
+    EXPECT_EQ(instanceTask->rateUnit(0), instanceTask->stateUnit(0) + "/" + instanceTask->voiUnit());
+    EXPECT_EQ(&instanceTask->voiName(), &otherInstanceTask->voiName());
+    EXPECT_EQ(&instanceTask->stateName(0), &otherInstanceTask->stateName(0));
+    EXPECT_EQ(&instanceTask->rateUnit(0), &otherInstanceTask->rateUnit(0));
+    EXPECT_EQ(&instanceTask->constantName(0), &otherInstanceTask->constantName(0));
+    EXPECT_EQ(&instanceTask->computedConstantUnit(0), &otherInstanceTask->computedConstantUnit(0));
+    EXPECT_EQ(&instanceTask->algebraicVariableName(0), &otherInstanceTask->algebraicVariableName(0));
+}
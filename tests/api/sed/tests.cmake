@@ -21,6 +21,7 @@ set(${TEST}_SOURCE_FILES
     ${CMAKE_CURRENT_LIST_DIR}/basictests.cpp
     ${CMAKE_CURRENT_LIST_DIR}/concurrenttests.cpp
     ${CMAKE_CURRENT_LIST_DIR}/coveragetests.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/ensembletests.cpp
     ${CMAKE_CURRENT_LIST_DIR}/instancetests.cpp
     ${CMAKE_CURRENT_LIST_DIR}/serialisetests.cpp
 )
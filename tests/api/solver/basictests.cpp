@@ -31,6 +31,7 @@ TEST(BasicSolverTest, SolverCvode)
     static const auto RELATIVE_TOLERANCE {1.23e-5};
     static const auto ABSOLUTE_TOLERANCE {3.45e-7};
     static const auto INTERPOLATE_SOLUTION {false};
+    static const auto THREAD_COUNT {4};
 
     auto solver {libOpenCOR::SolverCvode::create()};
 
@@ -49,6 +50,7 @@ TEST(BasicSolverTest, SolverCvode)
     EXPECT_EQ(solver->relativeTolerance(), 1e-07);
     EXPECT_EQ(solver->absoluteTolerance(), 1e-07);
     EXPECT_EQ(solver->interpolateSolution(), true);
+    EXPECT_EQ(solver->threadCount(), 1);
 
     solver->setMaximumStep(MAXIMUM_STEP);
     solver->setMaximumNumberOfSteps(MAXIMUM_NUMBER_OF_STEPS);
@@ -61,6 +63,7 @@ TEST(BasicSolverTest, SolverCvode)
     solver->setRelativeTolerance(RELATIVE_TOLERANCE);
     solver->setAbsoluteTolerance(ABSOLUTE_TOLERANCE);
     solver->setInterpolateSolution(INTERPOLATE_SOLUTION);
+    solver->setThreadCount(THREAD_COUNT);
 
     EXPECT_EQ(solver->maximumStep(), MAXIMUM_STEP);
     EXPECT_EQ(solver->maximumNumberOfSteps(), MAXIMUM_NUMBER_OF_STEPS);
@@ -73,6 +76,7 @@ TEST(BasicSolverTest, SolverCvode)
     EXPECT_EQ(solver->relativeTolerance(), RELATIVE_TOLERANCE);
     EXPECT_EQ(solver->absoluteTolerance(), ABSOLUTE_TOLERANCE);
     EXPECT_EQ(solver->interpolateSolution(), INTERPOLATE_SOLUTION);
+    EXPECT_EQ(solver->threadCount(), THREAD_COUNT);
 }
 
 TEST(BasicSolverTest, SolverForwardEuler)
@@ -132,6 +136,7 @@ TEST(BasicSolverTest, SolverKinsol)
     static const auto LINEAR_SOLVER {libOpenCOR::SolverKinsol::LinearSolver::GMRES};
     static const auto UPPER_HALF_BANDWIDTH {3};
     static const auto LOWER_HALF_BANDWIDTH {5};
+    static const auto THREAD_COUNT {4};
 
     auto solver {libOpenCOR::SolverKinsol::create()};
 
@@ -143,16 +148,19 @@ TEST(BasicSolverTest, SolverKinsol)
     EXPECT_EQ(solver->linearSolver(), libOpenCOR::SolverKinsol::LinearSolver::DENSE);
     EXPECT_EQ(solver->upperHalfBandwidth(), 0);
     EXPECT_EQ(solver->lowerHalfBandwidth(), 0);
+    EXPECT_EQ(solver->threadCount(), 1);
 
     solver->setMaximumNumberOfIterations(MAXIMUM_NUMBER_OF_ITERATIONS);
     solver->setLinearSolver(LINEAR_SOLVER);
     solver->setUpperHalfBandwidth(UPPER_HALF_BANDWIDTH);
     solver->setLowerHalfBandwidth(LOWER_HALF_BANDWIDTH);
+    solver->setThreadCount(THREAD_COUNT);
 
     EXPECT_EQ(solver->maximumNumberOfIterations(), MAXIMUM_NUMBER_OF_ITERATIONS);
     EXPECT_EQ(solver->linearSolver(), LINEAR_SOLVER);
     EXPECT_EQ(solver->upperHalfBandwidth(), UPPER_HALF_BANDWIDTH);
     EXPECT_EQ(solver->lowerHalfBandwidth(), LOWER_HALF_BANDWIDTH);
+    EXPECT_EQ(solver->threadCount(), THREAD_COUNT);
 }
 
 TEST(BasicSolverTest, SolverSecondOrderRungeKutta)
@@ -16,6 +16,9 @@ limitations under the License.
 
 #include "odemodel.h"
 
+#include <cmath>
+#include <functional>
+
 TEST(CvodeSolverTest, maximumStepValueWithInvalidNumber)
 {
     static const auto RELATIVE_TOLERANCE {-1.234};
@@ -172,6 +175,24 @@ TEST(CvodeSolverTest, absoluteToleranceValueWithInvalidNumber)
     EXPECT_EQ_ISSUES(instance, EXPECTED_ISSUES);
 }
 
+TEST(CvodeSolverTest, threadCountValueWithInvalidNumber)
+{
+    static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "Task instance | CVODE: the number of threads cannot be equal to 0. It must be greater than 0."},
+    }};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    const auto &solver {std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(simulation->odeSolver())};
+
+    solver->setThreadCount(0);
+
+    auto instance {document->instantiate()};
+
+    EXPECT_EQ_ISSUES(instance, EXPECTED_ISSUES);
+}
+
 TEST(CvodeSolverTest, solve)
 {
     static const auto STATE_VALUES {std::vector<double>({-63.886, 0.135007, 0.984333, 0.740973})};
@@ -224,6 +245,35 @@ TEST(CvodeSolverTest, solveWithoutInterpolateSolution)
                   ALGEBRAIC_VALUES, ALGEBRAIC_ABS_TOLS);
 }
 
+TEST(CvodeSolverTest, solveWithSeveralThreads)
+{
+    static const auto STATE_VALUES {std::vector<double>({-63.886, 0.135007, 0.984333, 0.740973})};
+    static const auto STATE_ABS_TOLS {std::vector<double>({0.001, 0.000001, 0.000001, 0.000001})};
+    static const auto RATE_VALUES {std::vector<double>({49.719, -0.128117, -0.05099, 0.09854})};
+    static const auto RATE_ABS_TOLS {std::vector<double>({0.001, 0.000001, 0.00001, 0.00001})};
+    static const auto CONSTANT_VALUES {std::vector<double>({1.0, 0.0, 0.3, 120.0, 36.0})};
+    static const auto CONSTANT_ABS_TOLS {std::vector<double>({0.0, 0.0, 0.0, 0.0, 0.0})};
+    static const auto COMPUTED_CONSTANT_VALUES {std::vector<double>({-10.613, -115.0, 12.0})};
+    static const auto COMPUTED_CONSTANT_ABS_TOLS {std::vector<double>({0.0, 0.0, 0.0})};
+    static const auto ALGEBRAIC_VALUES {std::vector<double>({0.0, -15.9819, -823.517, 789.779, 3.9699, 0.11499, 0.00287, 0.96735, 0.54133, 0.056246})};
+    static const auto ALGEBRAIC_ABS_TOLS {std::vector<double>({0.0, 0.0001, 0.001, 0.001, 0.0001, 0.00001, 0.00001, 0.00001, 0.00001, 0.000001})};
+    static const auto THREAD_COUNT {2};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    const auto &solver {std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(simulation->odeSolver())};
+
+    solver->setThreadCount(THREAD_COUNT);
+
+    OdeModel::run(document,
+                  STATE_VALUES, STATE_ABS_TOLS,
+                  RATE_VALUES, RATE_ABS_TOLS,
+                  CONSTANT_VALUES, CONSTANT_ABS_TOLS,
+                  COMPUTED_CONSTANT_VALUES, COMPUTED_CONSTANT_ABS_TOLS,
+                  ALGEBRAIC_VALUES, ALGEBRAIC_ABS_TOLS);
+}
+
 TEST(CvodeSolverTest, solveWithAdamsMoultonIntegrationMethod)
 {
     static const auto STATE_VALUES {std::vector<double>({-63.89, 0.13501, 0.98434, 0.74097})};
@@ -506,3 +556,335 @@ TEST(CvodeSolverTest, solveWithTfqmrLinearSolverAndNoPreconditioner)
                   COMPUTED_CONSTANT_VALUES, COMPUTED_CONSTANT_ABS_TOLS,
                   ALGEBRAIC_VALUES, ALGEBRAIC_ABS_TOLS);
 }
+
+TEST(CvodeSolverTest, sensitivityParameterWithInvalidIndex)
+{
+    static const auto SENSITIVITY_PARAMETER {5};
+    static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "Task instance | CVODE: the sensitivity parameter cannot be equal to 5. It must be between 0 and 4."},
+    }};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    const auto &solver {std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(simulation->odeSolver())};
+
+    solver->addSensitivityParameter(SENSITIVITY_PARAMETER);
+
+    auto instance {document->instantiate()};
+
+    EXPECT_EQ_ISSUES(instance, EXPECTED_ISSUES);
+}
+
+TEST(CvodeSolverTest, sensitivityParameters)
+{
+    auto solver {libOpenCOR::SolverCvode::create()};
+
+    EXPECT_EQ(solver->sensitivityMethod(), libOpenCOR::SolverCvode::SensitivityMethod::STAGGERED);
+    EXPECT_FALSE(solver->hasSensitivityParameters());
+    EXPECT_EQ(solver->sensitivityParameterCount(), 0);
+    EXPECT_EQ(solver->sensitivityParameter(0), SIZE_MAX);
+    EXPECT_FALSE(solver->removeAllSensitivityParameters());
+
+    solver->setSensitivityMethod(libOpenCOR::SolverCvode::SensitivityMethod::SIMULTANEOUS);
+
+    EXPECT_EQ(solver->sensitivityMethod(), libOpenCOR::SolverCvode::SensitivityMethod::SIMULTANEOUS);
+    EXPECT_TRUE(solver->addSensitivityParameter(3));
+    EXPECT_FALSE(solver->addSensitivityParameter(3));
+    EXPECT_TRUE(solver->addSensitivityParameter(4));
+    EXPECT_TRUE(solver->hasSensitivityParameters());
+    EXPECT_EQ(solver->sensitivityParameterCount(), 2);
+    EXPECT_EQ(solver->sensitivityParameter(0), 3);
+    EXPECT_EQ(solver->sensitivityParameter(1), 4);
+    EXPECT_TRUE(solver->removeAllSensitivityParameters());
+    EXPECT_FALSE(solver->hasSensitivityParameters());
+}
+
+namespace {
+
+double finalStateValue(const libOpenCOR::SedDocumentPtr &pDocument, size_t pStateIndex)
+{
+    auto instance {pDocument->instantiate()};
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    return instance->tasks()[0]->state(pStateIndex).back();
+}
+
+void checkSensitivities(libOpenCOR::SolverCvode::SensitivityMethod pSensitivityMethod)
+{
+    static const auto STATE_INDEX {0};
+    static const auto CONSTANT_INDEX {4};
+    static const auto RELATIVE_DELTA {1.0e-4};
+    static const auto RELATIVE_TOLERANCE {0.05};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    const auto &solver {std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(simulation->odeSolver())};
+
+    solver->setSensitivityMethod(pSensitivityMethod);
+    solver->addSensitivityParameter(CONSTANT_INDEX);
+
+    // Compute the sensitivity of a state with respect to a constant.
+
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    auto instanceTask {instance->tasks()[0]};
+
+    EXPECT_EQ(instanceTask->sensitivityParameterCount(), 1);
+    EXPECT_EQ(instanceTask->sensitivityParameterName(0), instanceTask->constantName(CONSTANT_INDEX));
+    EXPECT_EQ(instanceTask->sensitivityParameterName(1), "");
+    EXPECT_TRUE(instanceTask->sensitivity(STATE_INDEX, 1).empty());
+    EXPECT_TRUE(instanceTask->sensitivity(instanceTask->stateCount(), 0).empty());
+
+    const auto sensitivity {instanceTask->sensitivity(STATE_INDEX, 0)};
+
+    EXPECT_EQ(sensitivity.size(), instanceTask->voi().size());
+    EXPECT_EQ(sensitivity.front(), 0.0);
+
+    // Estimate the same sensitivity using central differences.
+
+    const auto &constantName {instanceTask->constantName(CONSTANT_INDEX)};
+    const auto separator {constantName.find('/')};
+    const auto componentName {constantName.substr(0, separator)};
+    const auto variableName {constantName.substr(separator + 1)};
+    const auto constantValue {instanceTask->constant(CONSTANT_INDEX).front()};
+    const auto delta {RELATIVE_DELTA * constantValue};
+    const auto &model {document->models()[0]};
+
+    solver->removeAllSensitivityParameters();
+
+    model->addChange(libOpenCOR::SedChangeAttribute::create(componentName, variableName, std::to_string(constantValue + delta)));
+
+    const auto upperValue {finalStateValue(document, STATE_INDEX)};
+
+    model->removeAllChanges();
+    model->addChange(libOpenCOR::SedChangeAttribute::create(componentName, variableName, std::to_string(constantValue - delta)));
+
+    const auto lowerValue {finalStateValue(document, STATE_INDEX)};
+    const auto finiteDifferenceSensitivity {(upperValue - lowerValue) / (2.0 * delta)};
+
+    EXPECT_NEAR(sensitivity.back(), finiteDifferenceSensitivity, RELATIVE_TOLERANCE * std::abs(finiteDifferenceSensitivity));
+}
+
+} // namespace
+
+TEST(CvodeSolverTest, solveWithStaggeredSensitivities)
+{
+    checkSensitivities(libOpenCOR::SolverCvode::SensitivityMethod::STAGGERED);
+}
+
+TEST(CvodeSolverTest, solveWithSimultaneousSensitivities)
+{
+    checkSensitivities(libOpenCOR::SolverCvode::SensitivityMethod::SIMULTANEOUS);
+}
+
+TEST(CvodeSolverTest, sensitivityOfStateInitialisedByConstant)
+{
+    static const auto END_TIME {1.0};
+    static const auto NUMBER_OF_STEPS {100};
+    static const auto ABSOLUTE_TOLERANCE {1.0e-5};
+
+    // x(0) = k and dx/dt = -x, so dx/dk = exp(-t) and, in particular, dx/dk(0) = 1.
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/state_initialised_by_constant.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    const auto &solver {std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(simulation->odeSolver())};
+
+    simulation->setOutputEndTime(END_TIME);
+    simulation->setNumberOfSteps(NUMBER_OF_STEPS);
+
+    solver->addSensitivityParameter(0);
+
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    auto instanceTask {instance->tasks()[0]};
+
+    EXPECT_EQ(instanceTask->constantName(0), "main/k");
+
+    const auto sensitivity {instanceTask->sensitivity(0, 0)};
+
+    EXPECT_EQ(sensitivity.front(), 1.0);
+    EXPECT_NEAR(sensitivity.back(), std::exp(-END_TIME), ABSOLUTE_TOLERANCE);
+}
+
+TEST(CvodeSolverTest, objectiveData)
+{
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+    auto instance {document->instantiate()};
+    auto instanceTask {instance->tasks()[0]};
+    const libOpenCOR::Doubles values(static_cast<size_t>(simulation->numberOfSteps()) + 1, 0.0);
+
+    EXPECT_FALSE(instanceTask->removeAllObjectiveData());
+    EXPECT_FALSE(instanceTask->addObjectiveData(instanceTask->stateCount(), values));
+    EXPECT_FALSE(instanceTask->addObjectiveData(0, libOpenCOR::Doubles(values.size() - 1, 0.0)));
+    EXPECT_TRUE(instanceTask->addObjectiveData(0, values));
+    EXPECT_TRUE(std::isnan(instanceTask->objective()));
+    EXPECT_TRUE(instanceTask->objectiveGradient().empty());
+    EXPECT_TRUE(instanceTask->removeAllObjectiveData());
+}
+
+TEST(CvodeSolverTest, objectiveGradientWithNonCvodeSolver)
+{
+    static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "Task: the gradient of an objective can only be computed using CVODE."},
+    }};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+
+    simulation->setOdeSolver(libOpenCOR::SolverForwardEuler::create());
+
+    auto instance {document->instantiate()};
+    auto instanceTask {instance->tasks()[0]};
+
+    instanceTask->addObjectiveData(0, libOpenCOR::Doubles(static_cast<size_t>(simulation->numberOfSteps()) + 1, 0.0));
+
+    instance->run();
+
+    EXPECT_EQ_ISSUES(instance, EXPECTED_ISSUES);
+}
+
+namespace {
+
+double objectiveValue(const libOpenCOR::SedDocumentPtr &pDocument, size_t pStateIndex, const libOpenCOR::Doubles &pValues)
+{
+    auto instance {pDocument->instantiate()};
+    auto instanceTask {instance->tasks()[0]};
+
+    instanceTask->addObjectiveData(pStateIndex, pValues);
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    return instanceTask->objective();
+}
+
+void checkObjectiveGradient(const std::function<void(const libOpenCOR::SolverCvodePtr &)> &pConfigureSolver = {})
+{
+    static const auto STATE_INDEX {0};
+    static const auto CONSTANT_INDEX {4};
+    static const auto RELATIVE_DELTA {1.0e-4};
+    static const auto RELATIVE_TOLERANCE {0.05};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedUniformTimeCourse>(document->simulations()[0])};
+
+    if (pConfigureSolver) {
+        pConfigureSolver(std::dynamic_pointer_cast<libOpenCOR::SolverCvode>(simulation->odeSolver()));
+    }
+
+    libOpenCOR::Doubles values(static_cast<size_t>(simulation->numberOfSteps()) + 1, 0.0);
+
+    values[1] = NAN;
+
+    // Compute the gradient of our objective, i.e. the sum of the squares of a state (ignoring its second value).
+
+    auto instance {document->instantiate()};
+    auto instanceTask {instance->tasks()[0]};
+
+    instanceTask->addObjectiveData(STATE_INDEX, values);
+
+    instance->run();
+
+    EXPECT_FALSE(instance->hasIssues());
+
+    const auto state {instanceTask->state(STATE_INDEX)};
+    auto objective {0.0};
+
+    for (size_t i {0}; i < state.size(); ++i) {
+        if (i != 1) {
+            objective += state[i] * state[i];
+        }
+    }
+
+    EXPECT_DOUBLE_EQ(instanceTask->objective(), objective);
+
+    const auto gradient {instanceTask->objectiveGradient()};
+
+    EXPECT_EQ(gradient.size(), instanceTask->constantCount());
+
+    // Estimate the same gradient component using central differences.
+
+    const auto &constantName {instanceTask->constantName(CONSTANT_INDEX)};
+    const auto separator {constantName.find('/')};
+    const auto componentName {constantName.substr(0, separator)};
+    const auto variableName {constantName.substr(separator + 1)};
+    const auto constantValue {instanceTask->constant(CONSTANT_INDEX).front()};
+    const auto delta {RELATIVE_DELTA * constantValue};
+    const auto &model {document->models()[0]};
+
+    model->addChange(libOpenCOR::SedChangeAttribute::create(componentName, variableName, std::to_string(constantValue + delta)));
+
+    const auto upperValue {objectiveValue(document, STATE_INDEX, values)};
+
+    model->removeAllChanges();
+    model->addChange(libOpenCOR::SedChangeAttribute::create(componentName, variableName, std::to_string(constantValue - delta)));
+
+    const auto lowerValue {objectiveValue(document, STATE_INDEX, values)};
+    const auto finiteDifferenceGradient {(upperValue - lowerValue) / (2.0 * delta)};
+
+    EXPECT_NEAR(gradient[CONSTANT_INDEX], finiteDifferenceGradient, RELATIVE_TOLERANCE * std::abs(finiteDifferenceGradient));
+}
+
+} // namespace
+
+TEST(CvodeSolverTest, solveWithObjectiveGradient)
+{
+    checkObjectiveGradient();
+}
+
+TEST(CvodeSolverTest, solveWithObjectiveGradientAndFunctionalIterationType)
+{
+    checkObjectiveGradient([](const libOpenCOR::SolverCvodePtr &pSolver) {
+        pSolver->setIterationType(libOpenCOR::SolverCvode::IterationType::FUNCTIONAL);
+    });
+}
+
+TEST(CvodeSolverTest, solveWithObjectiveGradientAndBandedLinearSolver)
+{
+    checkObjectiveGradient([](const libOpenCOR::SolverCvodePtr &pSolver) {
+        pSolver->setLinearSolver(libOpenCOR::SolverCvode::LinearSolver::BANDED);
+        pSolver->setUpperHalfBandwidth(1);
+        pSolver->setLowerHalfBandwidth(2);
+    });
+}
+
+TEST(CvodeSolverTest, solveWithObjectiveGradientAndDiagonalLinearSolver)
+{
+    checkObjectiveGradient([](const libOpenCOR::SolverCvodePtr &pSolver) {
+        pSolver->setLinearSolver(libOpenCOR::SolverCvode::LinearSolver::DIAGONAL);
+    });
+}
+
+TEST(CvodeSolverTest, solveWithObjectiveGradientAndGmresLinearSolver)
+{
+    checkObjectiveGradient([](const libOpenCOR::SolverCvodePtr &pSolver) {
+        pSolver->setLinearSolver(libOpenCOR::SolverCvode::LinearSolver::GMRES);
+    });
+}
+
+TEST(CvodeSolverTest, solveWithObjectiveGradientAndGmresLinearSolverAndNoPreconditioner)
+{
+    checkObjectiveGradient([](const libOpenCOR::SolverCvodePtr &pSolver) {
+        pSolver->setLinearSolver(libOpenCOR::SolverCvode::LinearSolver::GMRES);
+        pSolver->setPreconditioner(libOpenCOR::SolverCvode::Preconditioner::NO);
+    });
+}
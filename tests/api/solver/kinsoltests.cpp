@@ -36,6 +36,24 @@ TEST(KinsolSolverTest, maximumNumberOfIterationsValueWithInvalidNumber)
     EXPECT_EQ_ISSUES(instance, EXPECTED_ISSUES);
 }
 
+TEST(KinsolSolverTest, threadCountValueWithInvalidNumber)
+{
+    static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
+        {libOpenCOR::Issue::Type::ERROR, "Task instance | KINSOL: the number of threads cannot be equal to 0. It must be greater than 0."},
+    }};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/nla1.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedSteadyState>(document->simulations()[0])};
+    const auto &solver {std::dynamic_pointer_cast<libOpenCOR::SolverKinsol>(simulation->nlaSolver())};
+
+    solver->setThreadCount(0);
+
+    auto instance {document->instantiate()};
+
+    EXPECT_EQ_ISSUES(instance, EXPECTED_ISSUES);
+}
+
 TEST(KinsolSolverTest, bandedLinearSolverAndUpperHalfBandwidthValueWithNumberTooSmall)
 {
     static const libOpenCOR::ExpectedIssues EXPECTED_ISSUES {{
@@ -154,6 +172,24 @@ TEST(KinsolSolverTest, solve)
     expectNla1Solution(instance->tasks()[0]);
 }
 
+TEST(KinsolSolverTest, solveWithSeveralThreads)
+{
+    static const auto THREAD_COUNT {2};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/nla1.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    const auto &simulation {std::dynamic_pointer_cast<libOpenCOR::SedSteadyState>(document->simulations()[0])};
+    const auto &solver {std::dynamic_pointer_cast<libOpenCOR::SolverKinsol>(simulation->nlaSolver())};
+
+    solver->setThreadCount(THREAD_COUNT);
+
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    expectNla1Solution(instance->tasks()[0]);
+}
+
 TEST(KinsolSolverTest, solveWithBandedLinearSolver)
 {
     auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/nla2.cellml"))};
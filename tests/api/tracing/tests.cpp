@@ -0,0 +1,148 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "tests/utils.h"
+
+#include <libopencor>
+
+#include <thread>
+#include <vector>
+
+namespace {
+
+size_t occurrenceCount(const std::string &pString, const std::string &pSubString)
+{
+    size_t res {0};
+
+    for (auto i {pString.find(pSubString)}; i != std::string::npos; i = pString.find(pSubString, i + pSubString.size())) {
+        ++res;
+    }
+
+    return res;
+}
+
+} // namespace
+
+TEST(TracingTest, disabled)
+{
+    EXPECT_FALSE(libOpenCOR::tracingEnabled());
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    EXPECT_EQ(libOpenCOR::traceJson().find(R"("ph":"X")"), std::string::npos);
+}
+
+TEST(TracingTest, odeModel)
+{
+    libOpenCOR::clearTrace();
+    libOpenCOR::setTracingEnabled(true);
+
+    EXPECT_TRUE(libOpenCOR::tracingEnabled());
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    libOpenCOR::setTracingEnabled(false);
+
+    const auto trace {libOpenCOR::traceJson()};
+
+    EXPECT_EQ(trace.rfind(R"({"displayTimeUnit":"ms","traceEvents":[)", 0), 0U);
+    EXPECT_EQ(trace.substr(trace.size() - 2), "]}");
+    EXPECT_NE(trace.find(R"("name":"File::create","cat":"file")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"CellmlFile::parse","cat":"cellml")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"CellmlFile::analyse","cat":"cellml")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"CellmlFileRuntime::generateCode","cat":"runtime")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"CellmlFileRuntime::compile","cat":"runtime")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"CellmlFileRuntime::jitLink","cat":"runtime")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"runtimesMutex","cat":"lock")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"SedInstanceTask::initialise","cat":"sed")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"SedInstanceTask::run","cat":"sed")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"SolverOde::initialise","cat":"solver")"), std::string::npos);
+    EXPECT_NE(trace.find(R"("name":"SolverOde::solve","cat":"solver")"), std::string::npos);
+    EXPECT_EQ(trace.find(R"("name":"SolverNla::solve","cat":"solver")"), std::string::npos);
+
+    // Make sure that clearing our trace removes all our events.
+
+    libOpenCOR::clearTrace();
+
+    EXPECT_EQ(libOpenCOR::traceJson().find(R"("ph":"X")"), std::string::npos);
+}
+
+TEST(TracingTest, daeModel)
+{
+    libOpenCOR::clearTrace();
+    libOpenCOR::setTracingEnabled(true);
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/sed/dae.cellml"))};
+    auto document {libOpenCOR::SedDocument::create(file)};
+    auto instance {document->instantiate()};
+
+    instance->run();
+
+    libOpenCOR::setTracingEnabled(false);
+
+    EXPECT_NE(libOpenCOR::traceJson().find(R"("name":"SolverNla::solve","cat":"solver")"), std::string::npos);
+
+    libOpenCOR::clearTrace();
+}
+
+TEST(TracingTest, multipleThreads)
+{
+    static const auto THREAD_COUNT {3U};
+
+    libOpenCOR::clearTrace();
+    libOpenCOR::setTracingEnabled(true);
+
+    std::vector<std::thread> threads;
+
+    threads.reserve(THREAD_COUNT);
+
+    for (size_t i {0}; i < THREAD_COUNT; ++i) {
+        threads.emplace_back([]() {
+            auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_2.cellml"))};
+            auto document {libOpenCOR::SedDocument::create(file)};
+            auto instance {document->instantiate()};
+
+            instance->run();
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    libOpenCOR::setTracingEnabled(false);
+
+    // Make sure that the events of our (finished) threads were kept and that each thread ran its own instance.
+
+    const auto trace {libOpenCOR::traceJson()};
+
+    EXPECT_GE(occurrenceCount(trace, R"("name":"thread_name")"), THREAD_COUNT);
+    EXPECT_EQ(occurrenceCount(trace, R"("name":"SedInstanceTask::run")"), THREAD_COUNT);
+
+    // Make sure that clearing our trace stops tracking the trace buffers of our finished threads.
+
+    libOpenCOR::clearTrace();
+
+    EXPECT_LT(occurrenceCount(libOpenCOR::traceJson(), R"("name":"thread_name")"), THREAD_COUNT);
+}
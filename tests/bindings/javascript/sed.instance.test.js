@@ -931,4 +931,168 @@ test.describe('Sed instance tests', () => {
 
     assert.strictEqual(instance.hasIssues, true);
   });
+
+  test('Ensemble', () => {
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const ensemble = document.instantiateEnsemble(['membrane/Cm'], [0.75, 1.0, 1.25]);
+
+    assert.strictEqual(ensemble.hasIssues, false);
+    assert.strictEqual(ensemble.memberCount, 3);
+    assert.strictEqual(ensemble.parameterCount, 1);
+    assert.strictEqual(ensemble.parameterName(0), 'membrane/Cm');
+
+    ensemble.run();
+
+    assert.strictEqual(ensemble.hasIssues, false);
+
+    const instance = document.instantiate();
+
+    instance.run();
+
+    const instanceTask = instance.tasks[0];
+    const ensembleState = ensemble.state(1, 0);
+    const instanceState = instanceTask.state(0);
+
+    assert.strictEqual(ensemble.voi.length, instanceTask.voi.length);
+    assert(Math.abs(ensembleState[ensembleState.length - 1] - instanceState[instanceState.length - 1]) < 1e-9);
+  });
+
+  test('Set initial states and constants', () => {
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const instance = document.instantiate();
+    const instanceTask = instance.tasks[0];
+
+    assert.strictEqual(instanceTask.setInitialState(instanceTask.stateCount, -80.0), false);
+    assert.strictEqual(instanceTask.setConstant(instanceTask.constantCount, 1.25), false);
+    assert.strictEqual(instanceTask.resetInitialStatesAndConstants(), false);
+
+    assert.strictEqual(instanceTask.setInitialState(0, -80.0), true);
+    assert.strictEqual(instanceTask.setConstant(0, 1.25), true);
+
+    instance.run();
+
+    assert.strictEqual(instance.hasIssues, false);
+    assert.strictEqual(instanceTask.state(0)[0], -80.0);
+    assert.strictEqual(instanceTask.constant(0)[0], 1.25);
+
+    assert.strictEqual(instanceTask.resetInitialStatesAndConstants(), true);
+
+    instance.run();
+
+    assert.strictEqual(instance.hasIssues, false);
+    assert.notStrictEqual(instanceTask.state(0)[0], -80.0);
+    assert.notStrictEqual(instanceTask.constant(0)[0], 1.25);
+  });
+
+  test('Continue run', () => {
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const simulation = document.simulations[0];
+
+    simulation.outputEndTime = 10.0;
+    simulation.numberOfSteps = 100;
+
+    const instance = document.instantiate();
+
+    instance.run();
+
+    assert.strictEqual(instance.hasIssues, false);
+
+    instance.continueRun(20.0, 100);
+
+    assert.strictEqual(instance.hasIssues, false);
+
+    const instanceTask = instance.tasks[0];
+    const voi = instanceTask.voi;
+
+    assert.strictEqual(voi.length, 101);
+    assert(Math.abs(voi[0] - 10.0) < 1e-9);
+    assert(Math.abs(voi[voi.length - 1] - 20.0) < 1e-9);
+  });
+
+  test('Checkpoint and restore', () => {
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const simulation = document.simulations[0];
+
+    simulation.outputEndTime = 10.0;
+    simulation.numberOfSteps = 100;
+
+    const instance = document.instantiate();
+
+    instance.run();
+
+    assert.strictEqual(instance.hasIssues, false);
+
+    const checkpoint = instance.checkpoint();
+
+    assert(checkpoint.length > 0);
+
+    const restoredInstance = document.instantiate();
+
+    assert.strictEqual(restoredInstance.restore(checkpoint), true);
+    assert.strictEqual(restoredInstance.restore(new Uint8Array(0)), false);
+
+    const instanceTask = instance.tasks[0];
+    const restoredInstanceTask = restoredInstance.tasks[0];
+
+    assert.deepStrictEqual(restoredInstanceTask.voi, instanceTask.voi);
+    assert.deepStrictEqual(restoredInstanceTask.state(0), instanceTask.state(0));
+
+    instance.continueRun(20.0, 100);
+    restoredInstance.continueRun(20.0, 100);
+
+    assert.strictEqual(instance.hasIssues, false);
+    assert.strictEqual(restoredInstance.hasIssues, false);
+
+    const state = instanceTask.state(0);
+    const restoredState = restoredInstanceTask.state(0);
+
+    assert(Math.abs(restoredState[restoredState.length - 1] - state[state.length - 1]) < 1e-6);
+  });
+
+  test('Instrumentation', () => {
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const simulation = document.simulations[0];
+
+    simulation.outputEndTime = 10.0;
+    simulation.numberOfSteps = 100;
+
+    const instance = document.instantiate();
+    const instanceTask = instance.tasks[0];
+
+    assert.strictEqual(instanceTask.instrumented, false);
+
+    instanceTask.instrumented = true;
+
+    instance.run();
+
+    assert.strictEqual(instance.hasIssues, false);
+    assert.strictEqual(instanceTask.instrumented, true);
+    assert(instanceTask.phaseTime(loc.SedInstanceTask.Phase.COMPILATION) > 0.0);
+    assert(instanceTask.phaseTime(loc.SedInstanceTask.Phase.ODE_SOLVING) > 0.0);
+    assert(instanceTask.statistic(loc.SedInstanceTask.Statistic.ODE_STEP_COUNT) > 0);
+    assert.strictEqual(instanceTask.statistic(loc.SedInstanceTask.Statistic.NLA_SOLVE_COUNT), 0);
+    assert(instanceTask.statistic(loc.SedInstanceTask.Statistic.RESULT_BYTE_COUNT) > 0);
+    assert.strictEqual(instanceTask.nlaSystemCount, 0);
+    assert.strictEqual(instanceTask.nlaSystemSolveCount(0), 0);
+  });
 });
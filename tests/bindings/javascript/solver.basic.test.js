@@ -40,6 +40,7 @@ test.describe('Solver basic tests', () => {
     assert.strictEqual(solver.relativeTolerance, 1e-7);
     assert.strictEqual(solver.absoluteTolerance, 1e-7);
     assert.strictEqual(solver.interpolateSolution, true);
+    assert.strictEqual(solver.threadCount, 1);
 
     solver.maximumStep = 1.23;
     solver.maximumNumberOfSteps = 123;
@@ -52,6 +53,7 @@ test.describe('Solver basic tests', () => {
     solver.relativeTolerance = 1.23e-5;
     solver.absoluteTolerance = 3.45e-7;
     solver.interpolateSolution = false;
+    solver.threadCount = 4;
 
     assert.strictEqual(solver.maximumStep, 1.23);
     assert.strictEqual(solver.maximumNumberOfSteps, 123);
@@ -64,6 +66,7 @@ test.describe('Solver basic tests', () => {
     assert.strictEqual(solver.relativeTolerance, 1.23e-5);
     assert.strictEqual(solver.absoluteTolerance, 3.45e-7);
     assert.strictEqual(solver.interpolateSolution, false);
+    assert.strictEqual(solver.threadCount, 4);
   });
 
   test('Forward Euler solver', () => {
@@ -119,16 +122,19 @@ test.describe('Solver basic tests', () => {
     assert.strictEqual(solver.linearSolver, loc.SolverKinsol.LinearSolver.DENSE);
     assert.strictEqual(solver.upperHalfBandwidth, 0);
     assert.strictEqual(solver.lowerHalfBandwidth, 0);
+    assert.strictEqual(solver.threadCount, 1);
 
     solver.maximumNumberOfIterations = 123;
     solver.linearSolver = loc.SolverKinsol.LinearSolver.GMRES;
     solver.upperHalfBandwidth = 3;
     solver.lowerHalfBandwidth = 5;
+    solver.threadCount = 4;
 
     assert.strictEqual(solver.maximumNumberOfIterations, 123);
     assert.strictEqual(solver.linearSolver, loc.SolverKinsol.LinearSolver.GMRES);
     assert.strictEqual(solver.upperHalfBandwidth, 3);
     assert.strictEqual(solver.lowerHalfBandwidth, 5);
+    assert.strictEqual(solver.threadCount, 4);
   });
 
   test('Second-order Runge-Kutta solver', () => {
@@ -14,6 +14,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+import assert from 'node:assert';
 import test from 'node:test';
 
 import libOpenCOR from './libopencor.js';
@@ -546,4 +547,80 @@ test.describe('Solver CVODE tests', () => {
       [7, 7, 7, 7, 7, 7, 7, 7, 7, 7]
     );
   });
+
+  test('Sensitivity parameter with invalid index', () => {
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const simulation = document.simulations[0];
+    const solver = simulation.odeSolver;
+
+    solver.addSensitivityParameter(5);
+
+    const instance = document.instantiate();
+
+    assertIssues(loc, instance, [
+      [
+        loc.Issue.Type.ERROR,
+        'Task instance | CVODE: the sensitivity parameter cannot be equal to 5. It must be between 0 and 4.'
+      ]
+    ]);
+  });
+
+  test('Solve with sensitivities', () => {
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const simulation = document.simulations[0];
+    const solver = simulation.odeSolver;
+
+    solver.sensitivityMethod = loc.SolverCvode.SensitivityMethod.SIMULTANEOUS;
+
+    assert.strictEqual(solver.addSensitivityParameter(4), true);
+    assert.strictEqual(solver.addSensitivityParameter(4), false);
+    assert.strictEqual(solver.hasSensitivityParameters, true);
+    assert.strictEqual(solver.sensitivityParameterCount, 1);
+    assert.strictEqual(solver.sensitivityParameter(0), 4);
+
+    const instance = document.instantiate();
+
+    instance.run();
+
+    assert.strictEqual(instance.hasIssues, false);
+
+    const instanceTask = instance.tasks[0];
+
+    assert.strictEqual(instanceTask.sensitivityParameterCount, 1);
+    assert.strictEqual(instanceTask.sensitivityParameterName(0), instanceTask.constantName(4));
+    assert.strictEqual(instanceTask.sensitivity(0, 0).length, instanceTask.voi.length);
+    assert.strictEqual(instanceTask.sensitivity(0, 0)[0], 0);
+    assert.strictEqual(instanceTask.sensitivity(0, 1).length, 0);
+  });
+
+  test('Solve with objective gradient', () => {
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const simulation = document.simulations[0];
+    const instance = document.instantiate();
+    const instanceTask = instance.tasks[0];
+    const values = new Array(simulation.numberOfSteps + 1).fill(0);
+
+    assert.strictEqual(instanceTask.addObjectiveData(instanceTask.stateCount, values), false);
+    assert.strictEqual(instanceTask.addObjectiveData(0, values.slice(1)), false);
+    assert.strictEqual(instanceTask.addObjectiveData(0, values), true);
+
+    instance.run();
+
+    assert.strictEqual(instance.hasIssues, false);
+    assert.strictEqual(instanceTask.objectiveGradient.length, instanceTask.constantCount);
+    assert.strictEqual(instanceTask.removeAllObjectiveData(), true);
+    assert.strictEqual(instanceTask.removeAllObjectiveData(), false);
+  });
 });
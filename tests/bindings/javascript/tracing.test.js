@@ -0,0 +1,85 @@
+/*
+Copyright libOpenCOR contributors.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+import assert from 'node:assert';
+import test from 'node:test';
+
+import libOpenCOR from './libopencor.js';
+import * as utils from './utils.js';
+
+const loc = await libOpenCOR();
+
+function completeEventNames(trace) {
+  return new Set(
+    JSON.parse(trace)
+      .traceEvents.filter((event) => event.ph === 'X')
+      .map((event) => event.name)
+  );
+}
+
+test.describe('Tracing tests', () => {
+  test.beforeEach(() => {
+    loc.FileManager.instance().reset();
+  });
+
+  test('Disabled', () => {
+    assert.strictEqual(loc.tracingEnabled(), false);
+
+    const file = new loc.File(utils.resourcePath('cellml_2.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const instance = document.instantiate();
+
+    instance.run();
+
+    assert.strictEqual(completeEventNames(loc.traceJson()).size, 0);
+  });
+
+  test('ODE model', () => {
+    loc.clearTrace();
+    loc.setTracingEnabled(true);
+
+    assert.strictEqual(loc.tracingEnabled(), true);
+
+    const file = new loc.File(utils.resourcePath('api/solver/ode.cellml'));
+
+    file.setContents(utils.fileContents(file.path));
+
+    const document = new loc.SedDocument(file);
+    const instance = document.instantiate();
+
+    instance.run();
+
+    loc.setTracingEnabled(false);
+
+    const eventNames = completeEventNames(loc.traceJson());
+
+    assert.ok(eventNames.has('File::create'));
+    assert.ok(eventNames.has('CellmlFile::analyse'));
+    assert.ok(eventNames.has('CellmlFileRuntime::generateCode'));
+    assert.ok(eventNames.has('CellmlFileRuntime::compile'));
+    assert.ok(eventNames.has('runtimesMutex'));
+    assert.ok(eventNames.has('SedInstanceTask::initialise'));
+    assert.ok(eventNames.has('SedInstanceTask::run'));
+    assert.ok(eventNames.has('SolverOde::solve'));
+
+    loc.clearTrace();
+
+    assert.strictEqual(completeEventNames(loc.traceJson()).size, 0);
+  });
+});
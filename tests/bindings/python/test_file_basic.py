@@ -13,9 +13,13 @@
 # limitations under the License.
 
 
+import functools
+import http.server
 import libopencor as loc
 import os
 import platform
+import tempfile
+import threading
 import utils
 from utils import assert_issues
 
@@ -23,6 +27,9 @@ expected_no_issues = []
 expected_non_existing_file_issues = [
     [loc.Issue.Type.Error, "The file does not exist."],
 ]
+expected_irretrievable_file_issues = [
+    [loc.Issue.Type.Error, "The file could not be downloaded."],
+]
 expected_unknown_file_issues = [
     [
         loc.Issue.Type.Error,
@@ -106,6 +113,122 @@ def test_remote_file():
     assert file.contents != []
 
 
+def test_remote_file_with_imports_from_local_http_server():
+    requested_paths = []
+
+    class RequestHandler(http.server.SimpleHTTPRequestHandler):
+        def do_GET(self):
+            requested_paths.append(self.path)
+
+            super().do_GET()
+
+        def log_message(self, format, *args):
+            pass
+
+    server = http.server.ThreadingHTTPServer(
+        ("127.0.0.1", 0),
+        functools.partial(RequestHandler, directory=utils.resource_path()),
+    )
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+
+    thread.start()
+
+    try:
+        base_url = f"http://127.0.0.1:{server.server_address[1]}/support/cellml/model_with_valid_imports"
+        file = loc.File(f"{base_url}/model.cellml")
+
+        assert file.type == loc.File.Type.CellmlFile
+        assert_issues(file, expected_no_issues)
+        assert sorted(requested_paths) == [
+            "/support/cellml/model_with_valid_imports/model.cellml",
+            "/support/cellml/model_with_valid_imports/modules.cellml",
+            "/support/cellml/model_with_valid_imports/parameters.cellml",
+        ]
+    finally:
+        server.shutdown()
+        server.server_close()
+
+
+def test_remote_file_with_download_cache():
+    revalidations = []
+
+    class RequestHandler(http.server.SimpleHTTPRequestHandler):
+        def do_GET(self):
+            revalidations.append(self.headers.get("If-Modified-Since") is not None)
+
+            super().do_GET()
+
+        def log_message(self, format, *args):
+            pass
+
+    server = http.server.ThreadingHTTPServer(
+        ("127.0.0.1", 0),
+        functools.partial(RequestHandler, directory=utils.resource_path()),
+    )
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    file_manager = loc.FileManager.instance()
+
+    thread.start()
+
+    try:
+        with tempfile.TemporaryDirectory() as cache_directory:
+            file_manager.cache_directory = cache_directory
+
+            assert file_manager.cache_directory == cache_directory
+
+            # Download a file, which gets cached, and then download it again, which results in it being revalidated.
+
+            url = f"http://127.0.0.1:{server.server_address[1]}/cellml_2.cellml"
+            file = loc.File(url)
+            contents = file.contents
+
+            assert file.type == loc.File.Type.CellmlFile
+            assert revalidations == [False]
+            assert len(os.listdir(cache_directory)) == 2
+
+            file_manager.reset()
+
+            file = loc.File(url)
+
+            assert file.type == loc.File.Type.CellmlFile
+            assert file.contents == contents
+            assert revalidations == [False, True]
+
+            # Go offline and stop our server, so that only our download cache can be used.
+
+            server.shutdown()
+
+            file_manager.reset()
+            file_manager.offline = True
+
+            assert file_manager.offline
+
+            file = loc.File(url)
+
+            assert file.type == loc.File.Type.CellmlFile
+            assert file.contents == contents
+            assert revalidations == [False, True]
+
+            file = loc.File(f"http://127.0.0.1:{server.server_address[1]}/cellml_2.sedml")
+
+            assert file.type == loc.File.Type.IrretrievableFile
+            assert_issues(file, expected_irretrievable_file_issues)
+
+            # Set a size limit that is too small for our download cache to keep anything.
+
+            file_manager.cache_size_limit = 0
+
+            assert file_manager.cache_size_limit == 0
+    finally:
+        file_manager.reset()
+        file_manager.cache_directory = ""
+        file_manager.cache_size_limit = 100 * 1024 * 1024
+        file_manager.offline = False
+
+        server.shutdown()
+        server.server_close()
+
+
 def test_encoded_remote_file():
     file = loc.File(
         "https://models.physiomeproject.org/workspace/aed/@@rawfile/d4accf8429dbf5bdd5dfa1719790f361f5baddbe/FAIRDO%20BG%20example%203.1.cellml"
@@ -833,3 +833,174 @@ def test_simulation_with_initial_time_failing():
     instance.run()
 
     assert instance.has_issues
+
+
+def test_ensemble():
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    ensemble = document.instantiate_ensemble(["membrane/Cm"], [0.75, 1.0, 1.25])
+
+    assert not ensemble.has_issues
+    assert ensemble.member_count == 3
+    assert ensemble.parameter_count == 1
+    assert ensemble.parameter_name(0) == "membrane/Cm"
+
+    ensemble.run()
+
+    assert not ensemble.has_issues
+
+    instance = document.instantiate()
+
+    instance.run()
+
+    instance_task = instance.tasks[0]
+
+    assert len(ensemble.voi) == len(instance_task.voi)
+    assert math.isclose(ensemble.state(1, 0)[-1], instance_task.state(0)[-1], rel_tol=1e-9)
+
+
+def test_set_initial_states_and_constants():
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    instance = document.instantiate()
+    instance_task = instance.tasks[0]
+
+    assert not instance_task.set_initial_state(instance_task.state_count, -80.0)
+    assert not instance_task.set_constant(instance_task.constant_count, 1.25)
+    assert not instance_task.reset_initial_states_and_constants()
+
+    assert instance_task.set_initial_state(0, -80.0)
+    assert instance_task.set_constant(0, 1.25)
+
+    instance.run()
+
+    assert not instance.has_issues
+    assert instance_task.state(0)[0] == -80.0
+    assert instance_task.constant(0)[0] == 1.25
+
+    assert instance_task.reset_initial_states_and_constants()
+
+    instance.run()
+
+    assert not instance.has_issues
+    assert instance_task.state(0)[0] != -80.0
+    assert instance_task.constant(0)[0] != 1.25
+
+
+def test_continue_run():
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    simulation = document.simulations[0]
+
+    simulation.output_end_time = 10.0
+    simulation.number_of_steps = 100
+
+    instance = document.instantiate()
+
+    instance.run()
+
+    assert not instance.has_issues
+
+    instance.continue_run(20.0, 100)
+
+    assert not instance.has_issues
+
+    instance_task = instance.tasks[0]
+
+    assert len(instance_task.voi) == 101
+    assert math.isclose(instance_task.voi[0], 10.0)
+    assert math.isclose(instance_task.voi[-1], 20.0)
+
+
+def test_checkpoint_and_restore():
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    simulation = document.simulations[0]
+
+    simulation.output_end_time = 10.0
+    simulation.number_of_steps = 100
+
+    instance = document.instantiate()
+
+    instance.run()
+
+    assert not instance.has_issues
+
+    checkpoint = instance.checkpoint()
+
+    assert len(checkpoint) > 0
+
+    restored_instance = document.instantiate()
+
+    assert restored_instance.restore(checkpoint)
+    assert not restored_instance.restore([])
+
+    instance_task = instance.tasks[0]
+    restored_instance_task = restored_instance.tasks[0]
+
+    assert list(restored_instance_task.voi) == list(instance_task.voi)
+    assert list(restored_instance_task.state(0)) == list(instance_task.state(0))
+
+    instance.continue_run(20.0, 100)
+    restored_instance.continue_run(20.0, 100)
+
+    assert not instance.has_issues
+    assert not restored_instance.has_issues
+    assert math.isclose(restored_instance_task.state(0)[-1], instance_task.state(0)[-1], rel_tol=1e-6, abs_tol=1e-6)
+
+
+def test_ode_model_steady_state():
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    steady_state = loc.SedSteadyState(document)
+    task = document.tasks[0]
+
+    steady_state.ode_solver = loc.SolverCvode()
+
+    document.add_simulation(steady_state)
+
+    task.simulation = steady_state
+
+    instance = document.instantiate()
+
+    instance.run()
+
+    assert not instance.has_issues
+
+    instance_task = instance.tasks[0]
+
+    assert len(instance_task.voi) == 1
+
+    for i in range(instance_task.rate_count):
+        assert math.isclose(instance_task.rate(i)[0], 0.0, abs_tol=1e-6)
+
+
+def test_instrumentation():
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    simulation = document.simulations[0]
+
+    simulation.output_end_time = 10.0
+    simulation.number_of_steps = 100
+
+    instance = document.instantiate()
+    instance_task = instance.tasks[0]
+
+    assert not instance_task.instrumented
+
+    instance_task.instrumented = True
+
+    instance.run()
+
+    assert not instance.has_issues
+    assert instance_task.instrumented
+    assert instance_task.phase_time(loc.SedInstanceTask.Phase.Compilation) > 0.0
+    assert instance_task.phase_time(loc.SedInstanceTask.Phase.OdeSolving) > 0.0
+    assert instance_task.statistic(loc.SedInstanceTask.Statistic.OdeStepCount) > 0
+    assert instance_task.statistic(loc.SedInstanceTask.Statistic.RhsEvaluationCount) >= instance_task.statistic(
+        loc.SedInstanceTask.Statistic.OdeStepCount
+    )
+    assert instance_task.statistic(loc.SedInstanceTask.Statistic.NlaSolveCount) == 0
+    assert instance_task.statistic(loc.SedInstanceTask.Statistic.ResultByteCount) > 0
+    assert instance_task.nla_system_count == 0
+    assert instance_task.nla_system_solve_count(0) == 0
@@ -34,6 +34,7 @@ def test_cvode_solver():
     assert solver.relative_tolerance == 1e-07
     assert solver.absolute_tolerance == 1e-07
     assert solver.interpolate_solution
+    assert solver.thread_count == 1
 
     solver.maximum_step = 1.23
     solver.maximum_number_of_steps = 123
@@ -46,6 +47,7 @@ def test_cvode_solver():
     solver.relative_tolerance = 1.23e-5
     solver.absolute_tolerance = 3.45e-7
     solver.interpolate_solution = False
+    solver.thread_count = 4
 
     assert solver.maximum_step == 1.23
     assert solver.maximum_number_of_steps == 123
@@ -58,6 +60,7 @@ def test_cvode_solver():
     assert solver.relative_tolerance == 1.23e-5
     assert solver.absolute_tolerance == 3.45e-7
     assert not solver.interpolate_solution
+    assert solver.thread_count == 4
 
 
 def test_forward_euler_solver():
@@ -113,16 +116,19 @@ def test_kinsol_solver():
     assert solver.linear_solver == loc.SolverKinsol.LinearSolver.Dense
     assert solver.upper_half_bandwidth == 0
     assert solver.lower_half_bandwidth == 0
+    assert solver.thread_count == 1
 
     solver.maximum_number_of_iterations = 123
     solver.linear_solver = loc.SolverKinsol.LinearSolver.Gmres
     solver.upper_half_bandwidth = 3
     solver.lower_half_bandwidth = 5
+    solver.thread_count = 4
 
     assert solver.maximum_number_of_iterations == 123
     assert solver.linear_solver == loc.SolverKinsol.LinearSolver.Gmres
     assert solver.upper_half_bandwidth == 3
     assert solver.lower_half_bandwidth == 5
+    assert solver.thread_count == 4
 
 
 def test_second_order_runge_kutta_solver():
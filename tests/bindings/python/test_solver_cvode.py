@@ -879,3 +879,73 @@ def test_solve_with_tfqmr_linear_solver_and_no_preconditioner():
         algebraic_values,
         algebraic_abs_tols,
     )
+
+
+def test_sensitivity_parameter_with_invalid_index():
+    expected_issues = [
+        [
+            loc.Issue.Type.Error,
+            "Task instance | CVODE: the sensitivity parameter cannot be equal to 5. It must be between 0 and 4.",
+        ]
+    ]
+
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    simulation = document.simulations[0]
+    solver = simulation.ode_solver
+
+    solver.add_sensitivity_parameter(5)
+
+    instance = document.instantiate()
+
+    assert_issues(instance, expected_issues)
+
+
+def test_solve_with_sensitivities():
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    simulation = document.simulations[0]
+    solver = simulation.ode_solver
+
+    solver.sensitivity_method = loc.SolverCvode.SensitivityMethod.Simultaneous
+
+    assert solver.add_sensitivity_parameter(4)
+    assert not solver.add_sensitivity_parameter(4)
+    assert solver.has_sensitivity_parameters
+    assert solver.sensitivity_parameter_count == 1
+    assert solver.sensitivity_parameter(0) == 4
+
+    instance = document.instantiate()
+
+    instance.run()
+
+    assert not instance.has_issues
+
+    instance_task = instance.tasks[0]
+
+    assert instance_task.sensitivity_parameter_count == 1
+    assert instance_task.sensitivity_parameter_name(0) == instance_task.constant_name(4)
+    assert len(instance_task.sensitivity(0, 0)) == len(instance_task.voi)
+    assert instance_task.sensitivity(0, 0)[0] == 0.0
+    assert len(instance_task.sensitivity(0, 1)) == 0
+
+
+def test_solve_with_objective_gradient():
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    simulation = document.simulations[0]
+    instance = document.instantiate()
+    instance_task = instance.tasks[0]
+    values = [0.0] * (simulation.number_of_steps + 1)
+
+    assert not instance_task.add_objective_data(instance_task.state_count, values)
+    assert not instance_task.add_objective_data(0, values[1:])
+    assert instance_task.add_objective_data(0, values)
+
+    instance.run()
+
+    assert not instance.has_issues
+    assert instance_task.objective == sum(value * value for value in instance_task.state(0))
+    assert len(instance_task.objective_gradient) == instance_task.constant_count
+    assert instance_task.remove_all_objective_data()
+    assert not instance_task.remove_all_objective_data()
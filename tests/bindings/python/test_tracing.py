@@ -0,0 +1,86 @@
+# Copyright libOpenCOR contributors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+
+import json
+import libopencor as loc
+import utils
+
+
+def complete_event_names(trace):
+    return {
+        event["name"]
+        for event in json.loads(trace)["traceEvents"]
+        if event["ph"] == "X"
+    }
+
+
+def test_disabled():
+    assert loc.tracing_enabled() is False
+
+    file = loc.File(utils.resource_path("cellml_2.cellml"))
+    document = loc.SedDocument(file)
+    instance = document.instantiate()
+
+    instance.run()
+
+    assert complete_event_names(loc.trace_json()) == set()
+
+
+def test_ode_model():
+    loc.clear_trace()
+    loc.set_tracing_enabled(True)
+
+    assert loc.tracing_enabled() is True
+
+    file = loc.File(utils.resource_path("api/solver/ode.cellml"))
+    document = loc.SedDocument(file)
+    instance = document.instantiate()
+
+    instance.run()
+
+    loc.set_tracing_enabled(False)
+
+    event_names = complete_event_names(loc.trace_json())
+
+    assert "File::create" in event_names
+    assert "CellmlFile::analyse" in event_names
+    assert "CellmlFileRuntime::generateCode" in event_names
+    assert "CellmlFileRuntime::compile" in event_names
+    assert "runtimesMutex" in event_names
+    assert "SedInstanceTask::initialise" in event_names
+    assert "SedInstanceTask::run" in event_names
+    assert "SolverOde::solve" in event_names
+    assert "SolverNla::solve" not in event_names
+
+    loc.clear_trace()
+
+    assert complete_event_names(loc.trace_json()) == set()
+
+
+def test_dae_model():
+    loc.clear_trace()
+    loc.set_tracing_enabled(True)
+
+    file = loc.File(utils.resource_path("api/sed/dae.cellml"))
+    document = loc.SedDocument(file)
+    instance = document.instantiate()
+
+    instance.run()
+
+    loc.set_tracing_enabled(False)
+
+    assert "SolverNla::solve" in complete_event_names(loc.trace_json())
+
+    loc.clear_trace()
@@ -42,6 +42,53 @@ TEST(BasicCellmlTest, modelWithValidImports)
     auto cellmlFile = libOpenCOR::CellmlFile::create(file);
 
     EXPECT_FALSE(cellmlFile->hasIssues());
+
+    // Another CellML file with the same contents and imports should share the same analysed model.
+
+    auto otherFile = libOpenCOR::File::create(libOpenCOR::resourcePath("support/cellml/model_with_valid_imports/other_model.cellml"), false);
+
+    otherFile->setContents(libOpenCOR::charArrayToUnsignedChars(libOpenCOR::textFileContents(libOpenCOR::resourcePath("support/cellml/model_with_valid_imports/model.cellml")).c_str()));
+
+    auto otherCellmlFile = libOpenCOR::CellmlFile::create(otherFile);
+
+    EXPECT_FALSE(otherCellmlFile->hasIssues());
+    EXPECT_EQ(cellmlFile->analyserModel(), otherCellmlFile->analyserModel());
+}
+
+TEST(BasicCellmlTest, modelsWithSameContents)
+{
+    // Two CellML files with the same contents should share the same analysed model.
+
+    auto contents {libOpenCOR::charArrayToUnsignedChars(libOpenCOR::textFileContents(libOpenCOR::resourcePath("cellml_2.cellml")).c_str())};
+    auto file = libOpenCOR::File::create(libOpenCOR::resourcePath("some_cellml_file.cellml"), false);
+    auto otherFile = libOpenCOR::File::create(libOpenCOR::resourcePath("some_other_cellml_file.cellml"), false);
+
+    file->setContents(contents);
+    otherFile->setContents(contents);
+
+    auto cellmlFile = libOpenCOR::CellmlFile::create(file);
+    auto otherCellmlFile = libOpenCOR::CellmlFile::create(otherFile);
+
+    EXPECT_FALSE(cellmlFile->hasIssues());
+    EXPECT_FALSE(otherCellmlFile->hasIssues());
+    EXPECT_NE(cellmlFile, otherCellmlFile);
+    EXPECT_EQ(cellmlFile->analyserModel(), otherCellmlFile->analyserModel());
+    EXPECT_EQ(cellmlFile->runtime(), otherCellmlFile->runtime());
+
+    // A CellML file with different contents should have its own analysed model.
+
+    auto differentFile = libOpenCOR::File::create(libOpenCOR::resourcePath("cellml_1_x.cellml"));
+    auto differentCellmlFile = libOpenCOR::CellmlFile::create(differentFile);
+
+    EXPECT_NE(cellmlFile->analyserModel(), differentCellmlFile->analyserModel());
+}
+
+TEST(BasicCellmlTest, remoteModelWithValidImports)
+{
+    auto file = libOpenCOR::File::create(std::string(libOpenCOR::REMOTE_BASE_PATH) + "/support/cellml/model_with_valid_imports/model.cellml");
+    auto cellmlFile = libOpenCOR::CellmlFile::create(file);
+
+    EXPECT_FALSE(cellmlFile->hasIssues());
 }
 
 TEST(BasicCellmlTest, modelWithInvalidImports)
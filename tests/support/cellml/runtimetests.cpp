@@ -42,3 +42,90 @@ TEST(RuntimeCellmlTest, invalidRuntimeBecauseOfAnalysisIssues)
 
     EXPECT_EQ_ISSUES(cellmlFileRuntime, expectedIssues);
 }
+
+TEST(RuntimeCellmlTest, invalidEnsembleRuntimeBecauseOfNonOdeModel)
+{
+    static const libOpenCOR::ExpectedIssues expectedIssues {{
+        {libOpenCOR::Issue::Type::ERROR, "An ensemble runtime can only be created for an ODE model."},
+    }};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/nla1.cellml"))};
+    auto cellmlFile {libOpenCOR::CellmlFile::create(file)};
+    auto cellmlFileRuntime {cellmlFile->ensembleRuntime(4)};
+
+    EXPECT_EQ_ISSUES(cellmlFileRuntime, expectedIssues);
+}
+
+TEST(RuntimeCellmlTest, validEnsembleRuntime)
+{
+    static constexpr auto ENSEMBLE_WIDTH {4};
+    static constexpr auto VOI {0.5};
+
+    auto file {libOpenCOR::File::create(libOpenCOR::resourcePath("api/solver/ode.cellml"))};
+    auto cellmlFile {libOpenCOR::CellmlFile::create(file)};
+    auto cellmlFileRuntime {cellmlFile->runtime()};
+    auto cellmlFileEnsembleRuntime {cellmlFile->ensembleRuntime(ENSEMBLE_WIDTH)};
+
+    EXPECT_FALSE(cellmlFileEnsembleRuntime->hasIssues());
+    EXPECT_EQ(cellmlFileRuntime->ensembleWidth(), 0);
+    EXPECT_EQ(cellmlFileEnsembleRuntime->ensembleWidth(), ENSEMBLE_WIDTH);
+    EXPECT_EQ(cellmlFile->ensembleRuntime(ENSEMBLE_WIDTH), cellmlFileEnsembleRuntime);
+
+    // Initialise our ensemble arrays and give each lane a different set of constants.
+
+    const auto analyserModel {cellmlFile->analyserModel()};
+    const auto stateCount {analyserModel->stateCount()};
+    const auto constantCount {analyserModel->constantCount()};
+    const auto computedConstantCount {analyserModel->computedConstantCount()};
+    const auto algebraicVariableCount {analyserModel->algebraicVariableCount()};
+
+    libOpenCOR::Doubles ensembleStates(stateCount * ENSEMBLE_WIDTH);
+    libOpenCOR::Doubles ensembleRates(stateCount * ENSEMBLE_WIDTH);
+    libOpenCOR::Doubles ensembleConstants(constantCount * ENSEMBLE_WIDTH);
+    libOpenCOR::Doubles ensembleComputedConstants(computedConstantCount * ENSEMBLE_WIDTH);
+    libOpenCOR::Doubles ensembleAlgebraicVariables(algebraicVariableCount * ENSEMBLE_WIDTH);
+
+    cellmlFileEnsembleRuntime->initialiseArraysForDifferentialModel()(ensembleStates.data(), ensembleRates.data(),
+                                                                      ensembleConstants.data(), ensembleComputedConstants.data(),
+                                                                      ensembleAlgebraicVariables.data());
+
+    for (size_t i {0}; i < constantCount; ++i) {
+        for (size_t lane {0}; lane < ENSEMBLE_WIDTH; ++lane) {
+            ensembleConstants[i * ENSEMBLE_WIDTH + lane] *= 1.0 + 0.1 * static_cast<double>(lane);
+        }
+    }
+
+    cellmlFileEnsembleRuntime->computeComputedConstantsForDifferentialModel()(VOI, ensembleStates.data(), ensembleRates.data(),
+                                                                              ensembleConstants.data(), ensembleComputedConstants.data(),
+                                                                              ensembleAlgebraicVariables.data());
+    cellmlFileEnsembleRuntime->computeRates()(VOI, ensembleStates.data(), ensembleRates.data(),
+                                              ensembleConstants.data(), ensembleComputedConstants.data(),
+                                              ensembleAlgebraicVariables.data());
+
+    // Check that each lane gives the same results as our scalar runtime.
+
+    libOpenCOR::Doubles states(stateCount);
+    libOpenCOR::Doubles rates(stateCount);
+    libOpenCOR::Doubles constants(constantCount);
+    libOpenCOR::Doubles computedConstants(computedConstantCount);
+    libOpenCOR::Doubles algebraicVariables(algebraicVariableCount);
+
+    for (size_t lane {0}; lane < ENSEMBLE_WIDTH; ++lane) {
+        cellmlFileRuntime->initialiseArraysForDifferentialModel()(states.data(), rates.data(), constants.data(),
+                                                                  computedConstants.data(), algebraicVariables.data());
+
+        for (size_t i {0}; i < constantCount; ++i) {
+            constants[i] = ensembleConstants[i * ENSEMBLE_WIDTH + lane];
+        }
+
+        cellmlFileRuntime->computeComputedConstantsForDifferentialModel()(VOI, states.data(), rates.data(), constants.data(),
+                                                                          computedConstants.data(), algebraicVariables.data());
+        cellmlFileRuntime->computeRates()(VOI, states.data(), rates.data(), constants.data(),
+                                          computedConstants.data(), algebraicVariables.data());
+
+        for (size_t i {0}; i < stateCount; ++i) {
+            EXPECT_DOUBLE_EQ(ensembleStates[i * ENSEMBLE_WIDTH + lane], states[i]);
+            EXPECT_DOUBLE_EQ(ensembleRates[i * ENSEMBLE_WIDTH + lane], rates[i]);
+        }
+    }
+}